@@ -0,0 +1,119 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/arena.hpp>
+#include <bsl/array.hpp>
+#include <bsl/bench.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/hash.hpp>
+#include <bsl/heap_allocator.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/unordered_map.hpp>
+
+/// NOTE:
+/// - Measures the cost of the whole life of a small, reserved map: the
+///   table is allocated, KEYS elements are added, and the map is freed.
+///   With the heap_allocator this is three new[]/delete[] pairs per map.
+///   With an arena_allocator, the table is bumped out of a pre-reserved
+///   buffer and freeing the map (and everything else in the arena) is a
+///   single reset(). Each op is one insert.
+///
+
+namespace
+{
+    /// @brief defines the number of keys added to each map
+    constexpr bsl::uintmx KEYS{static_cast<bsl::uintmx>(32)};
+    /// @brief defines the number of maps created per repetition
+    constexpr bsl::uintmx MAPS{static_cast<bsl::uintmx>(16384)};
+    /// @brief defines the size of the arena's buffer
+    constexpr bsl::uintmx ARENA_SIZE{static_cast<bsl::uintmx>(4096)};
+    /// @brief defines the total number of measured repetitions
+    constexpr bsl::uintmx REPS{static_cast<bsl::uintmx>(11)};
+    /// @brief defines the total number of unmeasured repetitions
+    constexpr bsl::uintmx WARMUP{static_cast<bsl::uintmx>(1)};
+
+    /// <!-- description -->
+    ///   @brief Adds KEYS elements to the provided map
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam MAP_T the type of map to fill
+    ///   @param mut_map the map to fill
+    ///
+    template<typename MAP_T>
+    void
+    fill(MAP_T &mut_map) noexcept
+    {
+        bsl::discard(mut_map.try_reserve(bsl::safe_umx{KEYS}));
+        for (bsl::uintmx mut_i{}; mut_i < KEYS; ++mut_i) {
+            bsl::discard(mut_map.insert(mut_i, mut_i));
+        }
+    }
+}
+
+/// <!-- description -->
+///   @brief Runs the allocator benchmark.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    constexpr bsl::safe_umx ops{KEYS * MAPS};
+
+    bsl::discard(bsl::bench<REPS, WARMUP>("heap_allocator", ops, []() noexcept {
+        for (bsl::uintmx mut_i{}; mut_i < MAPS; ++mut_i) {
+            bsl::unordered_map<bsl::uintmx, bsl::uintmx> mut_map{};
+            fill(mut_map);
+            bsl::bench_keep(mut_map.size().get());
+        }
+    }));
+
+    alignas(bsl::uintmx) bsl::array<bsl::uint8, ARENA_SIZE> mut_buf{};
+    bsl::span<bsl::uint8> mut_view{mut_buf};
+    bsl::arena mut_arena{mut_view};
+
+    bsl::discard(bsl::bench<REPS, WARMUP>("arena_allocator", ops, [&]() noexcept {
+        for (bsl::uintmx mut_i{}; mut_i < MAPS; ++mut_i) {
+            {
+                bsl::unordered_map<
+                    bsl::uintmx,
+                    bsl::uintmx,
+                    bsl::hash<bsl::uintmx>,
+                    bsl::arena_allocator>
+                    mut_map{bsl::arena_allocator{mut_arena}};
+
+                fill(mut_map);
+                bsl::bench_keep(mut_map.size().get());
+            }
+
+            mut_arena.reset();
+        }
+    }));
+
+    return bsl::exit_success;
+}
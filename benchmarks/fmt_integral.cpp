@@ -0,0 +1,218 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/bench.hpp>
+#include <bsl/carray.hpp>
+#include <bsl/char_type.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/details/fmt_impl_integral_helpers.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/fmt_options.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+
+/// NOTE:
+/// - Compares the integral to text conversion used by bsl::fmt with the
+///   one it replaced (a checked divide/modulo per digit, stored in reverse
+///   and copied out one char at a time). Both versions write the digits
+///   to the same buffer, and a checksum of the output is kept so that
+///   the compiler cannot remove the work being measured.
+///
+
+namespace
+{
+    /// @brief defines the total number of values to convert per run
+    constexpr bsl::uintmx NUM_VALS{static_cast<bsl::uintmx>(1000)};
+    /// @brief defines the size of the output buffer
+    constexpr bsl::uintmx OUT_SIZE{static_cast<bsl::uintmx>(128)};
+
+    /// @brief stores the values to convert
+    constinit bsl::carray<bsl::uint64, NUM_VALS> g_mut_vals{};
+    /// @brief stores the converted output
+    constinit bsl::carray<bsl::char_type, OUT_SIZE> g_mut_out{};
+
+    /// <!-- description -->
+    ///   @brief The conversion that bsl::fmt used to use.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ops the fmt options used to format the output
+    ///   @param val the value to convert
+    ///   @return Returns the total number of chars written to g_mut_out
+    ///
+    [[nodiscard]] auto
+    legacy_convert(bsl::fmt_options const &ops, bsl::safe_u64 const &val) noexcept -> bsl::uintmx
+    {
+        constexpr bsl::safe_u64 base2{static_cast<bsl::uint64>(2)};
+        constexpr bsl::safe_u64 base10{static_cast<bsl::uint64>(10)};
+        constexpr bsl::safe_u64 base16{static_cast<bsl::uint64>(16)};
+        constexpr bsl::safe_u64 last_numerical_digit{static_cast<bsl::uint64>(9)};
+
+        bsl::details::fmt_impl_integral_info mut_info{};
+        auto mut_base{base10};
+        if (bsl::fmt_type::fmt_type_x == ops.type()) {
+            mut_base = base16;
+        }
+        else if (bsl::fmt_type::fmt_type_b == ops.type()) {
+            mut_base = base2;
+        }
+        else {
+            bsl::touch();
+        }
+
+        bsl::safe_u64 mut_val{val.get()};
+        if (mut_val.is_zero()) {
+            *g_mut_out.at_if(0U) = '0';
+            return static_cast<bsl::uintmx>(1);
+        }
+
+        for (mut_info.digits = {}; !mut_val.checked().is_zero(); ++mut_info.digits) {
+            bsl::safe_u64 mut_digit{(mut_val % mut_base).checked()};
+            mut_val = (mut_val / mut_base).checked();
+
+            if (mut_digit > last_numerical_digit) {
+                mut_digit -= base10;
+                mut_digit += static_cast<bsl::uint64>('A');
+            }
+            else {
+                mut_digit += static_cast<bsl::uint64>('0');
+            }
+
+            *mut_info.buf.at_if(mut_info.digits.get()) =
+                static_cast<bsl::char_type>(mut_digit.checked().get());
+        }
+
+        bsl::uintmx mut_size{};
+        for (bsl::safe_idx mut_i{mut_info.digits}; mut_i.is_pos(); --mut_i) {
+            auto const idx{(mut_i - bsl::safe_idx::magic_1()).get()};
+            *g_mut_out.at_if(mut_size) = *mut_info.buf.at_if(idx);
+            ++mut_size;
+        }
+
+        return mut_size;
+    }
+
+    /// <!-- description -->
+    ///   @brief The conversion that bsl::fmt uses now.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ops the fmt options used to format the output
+    ///   @param val the value to convert
+    ///   @return Returns the total number of chars written to g_mut_out
+    ///
+    [[nodiscard]] auto
+    current_convert(bsl::fmt_options const &ops, bsl::safe_u64 const &val) noexcept -> bsl::uintmx
+    {
+        auto const info{bsl::details::get_integral_info(ops, val)};
+        bsl::discard(__builtin_memcpy(g_mut_out.data(), info.data(), info.digits.get()));
+        return info.digits.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Benchmarks the provided conversion over all of the values.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam FUNC the type of conversion to run
+    ///   @param name the name of the benchmark
+    ///   @param ops the fmt options used to format the output
+    ///   @param func the conversion to run
+    ///   @return Returns a checksum of everything that was outputted
+    ///
+    template<typename FUNC>
+    [[nodiscard]] auto
+    run(bsl::cstr_type const name, bsl::fmt_options const &ops, FUNC const &func) noexcept
+        -> bsl::uintmx
+    {
+        bsl::uintmx mut_sum{};
+
+        bsl::discard(bsl::bench(name, bsl::safe_umx{NUM_VALS}, [&]() noexcept {
+            for (bsl::uintmx mut_i{}; mut_i < NUM_VALS; ++mut_i) {
+                auto const len{func(ops, bsl::safe_u64{*g_mut_vals.at_if(mut_i)})};
+                mut_sum += len + static_cast<bsl::uintmx>(*g_mut_out.at_if(len - 1U));
+            }
+            bsl::bench_keep(mut_sum);
+        }));
+
+        return mut_sum;
+    }
+
+    /// <!-- description -->
+    ///   @brief Runs both conversions using the provided fmt options.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param legacy_name the name of the legacy conversion's benchmark
+    ///   @param current_name the name of the current conversion's benchmark
+    ///   @param ops the fmt options used to format the output
+    ///   @return Returns true if both conversions produced the same output
+    ///
+    [[nodiscard]] auto
+    compare(
+        bsl::cstr_type const legacy_name,
+        bsl::cstr_type const current_name,
+        bsl::fmt_options const &ops) noexcept -> bool
+    {
+        auto const legacy{run(legacy_name, ops, &legacy_convert)};
+        auto const current{run(current_name, ops, &current_convert)};
+        return legacy == current;
+    }
+}
+
+/// <!-- description -->
+///   @brief Runs the integral to text conversion benchmark.
+///
+/// <!-- inputs/outputs -->
+///   @return Returns bsl::exit_success if both conversions produced the
+///     same output, bsl::exit_failure otherwise.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    constexpr bsl::uint64 lcg_mul{static_cast<bsl::uint64>(6364136223846793005U)};
+    constexpr bsl::uint64 lcg_inc{static_cast<bsl::uint64>(1442695040888963407U)};
+
+    /// NOTE:
+    /// - The values are spread across every number of digits by shifting
+    ///   a pseudo random number right by a pseudo random amount.
+    ///
+
+    bsl::uint64 mut_seed{static_cast<bsl::uint64>(42)};
+    for (bsl::uintmx mut_i{}; mut_i < NUM_VALS; ++mut_i) {
+        mut_seed = (mut_seed * lcg_mul) + lcg_inc;
+        *g_mut_vals.at_if(mut_i) = mut_seed >> (mut_seed % static_cast<bsl::uint64>(64));
+    }
+
+    bool mut_same{true};
+    mut_same = compare("fmt_d_legacy", "fmt_d", bsl::fmt_options{"d"}) && mut_same;
+    mut_same = compare("fmt_x_legacy", "fmt_x", bsl::fmt_options{"x"}) && mut_same;
+    mut_same = compare("fmt_b_legacy", "fmt_b", bsl::fmt_options{"b"}) && mut_same;
+
+    if (!mut_same) {
+        bsl::error() << "conversions do not match\n";
+        return bsl::exit_failure;
+    }
+
+    return bsl::exit_success;
+}
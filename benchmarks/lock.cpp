@@ -0,0 +1,92 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/bench.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/cstr_type.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/lock_guard.hpp>
+#include <bsl/mcs_lock.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/spinlock.hpp>
+#include <bsl/ticket_lock.hpp>
+
+/// NOTE:
+/// - Measures the cost of taking and releasing each lock from a single
+///   thread (i.e., with no contention), which is the price every
+///   critical section pays. Each op is one bsl::lock_guard around a
+///   single increment. Build with BSL_LOCK_STATS defined to see the
+///   extra cost of recording statistics.
+///
+
+namespace
+{
+    /// @brief defines the total number of lock/unlock pairs per repetition
+    constexpr bsl::uintmx TOTAL{static_cast<bsl::uintmx>(1048576)};
+    /// @brief defines the total number of measured repetitions
+    constexpr bsl::uintmx REPS{static_cast<bsl::uintmx>(11)};
+    /// @brief defines the total number of unmeasured repetitions
+    constexpr bsl::uintmx WARMUP{static_cast<bsl::uintmx>(1)};
+
+    /// <!-- description -->
+    ///   @brief Benchmarks TOTAL lock/unlock pairs of the provided lock.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LOCK_T the type of lock to benchmark
+    ///   @param name the name of the benchmark
+    ///
+    template<typename LOCK_T>
+    void
+    run(bsl::cstr_type const name) noexcept
+    {
+        LOCK_T mut_lock{};
+        bsl::uintmx mut_count{};
+
+        bsl::discard(bsl::bench<REPS, WARMUP>(name, bsl::safe_umx{TOTAL}, [&]() noexcept {
+            for (bsl::uintmx mut_i{}; mut_i < TOTAL; ++mut_i) {
+                bsl::lock_guard const guard{mut_lock};
+                ++mut_count;
+            }
+        }));
+
+        bsl::bench_keep(mut_count);
+    }
+}
+
+/// <!-- description -->
+///   @brief Runs the lock benchmark.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    run<bsl::spinlock>("spinlock");
+    run<bsl::ticket_lock>("ticket_lock");
+    run<bsl::mcs_lock>("mcs_lock");
+
+    return bsl::exit_success;
+}
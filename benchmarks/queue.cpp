@@ -0,0 +1,204 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <bsl/array.hpp>
+#include <bsl/bench.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/cstr_type.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/mpmc_queue.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/spsc_queue.hpp>
+
+/// NOTE:
+/// - Measures the throughput of bsl::spsc_queue with one producer and
+///   one consumer, and of bsl::mpmc_queue with one and with NUM_THREADS
+///   producers and consumers. Each repetition starts the producer
+///   threads, pops every value (on the main thread, or on the consumer
+///   threads) and joins the threads, so ops is the total number of
+///   values that go through the queue. A thread that finds the queue
+///   full (or empty) yields, so the numbers are only meaningful when
+///   there is a core for each thread.
+///
+
+namespace
+{
+    /// @brief defines the max number of elements in each queue
+    constexpr bsl::uintmx QUEUE_N{static_cast<bsl::uintmx>(1024)};
+    /// @brief defines the max number of producers (and consumers)
+    constexpr bsl::uintmx NUM_THREADS{static_cast<bsl::uintmx>(4)};
+    /// @brief defines the total number of values per repetition
+    constexpr bsl::uintmx TOTAL{static_cast<bsl::uintmx>(1048576)};
+    /// @brief defines the total number of measured repetitions
+    constexpr bsl::uintmx REPS{static_cast<bsl::uintmx>(11)};
+    /// @brief defines the total number of unmeasured repetitions
+    constexpr bsl::uintmx WARMUP{static_cast<bsl::uintmx>(1)};
+
+    /// @brief stores the spsc queue being measured
+    constinit bsl::spsc_queue<bsl::uintmx, QUEUE_N> g_mut_spsc{};
+    /// @brief stores the mpmc queue being measured
+    constinit bsl::mpmc_queue<bsl::uintmx, QUEUE_N> g_mut_mpmc{};
+    /// @brief stores the number of values each mpmc producer pushes
+    constinit bsl::uintmx g_mut_per_thread{};
+    /// @brief stores the total number of values popped from the mpmc queue
+    constinit bsl::uintmx g_mut_popped{};
+
+    /// <!-- description -->
+    ///   @brief Pushes TOTAL values onto the spsc queue.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_arg ignored
+    ///   @return Always returns a nullptr
+    ///
+    [[nodiscard]] auto
+    spsc_producer(void *const pmut_arg) noexcept -> void *
+    {
+        bsl::discard(pmut_arg);
+
+        for (bsl::uintmx mut_i{}; mut_i < TOTAL; ++mut_i) {
+            while (!g_mut_spsc.try_push(mut_i)) {
+                bsl::discard(sched_yield());
+            }
+        }
+
+        return nullptr;
+    }
+
+    /// <!-- description -->
+    ///   @brief Pushes g_mut_per_thread values onto the mpmc queue.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_arg ignored
+    ///   @return Always returns a nullptr
+    ///
+    [[nodiscard]] auto
+    mpmc_producer(void *const pmut_arg) noexcept -> void *
+    {
+        bsl::discard(pmut_arg);
+
+        for (bsl::uintmx mut_i{}; mut_i < g_mut_per_thread; ++mut_i) {
+            while (!g_mut_mpmc.try_push(mut_i)) {
+                bsl::discard(sched_yield());
+            }
+        }
+
+        return nullptr;
+    }
+
+    /// <!-- description -->
+    ///   @brief Pops values from the mpmc queue until TOTAL values have
+    ///     been popped by all of the consumers.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_arg ignored
+    ///   @return Always returns a nullptr
+    ///
+    [[nodiscard]] auto
+    mpmc_consumer(void *const pmut_arg) noexcept -> void *
+    {
+        constexpr auto one{static_cast<bsl::uintmx>(1)};
+        bsl::discard(pmut_arg);
+
+        bsl::uintmx mut_val{};
+        while (__atomic_load_n(&g_mut_popped, __ATOMIC_RELAXED) < TOTAL) {
+            if (!g_mut_mpmc.try_pop(mut_val)) {
+                bsl::discard(sched_yield());
+                continue;
+            }
+
+            bsl::discard(__atomic_fetch_add(&g_mut_popped, one, __ATOMIC_RELAXED));
+        }
+
+        bsl::bench_keep(mut_val);
+        return nullptr;
+    }
+
+    /// <!-- description -->
+    ///   @brief Benchmarks the mpmc queue with the provided number of
+    ///     producers and consumers.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param name the name of the benchmark
+    ///   @param threads the number of producers (and consumers)
+    ///
+    void
+    run_mpmc(bsl::cstr_type const name, bsl::safe_idx const &threads) noexcept
+    {
+        g_mut_per_thread = TOTAL / threads.get();
+
+        bsl::discard(bsl::bench<REPS, WARMUP>(name, bsl::safe_umx{TOTAL}, [&]() noexcept {
+            bsl::array<pthread_t, NUM_THREADS> mut_producers{};
+            bsl::array<pthread_t, NUM_THREADS> mut_consumers{};
+
+            g_mut_popped = {};
+            for (bsl::safe_idx mut_i{}; mut_i < threads; ++mut_i) {
+                auto *const pmut_p{mut_producers.at_if(mut_i)};
+                bsl::discard(pthread_create(pmut_p, nullptr, &mpmc_producer, nullptr));
+                auto *const pmut_c{mut_consumers.at_if(mut_i)};
+                bsl::discard(pthread_create(pmut_c, nullptr, &mpmc_consumer, nullptr));
+            }
+
+            for (bsl::safe_idx mut_i{}; mut_i < threads; ++mut_i) {
+                bsl::discard(pthread_join(*mut_producers.at_if(mut_i), nullptr));
+                bsl::discard(pthread_join(*mut_consumers.at_if(mut_i), nullptr));
+            }
+        }));
+    }
+}
+
+/// <!-- description -->
+///   @brief Runs the queue benchmark.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::discard(bsl::bench<REPS, WARMUP>("spsc_queue", bsl::safe_umx{TOTAL}, []() noexcept {
+        pthread_t mut_producer{};
+        bsl::discard(pthread_create(&mut_producer, nullptr, &spsc_producer, nullptr));
+
+        bsl::uintmx mut_val{};
+        for (bsl::uintmx mut_i{}; mut_i < TOTAL; ++mut_i) {
+            while (!g_mut_spsc.try_pop(mut_val)) {
+                bsl::discard(sched_yield());
+            }
+        }
+
+        bsl::discard(pthread_join(mut_producer, nullptr));
+        bsl::bench_keep(mut_val);
+    }));
+
+    run_mpmc("mpmc_queue_1x1", bsl::safe_idx::magic_1());
+    run_mpmc("mpmc_queue_4x4", bsl::safe_idx{NUM_THREADS});
+
+    return bsl::exit_success;
+}
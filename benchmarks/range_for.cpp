@@ -0,0 +1,150 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/bench.hpp>
+#include <bsl/carray.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/cstr_type.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+
+/// NOTE:
+/// - Compares a ranged based for loop over a bsl::span with a raw
+///   pointer loop over the same memory. In release mode, the
+///   contiguous_iterator is a bare pointer once created, so both loops
+///   should run at the same speed. In debug mode, every increment is
+///   checked, so the ranged based for loop is expected to be slower.
+///   A checksum of the output is kept so that the compiler cannot
+///   remove the work being measured.
+///
+
+namespace
+{
+    /// @brief defines the total number of values to sum per run
+    constexpr bsl::uintmx NUM_VALS{static_cast<bsl::uintmx>(4096)};
+    /// @brief defines the total number of sums per repetition
+    constexpr bsl::uintmx NUM_RUNS{static_cast<bsl::uintmx>(200)};
+
+    /// @brief stores the values to sum
+    constinit bsl::carray<bsl::uint32, NUM_VALS> g_mut_vals{};
+
+    /// <!-- description -->
+    ///   @brief Sums the values using a raw pointer loop.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param spn the values to sum
+    ///   @return Returns the sum of the values
+    ///
+    [[nodiscard]] auto
+    raw_sum(bsl::span<bsl::uint32 const> const &spn) noexcept -> bsl::uint64
+    {
+        bsl::uint64 mut_sum{};
+        bsl::uint32 const *const ptr{spn.data()};
+        bsl::uintmx const size{spn.size().get()};
+
+        for (bsl::uintmx mut_i{}; mut_i < size; ++mut_i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            mut_sum += static_cast<bsl::uint64>(ptr[mut_i]);
+        }
+
+        return mut_sum;
+    }
+
+    /// <!-- description -->
+    ///   @brief Sums the values using a ranged based for loop.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param spn the values to sum
+    ///   @return Returns the sum of the values
+    ///
+    [[nodiscard]] auto
+    range_for_sum(bsl::span<bsl::uint32 const> const &spn) noexcept -> bsl::uint64
+    {
+        bsl::uint64 mut_sum{};
+        for (auto const &elem : spn) {
+            mut_sum += static_cast<bsl::uint64>(elem);
+        }
+
+        return mut_sum;
+    }
+
+    /// <!-- description -->
+    ///   @brief Benchmarks the provided loop over all of the values.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam FUNC the type of loop to run
+    ///   @param name the name of the benchmark
+    ///   @param func the loop to run
+    ///   @return Returns a checksum of everything that was summed
+    ///
+    template<typename FUNC>
+    [[nodiscard]] auto
+    run(bsl::cstr_type const name, FUNC const &func) noexcept -> bsl::uint64
+    {
+        bsl::uint64 mut_sum{};
+        bsl::span<bsl::uint32 const> const spn{g_mut_vals.data(), bsl::safe_umx{NUM_VALS}};
+
+        bsl::discard(bsl::bench(name, bsl::safe_umx{NUM_RUNS * NUM_VALS}, [&]() noexcept {
+            for (bsl::uintmx mut_r{}; mut_r < NUM_RUNS; ++mut_r) {
+                mut_sum += func(spn);
+                bsl::bench_keep(mut_sum);
+            }
+        }));
+
+        return mut_sum;
+    }
+}
+
+/// <!-- description -->
+///   @brief Runs the ranged based for loop benchmark.
+///
+/// <!-- inputs/outputs -->
+///   @return Returns bsl::exit_success if both loops produced the
+///     same sum, bsl::exit_failure otherwise.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    constexpr bsl::uint32 lcg_mul{static_cast<bsl::uint32>(1664525U)};
+    constexpr bsl::uint32 lcg_inc{static_cast<bsl::uint32>(1013904223U)};
+
+    bsl::uint32 mut_seed{static_cast<bsl::uint32>(42)};
+    for (bsl::uintmx mut_i{}; mut_i < NUM_VALS; ++mut_i) {
+        mut_seed = (mut_seed * lcg_mul) + lcg_inc;
+        *g_mut_vals.at_if(mut_i) = mut_seed;
+    }
+
+    auto const raw{run("span_sum_raw", &raw_sum)};
+    auto const range_for{run("span_sum_range_for", &range_for_sum)};
+
+    if (raw != range_for) {
+        bsl::error() << "sums do not match\n";
+        return bsl::exit_failure;
+    }
+
+    return bsl::exit_success;
+}
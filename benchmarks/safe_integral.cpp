@@ -0,0 +1,153 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/bench.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/cstr_type.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/safe_integral.hpp>
+
+/// NOTE:
+/// - Measures the cost of the checks performed by bsl::safe_integral by
+///   summing the same values using raw integers, the checked operators
+///   and the saturating operators. A checksum of the output is kept so
+///   that the compiler cannot remove the work being measured.
+///
+
+namespace
+{
+    /// @brief defines the total number of values to sum per repetition
+    constexpr bsl::uintmx NUM_VALS{static_cast<bsl::uintmx>(4096)};
+
+    /// @brief stores the values to sum
+    constinit bsl::array<bsl::safe_u32, NUM_VALS> g_mut_vals{};
+
+    /// <!-- description -->
+    ///   @brief Sums the values using raw integers.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the sum of the values
+    ///
+    [[nodiscard]] auto
+    raw_sum() noexcept -> bsl::uint64
+    {
+        bsl::uint64 mut_sum{};
+        for (auto const &elem : g_mut_vals) {
+            mut_sum += static_cast<bsl::uint64>(elem.get());
+        }
+
+        return mut_sum;
+    }
+
+    /// <!-- description -->
+    ///   @brief Sums the values using the checked operators.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the sum of the values
+    ///
+    [[nodiscard]] auto
+    checked_sum() noexcept -> bsl::uint64
+    {
+        bsl::safe_u64 mut_sum{};
+        for (auto const &elem : g_mut_vals) {
+            mut_sum += bsl::safe_u64{static_cast<bsl::uint64>(elem.get())};
+        }
+
+        return mut_sum.checked().get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Sums the values using the saturating operators.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the sum of the values
+    ///
+    [[nodiscard]] auto
+    sat_sum() noexcept -> bsl::uint64
+    {
+        bsl::safe_u64 mut_sum{};
+        for (auto const &elem : g_mut_vals) {
+            mut_sum = mut_sum.sat_add(bsl::safe_u64{static_cast<bsl::uint64>(elem.get())});
+        }
+
+        return mut_sum.checked().get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Benchmarks the provided sum over all of the values.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam FUNC the type of sum to run
+    ///   @param name the name of the benchmark
+    ///   @param func the sum to run
+    ///   @return Returns a checksum of everything that was summed
+    ///
+    template<typename FUNC>
+    [[nodiscard]] auto
+    run(bsl::cstr_type const name, FUNC const &func) noexcept -> bsl::uint64
+    {
+        bsl::uint64 mut_sum{};
+
+        bsl::discard(bsl::bench(name, bsl::safe_umx{NUM_VALS}, [&]() noexcept {
+            mut_sum += func();
+            bsl::bench_keep(mut_sum);
+        }));
+
+        return mut_sum;
+    }
+}
+
+/// <!-- description -->
+///   @brief Runs the safe_integral benchmark.
+///
+/// <!-- inputs/outputs -->
+///   @return Returns bsl::exit_success if every sum produced the same
+///     result, bsl::exit_failure otherwise.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    constexpr bsl::uint32 lcg_mul{static_cast<bsl::uint32>(1664525U)};
+    constexpr bsl::uint32 lcg_inc{static_cast<bsl::uint32>(1013904223U)};
+
+    bsl::uint32 mut_seed{static_cast<bsl::uint32>(42)};
+    for (auto &mut_elem : g_mut_vals) {
+        mut_seed = (mut_seed * lcg_mul) + lcg_inc;
+        mut_elem = bsl::safe_u32{mut_seed};
+    }
+
+    auto const raw{run("safe_integral_sum_raw", &raw_sum)};
+    auto const checked{run("safe_integral_sum_checked", &checked_sum)};
+    auto const sat{run("safe_integral_sum_sat", &sat_sum)};
+
+    if ((raw != checked) || (raw != sat)) {
+        bsl::error() << "sums do not match\n";
+        return bsl::exit_failure;
+    }
+
+    return bsl::exit_success;
+}
@@ -0,0 +1,111 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/bench.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/cstr_type.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/sort.hpp>
+
+/// NOTE:
+/// - Measures bsl::sort and bsl::stable_sort on the same pseudo random
+///   values. Each repetition copies the unsorted values into a scratch
+///   array and sorts the copy, so the copy is part of what is measured.
+///   Both sorts must produce the same order.
+///
+
+namespace
+{
+    /// @brief defines the total number of values to sort per repetition
+    constexpr bsl::uintmx NUM_VALS{static_cast<bsl::uintmx>(4096)};
+
+    /// @brief defines the array type that is sorted
+    using sort_array = bsl::array<bsl::safe_u32, NUM_VALS>;
+
+    /// @brief stores the unsorted values
+    constinit sort_array g_mut_vals{};
+    /// @brief stores the values sorted using bsl::sort
+    constinit sort_array g_mut_sorted{};
+    /// @brief stores the values sorted using bsl::stable_sort
+    constinit sort_array g_mut_stable_sorted{};
+
+    /// <!-- description -->
+    ///   @brief Benchmarks the provided sort.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam FUNC the type of sort to run
+    ///   @param name the name of the benchmark
+    ///   @param mut_out the array to sort the values into
+    ///   @param func the sort to run
+    ///
+    template<typename FUNC>
+    void
+    run(bsl::cstr_type const name, sort_array &mut_out, FUNC const &func) noexcept
+    {
+        bsl::discard(bsl::bench(name, bsl::safe_umx{NUM_VALS}, [&]() noexcept {
+            mut_out = g_mut_vals;
+            func(mut_out);
+            bsl::bench_keep(mut_out);
+        }));
+    }
+}
+
+/// <!-- description -->
+///   @brief Runs the sort benchmark.
+///
+/// <!-- inputs/outputs -->
+///   @return Returns bsl::exit_success if both sorts produced the same
+///     order, bsl::exit_failure otherwise.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    constexpr bsl::uint32 lcg_mul{static_cast<bsl::uint32>(1664525U)};
+    constexpr bsl::uint32 lcg_inc{static_cast<bsl::uint32>(1013904223U)};
+
+    bsl::uint32 mut_seed{static_cast<bsl::uint32>(42)};
+    for (auto &mut_elem : g_mut_vals) {
+        mut_seed = (mut_seed * lcg_mul) + lcg_inc;
+        mut_elem = bsl::safe_u32{mut_seed};
+    }
+
+    run("sort", g_mut_sorted, [](sort_array &mut_arr) noexcept {
+        bsl::sort(mut_arr);
+    });
+
+    run("stable_sort", g_mut_stable_sorted, [](sort_array &mut_arr) noexcept {
+        bsl::stable_sort(mut_arr);
+    });
+
+    if (g_mut_sorted != g_mut_stable_sorted) {
+        bsl::error() << "sorts do not match\n";
+        return bsl::exit_failure;
+    }
+
+    return bsl::exit_success;
+}
@@ -22,3 +22,4 @@
 option(BSL_BUILD_EXAMPLES_OVERRIDE "Prevents the examples from being built when enabled" OFF)
 option(BSL_BUILD_TESTS_OVERRIDE "Prevents the tests from being built when enabled" OFF)
 option(BSL_INCLUDE_INFO_OVERRIDE "Prevents the BSL from creating an info target when enabled" OFF)
+option(BSL_CODEGEN_UPDATE "Rewrites the codegen baseline with the measured counts when enabled" OFF)
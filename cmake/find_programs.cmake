@@ -30,6 +30,10 @@ if(ENABLE_DOXYGEN)
     bf_find_program(BF_DOXYGEN "doxygen" "http://doxygen.nl/")
 endif()
 
+if(BUILD_EXAMPLES AND CMAKE_BUILD_TYPE STREQUAL RELEASE)
+    bf_find_program(BF_OBJDUMP "llvm-objdump" "https://llvm.org/docs/CommandGuide/llvm-objdump.html")
+endif()
+
 if(CMAKE_BUILD_TYPE STREQUAL CLANG_TIDY)
     bf_find_program(CMAKE_C_CLANG_TIDY
         "clang-tidy"
@@ -0,0 +1,46 @@
+#
+# Copyright (C) 2020 Assured Information Security, Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+# Add Benchmark
+#
+# Adds a benchmark given a name. The benchmark is built from NAME.cpp in
+# the current directory, and a benchmark_NAME target is added that runs it.
+# Each of these targets is also added to the "benchmark" target, which runs
+# every benchmark one at a time.
+#
+# NAME: The name of the benchmark to add
+#
+macro(bf_add_benchmark NAME)
+    add_executable(bench_${NAME} ${NAME}.cpp)
+    target_link_libraries(bench_${NAME} PRIVATE bsl_internal)
+    if(WIN32)
+        target_link_libraries(bench_${NAME} PRIVATE libcmt.lib)
+    endif()
+
+    add_custom_target(
+        benchmark_${NAME}
+        COMMAND ${CMAKE_COMMAND} -E chdir ${CMAKE_CURRENT_BINARY_DIR} $<TARGET_FILE:bench_${NAME}>
+        USES_TERMINAL
+        VERBATIM
+    )
+
+    add_dependencies(benchmark benchmark_${NAME})
+endmacro(bf_add_benchmark)
@@ -189,6 +189,13 @@ macro(bf_add_info NAME)
         )
     endif()
 
+    if(BUILD_EXAMPLES)
+        add_custom_command(TARGET info
+            COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   ${BF_BUILD_COMMAND} benchmark                run the project's benchmarks${BF_COLOR_RST}"
+            VERBATIM
+        )
+    endif()
+
     if(ENABLE_CLANG_FORMAT)
         add_custom_command(TARGET info
             COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   ${BF_BUILD_COMMAND} format                   formats the source code${BF_COLOR_RST}"
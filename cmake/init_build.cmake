@@ -26,6 +26,7 @@ include(${CMAKE_CURRENT_LIST_DIR}/config/cmake.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/build_types.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/find_programs.cmake)
 
+include(${CMAKE_CURRENT_LIST_DIR}/targets/benchmark.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/targets/codecov-genhtml.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/targets/codecov-upload-ci.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/targets/codecov-upload.cmake)
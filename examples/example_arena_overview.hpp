@@ -0,0 +1,68 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/arena.hpp>
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/hash.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/unordered_map.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_arena_overview() noexcept
+    {
+        constexpr bsl::uintmx size{static_cast<bsl::uintmx>(1024)};
+        alignas(bsl::uintmx) bsl::array<bsl::uint8, size> mut_buf{};
+        bsl::span<bsl::uint8> mut_view{mut_buf};
+        bsl::arena mut_arena{mut_view};
+
+        {
+            bsl::unordered_map<bsl::uint16, bool, bsl::hash<bsl::uint16>, bsl::arena_allocator>
+                mut_map{bsl::arena_allocator{mut_arena}};
+
+            if (mut_map.try_reserve(16_umx) && mut_map.insert(static_cast<bsl::uint16>(42), true)) {
+                bsl::print() << "success: " << mut_arena.used() << bsl::endl;
+            }
+            else {
+                bsl::error() << "failure\n";
+            }
+        }
+
+        mut_arena.reset();
+        if (mut_arena.used().is_zero()) {
+            bsl::print() << "success\n";
+        }
+        else {
+            bsl::error() << "failure\n";
+        }
+    }
+}
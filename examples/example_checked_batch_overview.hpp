@@ -0,0 +1,57 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/checked_batch.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/span.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_checked_batch_overview() noexcept
+    {
+        constexpr bsl::array<bsl::uint64, 4> lhs{1U, 2U, 3U, 4U};
+        constexpr bsl::array<bsl::uint64, 4> rhs{10U, 20U, 30U, 40U};
+        bsl::array<bsl::uint64, 4> mut_res{};
+
+        bsl::span mut_dst{mut_res};
+        if (bsl::checked_add(mut_dst, bsl::span{lhs}, bsl::span{rhs}) != bsl::errc_success) {
+            bsl::error() << "failure\n";
+            return;
+        }
+
+        auto const sum{bsl::checked_sum(bsl::span{mut_res})};
+        if (sum.is_invalid()) {
+            bsl::error() << "failure\n";
+            return;
+        }
+
+        bsl::print() << "sum: " << sum << bsl::endl;
+    }
+}
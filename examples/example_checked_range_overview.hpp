@@ -0,0 +1,62 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_checked_range_overview() noexcept
+    {
+        constexpr bsl::array lhs{1_u32, 2_u32, 3_u32, 4_u32};
+        constexpr bsl::array rhs{5_u32, 6_u32, 7_u32, 8_u32};
+        bsl::array<bsl::safe_u32, 4> mut_res{};
+
+        bsl::span mut_spn{mut_res};
+        auto mut_dst{mut_spn.unchecked_view()};
+        auto const src1{bsl::span{lhs}.unchecked_view({}, mut_dst.size())};
+        auto const src2{bsl::span{rhs}.unchecked_view({}, mut_dst.size())};
+
+        if ((src1.size() != mut_dst.size()) || (src2.size() != mut_dst.size())) {
+            bsl::error() << "failure\n";
+            return;
+        }
+
+        for (bsl::safe_idx mut_i{}; mut_i < mut_dst.size(); ++mut_i) {
+            mut_dst[mut_i] = (src1[mut_i] + src2[mut_i]).checked();
+        }
+
+        for (auto const &elem : mut_res) {
+            bsl::print() << "element: " << elem << bsl::endl;
+        }
+    }
+}
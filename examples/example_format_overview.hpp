@@ -0,0 +1,51 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/format.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_format_overview() noexcept
+    {
+        constexpr auto val{42_u64};
+        constexpr bsl::cstr_type name{"answer"};
+
+        bsl::println("{} is {} ({:#x})", name, val, val);
+
+        /// NOTE:
+        /// - bsl::format writes the line to any outputter, which is how
+        ///   a whole line can be given to bsl::debug(), bsl::alert() or
+        ///   bsl::error(). The format string is checked at compile-time,
+        ///   so "{} is {}" with only one argument would not compile.
+        ///
+
+        bsl::format(bsl::debug(), "{:>8} = {:08x}", name, val) << bsl::endl;
+    }
+}
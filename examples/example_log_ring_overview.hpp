@@ -0,0 +1,79 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/log_ring.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_log_ring_overview() noexcept
+    {
+        /// NOTE:
+        /// - Output is only written to the log rings when BSL_LOG_RING is
+        ///   defined. Otherwise it is written to the console as usual and
+        ///   there is nothing to drain.
+        /// - The consumer should not use bsl::print() and friends to
+        ///   write out the records it drains, as that would just add
+        ///   more records to its own log ring.
+        ///
+
+        bsl::safe_umx mut_bytes{};
+        auto const records{bsl::log_drain([&mut_bytes](
+                                              bsl::safe_u64 const &seq,
+                                              bsl::safe_umx const &level,
+                                              bsl::string_view const &msg) noexcept {
+            bsl::discard(seq);
+            bsl::discard(level);
+            mut_bytes += msg.size();
+        })};
+
+        if (records.is_zero() || mut_bytes.checked().is_pos()) {
+            bsl::print() << "success\n";
+        }
+        else {
+            bsl::error() << "failure\n";
+        }
+
+        if (bsl::log_dropped().is_zero()) {
+            bsl::print() << "success\n";
+        }
+        else {
+            bsl::error() << "failure\n";
+        }
+
+        if (bsl::log_fallbacks().is_zero()) {
+            bsl::print() << "success\n";
+        }
+        else {
+            bsl::error() << "failure\n";
+        }
+    }
+}
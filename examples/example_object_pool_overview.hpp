@@ -0,0 +1,59 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/object_pool.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_object_pool_overview() noexcept
+    {
+        constexpr bsl::uintmx max_vcpus{static_cast<bsl::uintmx>(2)};
+        bsl::object_pool<bsl::safe_u16, max_vcpus> mut_pool{};
+
+        auto *const pmut_vcpu0{mut_pool.create(1_u16)};
+        auto *const pmut_vcpu1{mut_pool.create(2_u16)};
+
+        if ((nullptr != pmut_vcpu0) && (nullptr != pmut_vcpu1)) {
+            bsl::print() << "success: " << *pmut_vcpu0 << ", " << *pmut_vcpu1 << bsl::endl;
+        }
+        else {
+            bsl::error() << "failure\n";
+        }
+
+        mut_pool.destroy(pmut_vcpu0);
+        if (pmut_vcpu0 == mut_pool.create(3_u16)) {
+            bsl::print() << "success: " << *pmut_vcpu0 << bsl::endl;
+        }
+        else {
+            bsl::error() << "failure\n";
+        }
+    }
+}
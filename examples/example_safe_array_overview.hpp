@@ -0,0 +1,53 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_array.hpp>
+#include <bsl/safe_idx.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_safe_array_overview() noexcept
+    {
+        bsl::safe_array<bsl::uint64, 4> mut_counters{};
+
+        mut_counters.set(0_idx, 42_u64);
+        mut_counters.set(1_idx, bsl::safe_u64::max_value() + 1_u64);
+
+        for (bsl::safe_idx mut_i{}; mut_i < mut_counters.size(); ++mut_i) {
+            auto const counter{mut_counters.get(mut_i)};
+            if (counter.is_invalid()) {
+                bsl::print() << "counter " << mut_i << ": poisoned" << bsl::endl;
+            }
+            else {
+                bsl::print() << "counter " << mut_i << ": " << counter << bsl::endl;
+            }
+        }
+    }
+}
@@ -0,0 +1,51 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/fmt_options.hpp>
+#include <bsl/fmt_spec.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_fmt_spec() noexcept
+    {
+        constexpr bsl::fmt_spec spec{"#018x"};
+        bsl::print() << bsl::fmt{spec, 42_u64} << bsl::endl;
+
+        /// NOTE:
+        /// - A string literal given to bsl::fmt is converted to a
+        ///   bsl::fmt_spec, so it is parsed at compile-time as well. A
+        ///   format string that is only known at runtime has to be parsed
+        ///   using bsl::fmt_options.
+        ///
+
+        bsl::print() << bsl::fmt{"08x", 42_u64} << bsl::endl;
+        bsl::print() << bsl::fmt{bsl::fmt_options{"08x"}, 42_u64} << bsl::endl;
+    }
+}
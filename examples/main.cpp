@@ -77,6 +77,9 @@
 #include "basic_string_view/example_basic_string_view_ends_with.hpp"
 #include "basic_string_view/example_basic_string_view_equals.hpp"
 #include "basic_string_view/example_basic_string_view_find.hpp"
+#include "basic_string_view/example_basic_string_view_find_first_not_of.hpp"
+#include "basic_string_view/example_basic_string_view_find_first_of.hpp"
+#include "basic_string_view/example_basic_string_view_find_last_of.hpp"
 #include "basic_string_view/example_basic_string_view_front_if.hpp"
 #include "basic_string_view/example_basic_string_view_is_invalid.hpp"
 #include "basic_string_view/example_basic_string_view_is_valid.hpp"
@@ -88,6 +91,7 @@
 #include "basic_string_view/example_basic_string_view_remove_prefix.hpp"
 #include "basic_string_view/example_basic_string_view_remove_suffix.hpp"
 #include "basic_string_view/example_basic_string_view_rend.hpp"
+#include "basic_string_view/example_basic_string_view_rfind.hpp"
 #include "basic_string_view/example_basic_string_view_s_assignment.hpp"
 #include "basic_string_view/example_basic_string_view_s_constructor.hpp"
 #include "basic_string_view/example_basic_string_view_s_count_constructor.hpp"
@@ -95,14 +99,20 @@
 #include "basic_string_view/example_basic_string_view_size_bytes.hpp"
 #include "basic_string_view/example_basic_string_view_starts_with.hpp"
 #include "basic_string_view/example_basic_string_view_substr.hpp"
+#include "char_traits/example_char_traits_compare.hpp"
 #include "char_traits/example_char_traits_eof.hpp"
 #include "char_traits/example_char_traits_eq.hpp"
 #include "char_traits/example_char_traits_eq_int_type.hpp"
+#include "char_traits/example_char_traits_find.hpp"
 #include "char_traits/example_char_traits_length.hpp"
 #include "char_traits/example_char_traits_lt.hpp"
 #include "char_traits/example_char_traits_not_eof.hpp"
 #include "char_traits/example_char_traits_to_char_type.hpp"
 #include "char_traits/example_char_traits_to_int_type.hpp"
+#include "checked_range/example_checked_range_data.hpp"
+#include "checked_range/example_checked_range_empty.hpp"
+#include "checked_range/example_checked_range_operator_index.hpp"
+#include "checked_range/example_checked_range_size.hpp"
 #include "contiguous_iterator/example_contiguous_iterator_data.hpp"
 #include "contiguous_iterator/example_contiguous_iterator_decrement.hpp"
 #include "contiguous_iterator/example_contiguous_iterator_empty.hpp"
@@ -144,15 +154,19 @@
 #include "example_addressof_overview.hpp"
 #include "example_alignment_of_overview.hpp"
 #include "example_always_false_overview.hpp"
+#include "example_arena_overview.hpp"
 #include "example_arguments_overview.hpp"
 #include "example_array_overview.hpp"
 #include "example_as_const_overview.hpp"
 #include "example_assert_overview.hpp"
+#include "example_atomic_overview.hpp"
 #include "example_basic_errc_type_overview.hpp"
 #include "example_basic_string_view_overview.hpp"
 #include "example_bool_constant_overview.hpp"
 #include "example_char_traits_overview.hpp"
 #include "example_char_type_overview.hpp"
+#include "example_checked_batch_overview.hpp"
+#include "example_checked_range_overview.hpp"
 #include "example_color_overview.hpp"
 #include "example_common_type_overview.hpp"
 #include "example_conditional_overview.hpp"
@@ -183,9 +197,12 @@
 #include "example_finally_overview.hpp"
 #include "example_fmt_overview.hpp"
 #include "example_forward_overview.hpp"
+#include "example_format_overview.hpp"
 #include "example_from_chars_overview.hpp"
 #include "example_has_unique_object_representations_overview.hpp"
 #include "example_has_virtual_destructor_overview.hpp"
+#include "example_hash_overview.hpp"
+#include "example_heap_allocator_overview.hpp"
 #include "example_index_sequence_for_overview.hpp"
 #include "example_index_sequence_overview.hpp"
 #include "example_integer_sequence_overview.hpp"
@@ -277,18 +294,24 @@
 #include "example_is_unsigned_overview.hpp"
 #include "example_is_void_overview.hpp"
 #include "example_is_volatile_overview.hpp"
+#include "example_lock_guard_overview.hpp"
+#include "example_lock_stats_overview.hpp"
+#include "example_log_ring_overview.hpp"
 #include "example_make_index_sequence_overview.hpp"
 #include "example_make_integer_sequence_overview.hpp"
 #include "example_make_signed_overview.hpp"
 #include "example_make_unsigned_overview.hpp"
 #include "example_max_align_t_overview.hpp"
+#include "example_mcs_lock_overview.hpp"
 #include "example_move_if_noexcept_overview.hpp"
 #include "example_move_overview.hpp"
+#include "example_mpmc_queue_overview.hpp"
 #include "example_negation_overview.hpp"
 #include "example_nonesuch_overview.hpp"
 #include "example_npos_overview.hpp"
 #include "example_nullptr_t_overview.hpp"
 #include "example_numeric_limits_overview.hpp"
+#include "example_object_pool_overview.hpp"
 #include "example_rank_overview.hpp"
 #include "example_readme_overview.hpp"
 #include "example_reference_wrapper_overview.hpp"
@@ -302,13 +325,20 @@
 #include "example_remove_reference_overview.hpp"
 #include "example_remove_volatile_overview.hpp"
 #include "example_reverse_iterator_overview.hpp"
+#include "example_safe_array_overview.hpp"
 #include "example_safe_idx_overview.hpp"
 #include "example_safe_integral_overview.hpp"
+#include "example_safe_span_overview.hpp"
 #include "example_sort_overview.hpp"
 #include "example_source_location_overview.hpp"
 #include "example_span_overview.hpp"
+#include "example_spinlock_overview.hpp"
+#include "example_spsc_queue_overview.hpp"
+#include "example_static_unordered_map_overview.hpp"
+#include "example_static_vector_overview.hpp"
 #include "example_string_view_overview.hpp"
 #include "example_swap_overview.hpp"
+#include "example_ticket_lock_overview.hpp"
 #include "example_touch_overview.hpp"
 #include "example_true_type_for_overview.hpp"
 #include "example_true_type_overview.hpp"
@@ -326,6 +356,7 @@
 #include "fmt/example_fmt_integral.hpp"
 #include "fmt/example_fmt_sign.hpp"
 #include "fmt/example_fmt_sign_aware.hpp"
+#include "fmt/example_fmt_spec.hpp"
 #include "fmt/example_fmt_width.hpp"
 #include "integer_sequence/example_integer_sequence_max.hpp"
 #include "integer_sequence/example_integer_sequence_min.hpp"
@@ -348,6 +379,14 @@
 #include "reverse_iterator/example_reverse_iterator_lt.hpp"
 #include "reverse_iterator/example_reverse_iterator_not_equals.hpp"
 #include "reverse_iterator/example_reverse_iterator_size.hpp"
+#include "safe_array/example_safe_array_data.hpp"
+#include "safe_array/example_safe_array_empty.hpp"
+#include "safe_array/example_safe_array_get.hpp"
+#include "safe_array/example_safe_array_is_any_poisoned.hpp"
+#include "safe_array/example_safe_array_is_poisoned.hpp"
+#include "safe_array/example_safe_array_set.hpp"
+#include "safe_array/example_safe_array_size.hpp"
+#include "safe_array/example_safe_array_size_bytes.hpp"
 #include "safe_idx/example_safe_idx_add.hpp"
 #include "safe_idx/example_safe_idx_assign_add.hpp"
 #include "safe_idx/example_safe_idx_assign_sub.hpp"
@@ -417,9 +456,25 @@
 #include "safe_integral/example_safe_integral_not_equals.hpp"
 #include "safe_integral/example_safe_integral_or.hpp"
 #include "safe_integral/example_safe_integral_rshift.hpp"
+#include "safe_integral/example_safe_integral_sat_add.hpp"
+#include "safe_integral/example_safe_integral_sat_mul.hpp"
+#include "safe_integral/example_safe_integral_sat_sub.hpp"
 #include "safe_integral/example_safe_integral_sub.hpp"
 #include "safe_integral/example_safe_integral_unary.hpp"
+#include "safe_integral/example_safe_integral_wrap_add.hpp"
+#include "safe_integral/example_safe_integral_wrap_mul.hpp"
+#include "safe_integral/example_safe_integral_wrap_sub.hpp"
 #include "safe_integral/example_safe_integral_xor.hpp"
+#include "safe_span/example_safe_span_array_constructor.hpp"
+#include "safe_span/example_safe_span_data.hpp"
+#include "safe_span/example_safe_span_empty.hpp"
+#include "safe_span/example_safe_span_get.hpp"
+#include "safe_span/example_safe_span_is_any_poisoned.hpp"
+#include "safe_span/example_safe_span_is_poisoned.hpp"
+#include "safe_span/example_safe_span_set.hpp"
+#include "safe_span/example_safe_span_size.hpp"
+#include "safe_span/example_safe_span_size_bytes.hpp"
+#include "safe_span/example_safe_span_subspan.hpp"
 #include "source_location/example_source_location_current.hpp"
 #include "source_location/example_source_location_default_constructor.hpp"
 #include "source_location/example_source_location_file_name.hpp"
@@ -450,6 +505,7 @@
 #include "span/example_span_size.hpp"
 #include "span/example_span_size_bytes.hpp"
 #include "span/example_span_subspan.hpp"
+#include "span/example_span_unchecked_view.hpp"
 
 #include <bsl/cstdint.hpp>
 #include <bsl/cstr_type.hpp>
@@ -502,6 +558,7 @@ main(bsl::int32 const argc, bsl::cstr_type const *const argv) noexcept -> bsl::e
     example(&bsl::example_addressof_overview, "example_addressof_overview");
     example(&bsl::example_alignment_of_overview, "example_alignment_of_overview");
     example(&bsl::example_always_false_overview, "example_always_false_overview");
+    example(&bsl::example_arena_overview, "example_arena_overview");
     example(&bsl::example_arguments_overview, "example_arguments_overview");
     example(&bsl::example_arguments_args, "example_arguments_args");
     example(&bsl::example_arguments_at, "example_arguments_at");
@@ -537,6 +594,7 @@ main(bsl::int32 const argc, bsl::cstr_type const *const argv) noexcept -> bsl::e
     example(&bsl::example_array_size, "example_array_size");
     example(&bsl::example_as_const_overview, "example_as_const_overview");
     example(&bsl::example_assert_overview, "example_assert_overview");
+    example(&bsl::example_atomic_overview, "example_atomic_overview");
     example(&bsl::example_basic_errc_type_overview, "example_basic_errc_type_overview");
     example(&bsl::example_basic_errc_type_constructor_t_safe_int, "example_basic_errc_type_constructor_t_safe_int");
     example(&bsl::example_basic_errc_type_constructor_t, "example_basic_errc_type_constructor_t");
@@ -558,6 +616,9 @@ main(bsl::int32 const argc, bsl::cstr_type const *const argv) noexcept -> bsl::e
     example(&bsl::example_basic_string_view_ends_with, "example_basic_string_view_ends_with");
     example(&bsl::example_basic_string_view_equals, "example_basic_string_view_equals");
     example(&bsl::example_basic_string_view_find, "example_basic_string_view_find");
+    example(&bsl::example_basic_string_view_find_first_not_of, "example_basic_string_view_find_first_not_of");
+    example(&bsl::example_basic_string_view_find_first_of, "example_basic_string_view_find_first_of");
+    example(&bsl::example_basic_string_view_find_last_of, "example_basic_string_view_find_last_of");
     example(&bsl::example_basic_string_view_front_if, "example_basic_string_view_front_if");
     example(&bsl::example_basic_string_view_is_invalid, "example_basic_string_view_is_invalid");
     example(&bsl::example_basic_string_view_is_valid, "example_basic_string_view_is_valid");
@@ -569,6 +630,7 @@ main(bsl::int32 const argc, bsl::cstr_type const *const argv) noexcept -> bsl::e
     example(&bsl::example_basic_string_view_remove_prefix, "example_basic_string_view_remove_prefix");
     example(&bsl::example_basic_string_view_remove_suffix, "example_basic_string_view_remove_suffix");
     example(&bsl::example_basic_string_view_rend, "example_basic_string_view_rend");
+    example(&bsl::example_basic_string_view_rfind, "example_basic_string_view_rfind");
     example(&bsl::example_basic_string_view_s_assignment, "example_basic_string_view_s_assignment");
     example(&bsl::example_basic_string_view_s_constructor, "example_basic_string_view_s_constructor");
     example(&bsl::example_basic_string_view_s_count_constructor, "example_basic_string_view_s_count_constructor");
@@ -578,15 +640,23 @@ main(bsl::int32 const argc, bsl::cstr_type const *const argv) noexcept -> bsl::e
     example(&bsl::example_basic_string_view_substr, "example_basic_string_view_substr");
     example(&bsl::example_bool_constant_overview, "example_bool_constant_overview");
     example(&bsl::example_char_traits_overview, "example_char_traits_overview");
+    example(&bsl::example_char_traits_compare, "example_char_traits_compare");
     example(&bsl::example_char_traits_eof, "example_char_traits_eof");
     example(&bsl::example_char_traits_eq_int_type, "example_char_traits_eq_int_type");
     example(&bsl::example_char_traits_eq, "example_char_traits_eq");
+    example(&bsl::example_char_traits_find, "example_char_traits_find");
     example(&bsl::example_char_traits_length, "example_char_traits_length");
     example(&bsl::example_char_traits_lt, "example_char_traits_lt");
     example(&bsl::example_char_traits_not_eof, "example_char_traits_not_eof");
     example(&bsl::example_char_traits_to_char_type, "example_char_traits_to_char_type");
     example(&bsl::example_char_traits_to_int_type, "example_char_traits_to_int_type");
     example(&bsl::example_char_type_overview, "example_char_type_overview");
+    example(&bsl::example_checked_batch_overview, "example_checked_batch_overview");
+    example(&bsl::example_checked_range_data, "example_checked_range_data");
+    example(&bsl::example_checked_range_empty, "example_checked_range_empty");
+    example(&bsl::example_checked_range_operator_index, "example_checked_range_operator_index");
+    example(&bsl::example_checked_range_overview, "example_checked_range_overview");
+    example(&bsl::example_checked_range_size, "example_checked_range_size");
     example(&bsl::example_color_overview, "example_color_overview");
     example(&bsl::example_common_type_overview, "example_common_type_overview");
     example(&bsl::example_conditional_overview, "example_conditional_overview");
@@ -662,11 +732,15 @@ main(bsl::int32 const argc, bsl::cstr_type const *const argv) noexcept -> bsl::e
     example(&bsl::example_fmt_integral, "example_fmt_integral");
     example(&bsl::example_fmt_sign_aware, "example_fmt_sign_aware");
     example(&bsl::example_fmt_sign, "example_fmt_sign");
+    example(&bsl::example_fmt_spec, "example_fmt_spec");
     example(&bsl::example_fmt_width, "example_fmt_width");
     example(&bsl::example_forward_overview, "example_forward_overview");
+    example(&bsl::example_format_overview, "example_format_overview");
     example(&bsl::example_from_chars_overview, "example_from_chars_overview");
     example(&bsl::example_has_unique_object_representations_overview, "example_has_unique_object_representations_overview");
     example(&bsl::example_has_virtual_destructor_overview, "example_has_virtual_destructor_overview");
+    example(&bsl::example_hash_overview, "example_hash_overview");
+    example(&bsl::example_heap_allocator_overview, "example_heap_allocator_overview");
     example(&bsl::example_index_sequence_for_overview, "example_index_sequence_for_overview");
     example(&bsl::example_index_sequence_overview, "example_index_sequence_overview");
     example(&bsl::example_integer_sequence_overview, "example_integer_sequence_overview");
@@ -761,18 +835,24 @@ main(bsl::int32 const argc, bsl::cstr_type const *const argv) noexcept -> bsl::e
     example(&bsl::example_is_union_overview, "example_is_union_overview");
     example(&bsl::example_is_void_overview, "example_is_void_overview");
     example(&bsl::example_is_volatile_overview, "example_is_volatile_overview");
+    example(&bsl::example_lock_guard_overview, "example_lock_guard_overview");
+    example(&bsl::example_lock_stats_overview, "example_lock_stats_overview");
+    example(&bsl::example_log_ring_overview, "example_log_ring_overview");
     example(&bsl::example_make_index_sequence_overview, "example_make_index_sequence_overview");
     example(&bsl::example_make_integer_sequence_overview, "example_make_integer_sequence_overview");
     example(&bsl::example_make_signed_overview, "example_make_signed_overview");
     example(&bsl::example_make_unsigned_overview, "example_make_unsigned_overview");
     example(&bsl::example_max_align_t_overview, "example_max_align_t_overview");
+    example(&bsl::example_mcs_lock_overview, "example_mcs_lock_overview");
     example(&bsl::example_move_if_noexcept_overview, "example_move_if_noexcept_overview");
     example(&bsl::example_move_overview, "example_move_overview");
+    example(&bsl::example_mpmc_queue_overview, "example_mpmc_queue_overview");
     example(&bsl::example_negation_overview, "example_negation_overview");
     example(&bsl::example_nonesuch_overview, "example_nonesuch_overview");
     example(&bsl::example_npos_overview, "example_npos_overview");
     example(&bsl::example_nullptr_t_overview, "example_nullptr_t_overview");
     example(&bsl::example_numeric_limits_overview, "example_numeric_limits_overview");
+    example(&bsl::example_object_pool_overview, "example_object_pool_overview");
     example(&bsl::example_rank_overview, "example_rank_overview");
     example(&bsl::example_reference_wrapper_overview, "example_reference_wrapper_overview");
     example(&bsl::example_reference_wrapper_constructor, "example_reference_wrapper_constructor");
@@ -803,6 +883,15 @@ main(bsl::int32 const argc, bsl::cstr_type const *const argv) noexcept -> bsl::e
     example(&bsl::example_reverse_iterator_lt, "example_reverse_iterator_lt");
     example(&bsl::example_reverse_iterator_not_equals, "example_reverse_iterator_not_equals");
     example(&bsl::example_reverse_iterator_size, "example_reverse_iterator_size");
+    example(&bsl::example_safe_array_overview, "example_safe_array_overview");
+    example(&bsl::example_safe_array_data, "example_safe_array_data");
+    example(&bsl::example_safe_array_empty, "example_safe_array_empty");
+    example(&bsl::example_safe_array_get, "example_safe_array_get");
+    example(&bsl::example_safe_array_is_any_poisoned, "example_safe_array_is_any_poisoned");
+    example(&bsl::example_safe_array_is_poisoned, "example_safe_array_is_poisoned");
+    example(&bsl::example_safe_array_set, "example_safe_array_set");
+    example(&bsl::example_safe_array_size, "example_safe_array_size");
+    example(&bsl::example_safe_array_size_bytes, "example_safe_array_size_bytes");
     example(&bsl::example_safe_idx_overview, "example_safe_idx_overview");
     example(&bsl::example_safe_idx_add, "example_safe_idx_add");
     example(&bsl::example_safe_idx_assign_add, "example_safe_idx_assign_add");
@@ -874,9 +963,26 @@ main(bsl::int32 const argc, bsl::cstr_type const *const argv) noexcept -> bsl::e
     example(&bsl::example_safe_integral_not_equals, "example_safe_integral_not_equals");
     example(&bsl::example_safe_integral_or, "example_safe_integral_or");
     example(&bsl::example_safe_integral_rshift, "example_safe_integral_rshift");
+    example(&bsl::example_safe_integral_sat_add, "example_safe_integral_sat_add");
+    example(&bsl::example_safe_integral_sat_mul, "example_safe_integral_sat_mul");
+    example(&bsl::example_safe_integral_sat_sub, "example_safe_integral_sat_sub");
     example(&bsl::example_safe_integral_sub, "example_safe_integral_sub");
     example(&bsl::example_safe_integral_unary, "example_safe_integral_unary");
+    example(&bsl::example_safe_integral_wrap_add, "example_safe_integral_wrap_add");
+    example(&bsl::example_safe_integral_wrap_mul, "example_safe_integral_wrap_mul");
+    example(&bsl::example_safe_integral_wrap_sub, "example_safe_integral_wrap_sub");
     example(&bsl::example_safe_integral_xor, "example_safe_integral_xor");
+    example(&bsl::example_safe_span_overview, "example_safe_span_overview");
+    example(&bsl::example_safe_span_array_constructor, "example_safe_span_array_constructor");
+    example(&bsl::example_safe_span_data, "example_safe_span_data");
+    example(&bsl::example_safe_span_empty, "example_safe_span_empty");
+    example(&bsl::example_safe_span_get, "example_safe_span_get");
+    example(&bsl::example_safe_span_is_any_poisoned, "example_safe_span_is_any_poisoned");
+    example(&bsl::example_safe_span_is_poisoned, "example_safe_span_is_poisoned");
+    example(&bsl::example_safe_span_set, "example_safe_span_set");
+    example(&bsl::example_safe_span_size, "example_safe_span_size");
+    example(&bsl::example_safe_span_size_bytes, "example_safe_span_size_bytes");
+    example(&bsl::example_safe_span_subspan, "example_safe_span_subspan");
     example(&bsl::example_sort_overview, "example_sort_overview");
     example(&bsl::example_source_location_overview, "example_source_location_overview");
     example(&bsl::example_source_location_current, "example_source_location_current");
@@ -910,8 +1016,14 @@ main(bsl::int32 const argc, bsl::cstr_type const *const argv) noexcept -> bsl::e
     example(&bsl::example_span_size_bytes, "example_span_size_bytes");
     example(&bsl::example_span_size, "example_span_size");
     example(&bsl::example_span_subspan, "example_span_subspan");
+    example(&bsl::example_span_unchecked_view, "example_span_unchecked_view");
+    example(&bsl::example_spinlock_overview, "example_spinlock_overview");
+    example(&bsl::example_spsc_queue_overview, "example_spsc_queue_overview");
+    example(&bsl::example_static_unordered_map_overview, "example_static_unordered_map_overview");
+    example(&bsl::example_static_vector_overview, "example_static_vector_overview");
     example(&bsl::example_string_view_overview, "example_string_view_overview");
     example(&bsl::example_swap_overview, "example_swap_overview");
+    example(&bsl::example_ticket_lock_overview, "example_ticket_lock_overview");
     example(&bsl::example_touch_overview, "example_touch_overview");
     example(&bsl::example_true_type_for_overview, "example_true_type_for_overview");
     example(&bsl::example_true_type_overview, "example_true_type_overview");
@@ -0,0 +1,375 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file arena.hpp
+///
+
+#ifndef BSL_ARENA_HPP
+#define BSL_ARENA_HPP
+
+#include "bsl/construct_at.hpp"
+#include "bsl/cstdint.hpp"
+#include "bsl/cstring.hpp"
+#include "bsl/destroy_at.hpp"
+#include "bsl/discard.hpp"
+#include "bsl/ensures.hpp"
+#include "bsl/expects.hpp"
+#include "bsl/is_trivial.hpp"
+#include "bsl/is_trivially_destructible.hpp"
+#include "bsl/safe_idx.hpp"
+#include "bsl/safe_integral.hpp"
+#include "bsl/span.hpp"
+#include "bsl/unlikely.hpp"
+
+namespace bsl
+{
+    /// @class bsl::arena
+    ///
+    /// <!-- description -->
+    ///   @brief Implements a bump allocator over a caller provided buffer.
+    ///     Each allocation is carved from the front of the remaining
+    ///     buffer (after padding it to the requested alignment), so an
+    ///     allocation is a handful of instructions, and never touches the
+    ///     global heap. Individual allocations are never given back.
+    ///     Instead, reset() releases everything that was allocated from
+    ///     the arena at once, in O(1). If the arena does not have enough
+    ///     room left, a nullptr is returned. The arena does not own the
+    ///     buffer, which must outlive the arena and anything allocated
+    ///     from it. To give an arena to a container, wrap it in a
+    ///     bsl::arena_allocator.
+    ///   @include example_arena_overview.hpp
+    ///
+    class arena final
+    {
+        /// @brief stores a pointer to the start of the buffer
+        bsl::uint8 *m_base{};
+        /// @brief stores the total number of bytes in the buffer
+        safe_umx m_capacity{};
+        /// @brief stores the number of bytes that have been handed out
+        safe_umx m_used{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a bsl::arena that allocates from the provided
+        ///     buffer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_buf the buffer to allocate from. Must outlive the
+        ///     arena
+        ///
+        explicit arena(span<bsl::uint8> &mut_buf) noexcept    // --
+            : m_base{mut_buf.data()}, m_capacity{mut_buf.size()}
+        {
+            expects(nullptr != m_base);
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::arena. Since the
+        ///     arena does not own the buffer, this does nothing.
+        ///
+        constexpr ~arena() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr arena(arena const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr arena(arena &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(arena const &o) &noexcept -> arena & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(arena &&mut_o) &noexcept -> arena & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to size bytes of uninitialized memory
+        ///     that is aligned to align. If the arena does not have enough
+        ///     room left, a nullptr is returned and the arena is left
+        ///     unchanged.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param size the number of bytes to allocate. Cannot be 0
+        ///   @param align the alignment of the allocation. Must be a power
+        ///     of 2
+        ///   @return Returns a pointer to size bytes of uninitialized
+        ///     memory, or a nullptr if the arena is out of room.
+        ///
+        [[nodiscard]] auto
+        allocate_bytes(safe_umx const &size, safe_umx const &align) noexcept -> void *
+        {
+            expects(size.is_valid_and_checked());
+            expects(size.is_pos());
+            expects(align.is_valid_and_checked());
+            expects(align.is_pos());
+            expects(((align - safe_umx::magic_1()) & align).checked().is_zero());
+
+            /// NOTE:
+            /// - The address math below cannot overflow as m_used is never
+            ///   larger than the buffer, and the padding is always smaller
+            ///   than align. A size that is too large is caught by the
+            ///   check on mut_end, which is poisoned on overflow.
+            ///
+
+            auto const mask{(align - safe_umx::magic_1()).checked()};
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            safe_umx const addr{reinterpret_cast<bsl::uintmx>(m_base) + m_used.get()};
+            auto const pad{((align - (addr & mask)) & mask).checked()};
+
+            auto const start{(m_used + pad).checked()};
+            auto const end{start + size};
+            if (unlikely(end.is_invalid())) {
+                return nullptr;
+            }
+
+            if (unlikely(end.checked() > m_capacity)) {
+                return nullptr;
+            }
+
+            m_used = end.checked();
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return m_base + start.get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to an array of count value
+        ///     initialized U's, or a nullptr if the arena is out of room.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U the type of element to allocate
+        ///   @param count the number of elements to allocate. Cannot be 0
+        ///   @return Returns a pointer to an array of count value
+        ///     initialized U's, or a nullptr if the arena is out of room.
+        ///
+        template<typename U>
+        [[nodiscard]] auto
+        allocate(safe_umx const &count) noexcept -> U *
+        {
+            expects(count.is_valid_and_checked());
+            expects(count.is_pos());
+
+            auto const size{count * safe_umx{sizeof(U)}};
+            if (unlikely(size.is_invalid())) {
+                return nullptr;
+            }
+
+            auto *const pmut_mem{this->allocate_bytes(size.checked(), safe_umx{alignof(U)})};
+            if (unlikely(nullptr == pmut_mem)) {
+                return nullptr;
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto *const pmut_arr{reinterpret_cast<U *>(pmut_mem)};
+            if constexpr (is_trivial<U>::value) {
+                bsl::discard(bsl::builtin_memset(pmut_arr, '\0', size.checked()));
+            }
+            else {
+                for (safe_idx mut_i{}; mut_i < count; ++mut_i) {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    bsl::discard(bsl::construct_at<U>(pmut_arr + mut_i.get()));
+                }
+            }
+
+            return pmut_arr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroys an array that was returned by
+        ///     allocate<U>(count). The memory itself is not given back to
+        ///     the arena until reset() is called, which means that for a
+        ///     trivially destructible U, this does nothing at all.
+        ///     Passing a nullptr does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U the type of element to deallocate
+        ///   @param pmut_ptr a pointer to the array to deallocate
+        ///   @param count the number of elements in the array
+        ///
+        template<typename U>
+        constexpr void
+        deallocate(U *const pmut_ptr, safe_umx const &count) const noexcept
+        {
+            if constexpr (!is_trivially_destructible<U>::value) {
+                if (nullptr == pmut_ptr) {
+                    return;
+                }
+
+                for (safe_idx mut_i{}; mut_i < count; ++mut_i) {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    bsl::destroy_at(pmut_ptr + mut_i.get());
+                }
+            }
+            else {
+                bsl::discard(pmut_ptr);
+                bsl::discard(count);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases everything that was allocated from the arena
+        ///     in O(1). Nothing is destroyed, so any object that is still
+        ///     using memory from the arena must be destroyed first.
+        ///
+        constexpr void
+        reset() noexcept
+        {
+            m_used = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of bytes in the arena's buffer
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of bytes in the arena's buffer
+        ///
+        [[nodiscard]] constexpr auto
+        capacity() const noexcept -> safe_umx const &
+        {
+            ensures(m_capacity.is_valid_and_checked());
+            return m_capacity;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes that have been allocated
+        ///     (including alignment padding) since the last reset()
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of bytes that have been allocated
+        ///     (including alignment padding) since the last reset()
+        ///
+        [[nodiscard]] constexpr auto
+        used() const noexcept -> safe_umx const &
+        {
+            ensures(m_used.is_valid_and_checked());
+            return m_used;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes that are left in the arena
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of bytes that are left in the arena
+        ///
+        [[nodiscard]] constexpr auto
+        remaining() const noexcept -> safe_umx
+        {
+            /// NOTE:
+            /// - m_used is never larger than m_capacity, so this cannot
+            ///   underflow.
+            ///
+
+            return (m_capacity - m_used).checked();
+        }
+    };
+
+    /// @class bsl::arena_allocator
+    ///
+    /// <!-- description -->
+    ///   @brief Adapts a bsl::arena to the allocator interface used by the
+    ///     BSL's containers (see bsl::heap_allocator). The allocator only
+    ///     stores a pointer to the arena, so it can be copied freely, and
+    ///     every copy allocates from the same arena. A container that uses
+    ///     a bsl::arena_allocator never touches the global heap, and since
+    ///     deallocate() does not give memory back, everything the
+    ///     container ever allocated is released at once by calling
+    ///     reset() on the arena (once the container has been destroyed).
+    ///   @include example_arena_overview.hpp
+    ///
+    class arena_allocator final
+    {
+        /// @brief stores a pointer to the arena to allocate from
+        arena *m_arena;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a bsl::arena_allocator that allocates from the
+        ///     provided arena.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_arena the arena to allocate from
+        ///
+        explicit constexpr arena_allocator(arena &mut_arena) noexcept    // --
+            : m_arena{&mut_arena}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to an array of count value
+        ///     initialized U's, or a nullptr if the arena is out of room.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U the type of element to allocate
+        ///   @param count the number of elements to allocate. Cannot be 0
+        ///   @return Returns a pointer to an array of count value
+        ///     initialized U's, or a nullptr if the arena is out of room.
+        ///
+        template<typename U>
+        [[nodiscard]] auto
+        allocate(safe_umx const &count) const noexcept -> U *
+        {
+            return m_arena->allocate<U>(count);
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroys an array that was returned by
+        ///     allocate<U>(count). See bsl::arena::deallocate for more
+        ///     information.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U the type of element to deallocate
+        ///   @param pmut_ptr a pointer to the array to deallocate
+        ///   @param count the number of elements in the array
+        ///
+        template<typename U>
+        constexpr void
+        deallocate(U *const pmut_ptr, safe_umx const &count) const noexcept
+        {
+            m_arena->deallocate<U>(pmut_ptr, count);
+        }
+    };
+}
+
+#endif
@@ -28,10 +28,13 @@
 #include "bsl/char_type.hpp"
 #include "bsl/cstdint.hpp"
 #include "bsl/cstr_type.hpp"
+#include "bsl/details/out_buffer.hpp"
 #include "bsl/details/out_char.hpp"
 #include "bsl/details/out_cstr.hpp"
 #include "bsl/details/out_line.hpp"
+#include "bsl/details/strlen_by_word.hpp"
 #include "bsl/discard.hpp"
+#include "bsl/is_constant_evaluated.hpp"
 #include "bsl/source_location.hpp"
 #include "bsl/touch.hpp"
 
@@ -111,12 +114,16 @@ namespace bsl
         [[nodiscard]] constexpr auto
         assert_strlen(cstr_type const str) noexcept -> bsl::uintmx
         {
-            bsl::uintmx mut_len{};
-            while ('\0' != str[mut_len]) {
-                ++mut_len;
+            if (is_constant_evaluated()) {
+                bsl::uintmx mut_len{};
+                while ('\0' != str[mut_len]) {
+                    ++mut_len;
+                }
+
+                return mut_len;
             }
 
-            return mut_len;
+            return strlen_by_word(str);
         }
     }
 
@@ -157,6 +164,10 @@ namespace bsl
         else {
             assert_contract_violation();
             if (nullptr != str) {
+                if constexpr (details::OUT_BUFFER_ENABLED) {
+                    details::out_buffer_this_thread()->flush();
+                }
+
                 if constexpr (ENABLE_COLOR) {
                     details::out_cstr("\033[1;91m", details::assert_strlen("\033[1;91m"));
                 }
@@ -0,0 +1,652 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file atomic.hpp
+///
+
+#ifndef BSL_ATOMIC_HPP
+#define BSL_ATOMIC_HPP
+
+#include "bsl/cstdint.hpp"
+#include "bsl/expects.hpp"
+#include "bsl/integer.hpp"
+#include "bsl/is_integral.hpp"
+#include "bsl/is_same.hpp"
+#include "bsl/is_unsigned.hpp"
+#include "bsl/memory_order.hpp"
+#include "bsl/safe_integral.hpp"
+#include "bsl/touch.hpp"
+#include "bsl/unlikely.hpp"
+
+namespace bsl
+{
+    template<typename T>
+    class atomic;
+
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Returns the address of the value stored in a
+        ///     bsl::atomic. This is only needed by atomic_wait() and
+        ///     atomic_notify_xxx(), which live in bsl/atomic_wait.hpp
+        ///     (as they are not freestanding) and hand the address to the
+        ///     platform's wait/wake API.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of integral stored by the atomic
+        ///   @param atm the atomic to get the address of
+        ///   @return Returns the address of the value stored in atm
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto atomic_addr(atomic<T> const &atm) noexcept -> T const *;
+    }
+
+    /// @class bsl::atomic
+    ///
+    /// <!-- description -->
+    ///   @brief Stores an integral that can be read and written by more
+    ///     than one thread (or vCPU) at the same time, without a lock.
+    ///     Values go in and come out as bsl::safe_integral. fetch_add()
+    ///     and fetch_sub() are checked. If the result would overflow,
+    ///     the atomic is left as is and a poisoned safe_integral is
+    ///     returned, so a shared counter keeps the same guarantees as a
+    ///     local one. If wrapping (or saturating) is what you want, use
+    ///     the fetch_wrap_xxx() (or fetch_sat_xxx()) functions instead,
+    ///     just like safe_integral's wrap_xxx() and sat_xxx(). Each
+    ///     operation takes a bsl::memory_order, which defaults to
+    ///     memory_order_seq_cst.
+    ///   @include example_atomic_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of integral to store
+    ///
+    template<typename T>
+    class atomic final
+    {
+        static_assert(bsl::is_integral<T>::value, "only integral types are supported");
+        static_assert(!bsl::is_same<T, bool>::value, "bool is not supported");
+        static_assert(__atomic_always_lock_free(sizeof(T), 0), "T must be lock-free");
+
+        /// @brief stores the value of the atomic
+        alignas(sizeof(T)) T m_val{};
+
+        /// @brief details::atomic_addr() needs the address of m_val
+        friend constexpr auto details::atomic_addr<T>(atomic<T> const &atm) noexcept -> T const *;
+
+        /// <!-- description -->
+        ///   @brief Returns true if order can be used by an operation that
+        ///     only loads (i.e., it is not memory_order_release or
+        ///     memory_order_acq_rel).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param order the memory order to check
+        ///   @return Returns true if order can be used by a load
+        ///
+        [[nodiscard]] static constexpr auto
+        is_load_order(memory_order const order) noexcept -> bool
+        {
+            switch (order) {
+                case memory_order::memory_order_relaxed:
+                    [[fallthrough]];
+                case memory_order::memory_order_acquire:
+                    [[fallthrough]];
+                case memory_order::memory_order_seq_cst: {
+                    return true;
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if order can be used by an operation that
+        ///     only stores (i.e., it is not memory_order_acquire or
+        ///     memory_order_acq_rel).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param order the memory order to check
+        ///   @return Returns true if order can be used by a store
+        ///
+        [[nodiscard]] static constexpr auto
+        is_store_order(memory_order const order) noexcept -> bool
+        {
+            switch (order) {
+                case memory_order::memory_order_relaxed:
+                    [[fallthrough]];
+                case memory_order::memory_order_release:
+                    [[fallthrough]];
+                case memory_order::memory_order_seq_cst: {
+                    return true;
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the memory order a compare exchange should
+        ///     use when it fails, given the order it uses when it
+        ///     succeeds. A failed compare exchange is only a load, so it
+        ///     cannot have release semantics.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param order the memory order used on success
+        ///   @return Returns the memory order to use on failure
+        ///
+        [[nodiscard]] static constexpr auto
+        failure_order(memory_order const order) noexcept -> bsl::int32
+        {
+            if (memory_order::memory_order_release == order) {
+                return __ATOMIC_RELAXED;
+            }
+
+            if (memory_order::memory_order_acq_rel == order) {
+                return __ATOMIC_ACQUIRE;
+            }
+
+            return static_cast<bsl::int32>(order);
+        }
+
+        /// <!-- description -->
+        ///   @brief Replaces the value of the atomic with op(old, val)
+        ///     using a compare exchange loop, where old is the value of
+        ///     the atomic before it was replaced. If op() returns true,
+        ///     the result overflowed, and the atomic is left as is.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam OP the type of operation to perform
+        ///   @param val the value to pass to op()
+        ///   @param order the memory order to use
+        ///   @param op the operation to perform
+        ///   @return Returns the value of the atomic before it was
+        ///     replaced, or bsl::safe_integral<T>::failure() if op()
+        ///     overflowed.
+        ///
+        template<typename OP>
+        [[nodiscard]] auto
+        fetch_op(safe_integral<T> const &val, memory_order const order, OP &&op) noexcept
+            -> safe_integral<T>
+        {
+            expects(val.is_valid_and_checked());
+
+            auto const success{static_cast<bsl::int32>(order)};
+            auto const failure{failure_order(order)};
+
+            T mut_old{__atomic_load_n(&m_val, failure)};
+            T mut_new{};
+
+            do {
+                if (unlikely(op(mut_old, val.get(), &mut_new))) {
+                    return safe_integral<T>::failure();
+                }
+            } while (!__atomic_compare_exchange_n(
+                &m_val, &mut_old, mut_new, true, success, failure));
+
+            return safe_integral<T>{mut_old};
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets *pmut_res to builtin_add_sat(lhs, rhs). Used by
+        ///     fetch_sat_add(), which can never overflow.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @param pmut_res the (saturated) result of the operation
+        ///   @return Always returns false
+        ///
+        [[nodiscard]] static constexpr auto
+        sat_add_op(T const lhs, T const rhs, T *const pmut_res) noexcept -> bool
+        {
+            *pmut_res = builtin_add_sat(lhs, rhs);
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets *pmut_res to builtin_sub_sat(lhs, rhs). Used by
+        ///     fetch_sat_sub(), which can never overflow.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @param pmut_res the (saturated) result of the operation
+        ///   @return Always returns false
+        ///
+        [[nodiscard]] static constexpr auto
+        sat_sub_op(T const lhs, T const rhs, T *const pmut_res) noexcept -> bool
+        {
+            *pmut_res = builtin_sub_sat(lhs, rhs);
+            return false;
+        }
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::atomic with a value of 0.
+        ///
+        constexpr atomic() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::atomic with a value of val.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to set the bsl::atomic to
+        ///
+        explicit constexpr atomic(safe_integral<T> const &val) noexcept    // --
+        {
+            expects(val.is_valid_and_checked());
+            m_val = val.get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::atomic
+        ///
+        constexpr ~atomic() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr atomic(atomic const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr atomic(atomic &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(atomic const &o) &noexcept -> atomic & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(atomic &&mut_o) &noexcept -> atomic & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns the value of the atomic. order must not be
+        ///     memory_order_release or memory_order_acq_rel.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param order the memory order to use
+        ///   @return Returns the value of the atomic
+        ///
+        [[nodiscard]] auto
+        load(memory_order const order = memory_order::memory_order_seq_cst) const noexcept
+            -> safe_integral<T>
+        {
+            expects(is_load_order(order));
+            return safe_integral<T>{__atomic_load_n(&m_val, static_cast<bsl::int32>(order))};
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of the atomic to val. order must not
+        ///     be memory_order_acquire or memory_order_acq_rel.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to set the atomic to
+        ///   @param order the memory order to use
+        ///
+        void
+        store(
+            safe_integral<T> const &val,
+            memory_order const order = memory_order::memory_order_seq_cst) noexcept
+        {
+            expects(val.is_valid_and_checked());
+            expects(is_store_order(order));
+            __atomic_store_n(&m_val, val.get(), static_cast<bsl::int32>(order));
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of the atomic to val and returns the
+        ///     value it had before.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to set the atomic to
+        ///   @param order the memory order to use
+        ///   @return Returns the value of the atomic before it was set
+        ///
+        [[nodiscard]] auto
+        exchange(
+            safe_integral<T> const &val,
+            memory_order const order = memory_order::memory_order_seq_cst) noexcept
+            -> safe_integral<T>
+        {
+            expects(val.is_valid_and_checked());
+            auto const old{__atomic_exchange_n(&m_val, val.get(), static_cast<bsl::int32>(order))};
+            return safe_integral<T>{old};
+        }
+
+        /// <!-- description -->
+        ///   @brief If the value of the atomic equals mut_expected, it
+        ///     is set to desired and true is returned. Otherwise,
+        ///     mut_expected is set to the value of the atomic and false
+        ///     is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_expected the value the atomic is expected to have
+        ///   @param desired the value to set the atomic to
+        ///   @param order the memory order to use on success. On failure,
+        ///     the same order is used, minus any release semantics.
+        ///   @return Returns true if the atomic was set to desired,
+        ///     false otherwise.
+        ///
+        [[nodiscard]] auto
+        compare_exchange(
+            safe_integral<T> &mut_expected,
+            safe_integral<T> const &desired,
+            memory_order const order = memory_order::memory_order_seq_cst) noexcept -> bool
+        {
+            expects(mut_expected.is_valid_and_checked());
+            expects(desired.is_valid_and_checked());
+
+            T mut_old{mut_expected.get()};
+            bool const exchanged{__atomic_compare_exchange_n(
+                &m_val,
+                &mut_old,
+                desired.get(),
+                false,
+                static_cast<bsl::int32>(order),
+                failure_order(order))};
+
+            if (!exchanged) {
+                mut_expected = safe_integral<T>{mut_old};
+            }
+            else {
+                bsl::touch();
+            }
+
+            return exchanged;
+        }
+
+        /// <!-- description -->
+        ///   @brief Same as compare_exchange(), except that it is allowed
+        ///     to fail even if the value of the atomic equals
+        ///     mut_expected. This is faster on some architectures when
+        ///     it is called in a loop.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_expected the value the atomic is expected to have
+        ///   @param desired the value to set the atomic to
+        ///   @param order the memory order to use on success. On failure,
+        ///     the same order is used, minus any release semantics.
+        ///   @return Returns true if the atomic was set to desired,
+        ///     false otherwise.
+        ///
+        [[nodiscard]] auto
+        compare_exchange_weak(
+            safe_integral<T> &mut_expected,
+            safe_integral<T> const &desired,
+            memory_order const order = memory_order::memory_order_seq_cst) noexcept -> bool
+        {
+            expects(mut_expected.is_valid_and_checked());
+            expects(desired.is_valid_and_checked());
+
+            T mut_old{mut_expected.get()};
+            bool const exchanged{__atomic_compare_exchange_n(
+                &m_val,
+                &mut_old,
+                desired.get(),
+                true,
+                static_cast<bsl::int32>(order),
+                failure_order(order))};
+
+            if (!exchanged) {
+                mut_expected = safe_integral<T>{mut_old};
+            }
+            else {
+                bsl::touch();
+            }
+
+            return exchanged;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds val to the atomic and returns the value it had
+        ///     before. If the addition would overflow, the atomic is
+        ///     left as is and bsl::safe_integral<T>::failure() is
+        ///     returned instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to add
+        ///   @param order the memory order to use
+        ///   @return Returns the value of the atomic before val was
+        ///     added, or bsl::safe_integral<T>::failure() on overflow.
+        ///
+        [[nodiscard]] auto
+        fetch_add(
+            safe_integral<T> const &val,
+            memory_order const order = memory_order::memory_order_seq_cst) noexcept
+            -> safe_integral<T>
+        {
+            return this->fetch_op(val, order, &builtin_add_wrap<T>);
+        }
+
+        /// <!-- description -->
+        ///   @brief Subtracts val from the atomic and returns the value
+        ///     it had before. If the subtraction would overflow, the
+        ///     atomic is left as is and bsl::safe_integral<T>::failure()
+        ///     is returned instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to subtract
+        ///   @param order the memory order to use
+        ///   @return Returns the value of the atomic before val was
+        ///     subtracted, or bsl::safe_integral<T>::failure() on
+        ///     overflow.
+        ///
+        [[nodiscard]] auto
+        fetch_sub(
+            safe_integral<T> const &val,
+            memory_order const order = memory_order::memory_order_seq_cst) noexcept
+            -> safe_integral<T>
+        {
+            return this->fetch_op(val, order, &builtin_sub_wrap<T>);
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds val to the atomic, wrapping on overflow, and
+        ///     returns the value it had before. Unlike fetch_add(), this
+        ///     is a single instruction on most architectures.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to add
+        ///   @param order the memory order to use
+        ///   @return Returns the value of the atomic before val was added
+        ///
+        [[nodiscard]] auto
+        fetch_wrap_add(
+            safe_integral<T> const &val,
+            memory_order const order = memory_order::memory_order_seq_cst) noexcept
+            -> safe_integral<T>
+        {
+            expects(val.is_valid_and_checked());
+            auto const old{__atomic_fetch_add(&m_val, val.get(), static_cast<bsl::int32>(order))};
+            return safe_integral<T>{old};
+        }
+
+        /// <!-- description -->
+        ///   @brief Subtracts val from the atomic, wrapping on overflow,
+        ///     and returns the value it had before. Unlike fetch_sub(),
+        ///     this is a single instruction on most architectures.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to subtract
+        ///   @param order the memory order to use
+        ///   @return Returns the value of the atomic before val was
+        ///     subtracted
+        ///
+        [[nodiscard]] auto
+        fetch_wrap_sub(
+            safe_integral<T> const &val,
+            memory_order const order = memory_order::memory_order_seq_cst) noexcept
+            -> safe_integral<T>
+        {
+            expects(val.is_valid_and_checked());
+            auto const old{__atomic_fetch_sub(&m_val, val.get(), static_cast<bsl::int32>(order))};
+            return safe_integral<T>{old};
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds val to the atomic, saturating at the max (or
+        ///     min) value of T instead of overflowing, and returns the
+        ///     value it had before.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to add
+        ///   @param order the memory order to use
+        ///   @return Returns the value of the atomic before val was added
+        ///
+        [[nodiscard]] auto
+        fetch_sat_add(
+            safe_integral<T> const &val,
+            memory_order const order = memory_order::memory_order_seq_cst) noexcept
+            -> safe_integral<T>
+        {
+            return this->fetch_op(val, order, &sat_add_op);
+        }
+
+        /// <!-- description -->
+        ///   @brief Subtracts val from the atomic, saturating at the min
+        ///     (or max) value of T instead of overflowing, and returns
+        ///     the value it had before.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to subtract
+        ///   @param order the memory order to use
+        ///   @return Returns the value of the atomic before val was
+        ///     subtracted
+        ///
+        [[nodiscard]] auto
+        fetch_sat_sub(
+            safe_integral<T> const &val,
+            memory_order const order = memory_order::memory_order_seq_cst) noexcept
+            -> safe_integral<T>
+        {
+            return this->fetch_op(val, order, &sat_sub_op);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the atomic to the bitwise AND of itself and val
+        ///     and returns the value it had before. T must be unsigned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to AND with
+        ///   @param order the memory order to use
+        ///   @return Returns the value of the atomic before it was set
+        ///
+        [[nodiscard]] auto
+        fetch_and(
+            safe_integral<T> const &val,
+            memory_order const order = memory_order::memory_order_seq_cst) noexcept
+            -> safe_integral<T>
+        {
+            static_assert(is_unsigned<T>::value, "bitwise operations require unsigned types");
+
+            expects(val.is_valid_and_checked());
+            auto const old{__atomic_fetch_and(&m_val, val.get(), static_cast<bsl::int32>(order))};
+            return safe_integral<T>{old};
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the atomic to the bitwise OR of itself and val
+        ///     and returns the value it had before. T must be unsigned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to OR with
+        ///   @param order the memory order to use
+        ///   @return Returns the value of the atomic before it was set
+        ///
+        [[nodiscard]] auto
+        fetch_or(
+            safe_integral<T> const &val,
+            memory_order const order = memory_order::memory_order_seq_cst) noexcept
+            -> safe_integral<T>
+        {
+            static_assert(is_unsigned<T>::value, "bitwise operations require unsigned types");
+
+            expects(val.is_valid_and_checked());
+            auto const old{__atomic_fetch_or(&m_val, val.get(), static_cast<bsl::int32>(order))};
+            return safe_integral<T>{old};
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the atomic to the bitwise XOR of itself and val
+        ///     and returns the value it had before. T must be unsigned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to XOR with
+        ///   @param order the memory order to use
+        ///   @return Returns the value of the atomic before it was set
+        ///
+        [[nodiscard]] auto
+        fetch_xor(
+            safe_integral<T> const &val,
+            memory_order const order = memory_order::memory_order_seq_cst) noexcept
+            -> safe_integral<T>
+        {
+            static_assert(is_unsigned<T>::value, "bitwise operations require unsigned types");
+
+            expects(val.is_valid_and_checked());
+            auto const old{__atomic_fetch_xor(&m_val, val.get(), static_cast<bsl::int32>(order))};
+            return safe_integral<T>{old};
+        }
+    };
+
+    namespace details
+    {
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        atomic_addr(atomic<T> const &atm) noexcept -> T const *
+        {
+            return &atm.m_val;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,103 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file atomic_wait.hpp
+///
+
+#ifndef BSL_ATOMIC_WAIT_HPP
+#define BSL_ATOMIC_WAIT_HPP
+
+#include <bsl/details/atomic_wait.hpp>
+
+#include "bsl/atomic.hpp"
+#include "bsl/expects.hpp"
+#include "bsl/memory_order.hpp"
+#include "bsl/safe_integral.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Blocks the calling thread for as long as the value of
+    ///     atm equals old. A thread that changes the value must call
+    ///     atomic_notify_one() or atomic_notify_all() to wake it up. On
+    ///     Linux, only 32bit atomics are blocked on using a futex. Other
+    ///     sizes yield the thread until the value changes.
+    ///
+    /// <!-- notes -->
+    ///   @note This lives in its own header (and not in bsl/atomic.hpp)
+    ///     as it needs the platform's wait/wake API, while bsl::atomic
+    ///     (and the locks built on it) must stay freestanding.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral stored by the atomic
+    ///   @param atm the atomic to wait on
+    ///   @param old the value to wait on to change
+    ///   @param order the memory order to use when loading the value.
+    ///     Must not be memory_order_release or memory_order_acq_rel.
+    ///
+    template<typename T>
+    inline void
+    atomic_wait(
+        atomic<T> const &atm,
+        safe_integral<T> const &old,
+        memory_order const order = memory_order::memory_order_seq_cst) noexcept
+    {
+        expects(old.is_valid_and_checked());
+        while (atm.load(order) == old) {
+            details::atomic_wait(details::atomic_addr(atm), old.get());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Wakes up one thread that is blocked in atomic_wait() on
+    ///     mut_atm.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral stored by the atomic
+    ///   @param mut_atm the atomic to wake a waiter of
+    ///
+    template<typename T>
+    inline void
+    atomic_notify_one(atomic<T> &mut_atm) noexcept
+    {
+        details::atomic_notify(details::atomic_addr(mut_atm), false);
+    }
+
+    /// <!-- description -->
+    ///   @brief Wakes up all threads that are blocked in atomic_wait() on
+    ///     mut_atm.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral stored by the atomic
+    ///   @param mut_atm the atomic to wake the waiters of
+    ///
+    template<typename T>
+    inline void
+    atomic_notify_all(atomic<T> &mut_atm) noexcept
+    {
+        details::atomic_notify(details::atomic_addr(mut_atm), true);
+    }
+}
+
+#endif
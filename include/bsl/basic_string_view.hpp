@@ -1024,13 +1024,30 @@ namespace bsl
             ///   the math below must be valid so it is marked as checked.
             ///
 
-            auto const len{((view.length() - str.length()) + size_type::magic_1()).checked()};
-            for (index_type mut_i{}; mut_i < len; ++mut_i) {
-                if (view.equals(mut_i, size_type::max_value(), str)) {
+            auto const last{(view.length() - str.length()).checked()};
+            auto const first{*str.front_if()};
+
+            /// NOTE:
+            /// - Instead of comparing the string at every position, we use
+            ///   TRAITS::find() to skip ahead to the next position that
+            ///   starts with the first character of the string, and only
+            ///   compare the string there.
+            ///
+
+            index_type mut_i{};
+            while (mut_i <= last) {
+                auto const remaining{(last - mut_i.get() + size_type::magic_1()).checked()};
+                auto const skip{TRAITS::find(view.at_if(mut_i), remaining, first)};
+                if (npos == skip) {
+                    return npos;
+                }
+
+                mut_i += skip;
+                if (0 == TRAITS::compare(view.at_if(mut_i), str.data(), str.length())) {
                     return mut_i + pos;
                 }
 
-                bsl::touch();
+                ++mut_i;
             }
 
             return npos;
@@ -1059,15 +1076,12 @@ namespace bsl
                 return npos;
             }
 
-            for (index_type mut_i{}; mut_i < view.length(); ++mut_i) {
-                if (*view.at_if(mut_i) == ch) {
-                    return mut_i + pos;
-                }
-
-                bsl::touch();
+            auto const idx{TRAITS::find(view.data(), view.length(), ch)};
+            if (npos == idx) {
+                return npos;
             }
 
-            return npos;
+            return idx + pos;
         }
 
         /// <!-- description -->
@@ -1088,7 +1102,378 @@ namespace bsl
             return this->find(basic_string_view{str}, pos);
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the index of the last occurrence of the provided
+        ///     string that starts at or before pos. If the string does not
+        ///     occur, bsl::npos is returned.
+        ///   @include basic_string_view/example_basic_string_view_rfind.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to find the index of
+        ///   @param pos the last position the string is allowed to start at
+        ///   @return Returns the index of the last occurrence of the provided
+        ///     string. If the string does not occur, bsl::npos is returned.
+        ///
+        [[nodiscard]] constexpr auto
+        rfind(basic_string_view const &str, index_type const &pos = npos) const noexcept
+            -> index_type
+        {
+            expects(pos.is_valid());
+
+            if (unlikely(str.empty())) {
+                return npos;
+            }
+
+            if (unlikely(m_count < str.length())) {
+                return npos;
+            }
+
+            auto mut_i{this->last_index(pos, str.length()) + index_type::magic_1()};
+            while (mut_i.is_pos()) {
+                --mut_i;
+                if (0 == TRAITS::compare(this->at_if(mut_i), str.data(), str.length())) {
+                    return mut_i;
+                }
+
+                bsl::touch();
+            }
+
+            return npos;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the last occurrence of the provided
+        ///     character at or before pos. If the character does not
+        ///     occur, bsl::npos is returned.
+        ///   @include basic_string_view/example_basic_string_view_rfind.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ch the character to find the index of
+        ///   @param pos the last position to search
+        ///   @return Returns the index of the last occurrence of the provided
+        ///     character. If the character does not occur, bsl::npos is
+        ///     returned.
+        ///
+        [[nodiscard]] constexpr auto
+        rfind(CHAR_T const ch, index_type const &pos = npos) const noexcept -> index_type
+        {
+            expects(pos.is_valid());
+
+            if (this->empty()) {
+                return npos;
+            }
+
+            auto mut_i{this->last_index(pos, size_type::magic_1()) + index_type::magic_1()};
+            while (mut_i.is_pos()) {
+                --mut_i;
+                if (TRAITS::eq(*this->at_if(mut_i), ch)) {
+                    return mut_i;
+                }
+
+                bsl::touch();
+            }
+
+            return npos;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the last occurrence of the provided
+        ///     string that starts at or before pos. If the string does not
+        ///     occur, bsl::npos is returned.
+        ///   @include basic_string_view/example_basic_string_view_rfind.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to find the index of
+        ///   @param pos the last position the string is allowed to start at
+        ///   @return Returns the index of the last occurrence of the provided
+        ///     string. If the string does not occur, bsl::npos is returned.
+        ///
+        [[nodiscard]] constexpr auto
+        rfind(pointer_type const str, index_type const &pos = npos) const noexcept -> index_type
+        {
+            expects(pos.is_valid());
+            return this->rfind(basic_string_view{str}, pos);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the first character at or after
+        ///     pos that is equal to any of the characters in the provided
+        ///     string. If no such character exists, bsl::npos is returned.
+        ///   @include basic_string_view/example_basic_string_view_find_first_of.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the characters to search for
+        ///   @param pos the starting position to search from
+        ///   @return Returns the index of the first character that is equal
+        ///     to any of the characters in the provided string. If no such
+        ///     character exists, bsl::npos is returned.
+        ///
+        [[nodiscard]] constexpr auto
+        find_first_of(basic_string_view const &str, index_type const &pos = {}) const noexcept
+            -> index_type
+        {
+            expects(pos.is_valid());
+
+            if (unlikely(str.empty())) {
+                return npos;
+            }
+
+            for (index_type mut_i{pos}; mut_i < m_count; ++mut_i) {
+                if (str.contains(*this->at_if(mut_i))) {
+                    return mut_i;
+                }
+
+                bsl::touch();
+            }
+
+            return npos;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns this->find(ch, pos)
+        ///   @include basic_string_view/example_basic_string_view_find_first_of.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ch the character to search for
+        ///   @param pos the starting position to search from
+        ///   @return Returns this->find(ch, pos)
+        ///
+        [[nodiscard]] constexpr auto
+        find_first_of(CHAR_T const ch, index_type const &pos = {}) const noexcept -> index_type
+        {
+            expects(pos.is_valid());
+            return this->find(ch, pos);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the first character at or after
+        ///     pos that is equal to any of the characters in the provided
+        ///     string. If no such character exists, bsl::npos is returned.
+        ///   @include basic_string_view/example_basic_string_view_find_first_of.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the characters to search for
+        ///   @param pos the starting position to search from
+        ///   @return Returns the index of the first character that is equal
+        ///     to any of the characters in the provided string. If no such
+        ///     character exists, bsl::npos is returned.
+        ///
+        [[nodiscard]] constexpr auto
+        find_first_of(pointer_type const str, index_type const &pos = {}) const noexcept
+            -> index_type
+        {
+            expects(pos.is_valid());
+            return this->find_first_of(basic_string_view{str}, pos);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the last character at or before
+        ///     pos that is equal to any of the characters in the provided
+        ///     string. If no such character exists, bsl::npos is returned.
+        ///   @include basic_string_view/example_basic_string_view_find_last_of.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the characters to search for
+        ///   @param pos the last position to search
+        ///   @return Returns the index of the last character that is equal
+        ///     to any of the characters in the provided string. If no such
+        ///     character exists, bsl::npos is returned.
+        ///
+        [[nodiscard]] constexpr auto
+        find_last_of(basic_string_view const &str, index_type const &pos = npos) const noexcept
+            -> index_type
+        {
+            expects(pos.is_valid());
+
+            if (unlikely(str.empty())) {
+                return npos;
+            }
+
+            if (this->empty()) {
+                return npos;
+            }
+
+            auto mut_i{this->last_index(pos, size_type::magic_1()) + index_type::magic_1()};
+            while (mut_i.is_pos()) {
+                --mut_i;
+                if (str.contains(*this->at_if(mut_i))) {
+                    return mut_i;
+                }
+
+                bsl::touch();
+            }
+
+            return npos;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns this->rfind(ch, pos)
+        ///   @include basic_string_view/example_basic_string_view_find_last_of.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ch the character to search for
+        ///   @param pos the last position to search
+        ///   @return Returns this->rfind(ch, pos)
+        ///
+        [[nodiscard]] constexpr auto
+        find_last_of(CHAR_T const ch, index_type const &pos = npos) const noexcept -> index_type
+        {
+            expects(pos.is_valid());
+            return this->rfind(ch, pos);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the last character at or before
+        ///     pos that is equal to any of the characters in the provided
+        ///     string. If no such character exists, bsl::npos is returned.
+        ///   @include basic_string_view/example_basic_string_view_find_last_of.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the characters to search for
+        ///   @param pos the last position to search
+        ///   @return Returns the index of the last character that is equal
+        ///     to any of the characters in the provided string. If no such
+        ///     character exists, bsl::npos is returned.
+        ///
+        [[nodiscard]] constexpr auto
+        find_last_of(pointer_type const str, index_type const &pos = npos) const noexcept
+            -> index_type
+        {
+            expects(pos.is_valid());
+            return this->find_last_of(basic_string_view{str}, pos);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the first character at or after
+        ///     pos that is not equal to any of the characters in the
+        ///     provided string. If the provided string is empty, this is
+        ///     pos itself. If no such character exists, bsl::npos is
+        ///     returned.
+        ///   @include basic_string_view/example_basic_string_view_find_first_not_of.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the characters to skip over
+        ///   @param pos the starting position to search from
+        ///   @return Returns the index of the first character that is not
+        ///     equal to any of the characters in the provided string. If no
+        ///     such character exists, bsl::npos is returned.
+        ///
+        [[nodiscard]] constexpr auto
+        find_first_not_of(basic_string_view const &str, index_type const &pos = {}) const noexcept
+            -> index_type
+        {
+            expects(pos.is_valid());
+
+            for (index_type mut_i{pos}; mut_i < m_count; ++mut_i) {
+                if (!str.contains(*this->at_if(mut_i))) {
+                    return mut_i;
+                }
+
+                bsl::touch();
+            }
+
+            return npos;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the first character at or after
+        ///     pos that is not equal to the provided character. If no such
+        ///     character exists, bsl::npos is returned.
+        ///   @include basic_string_view/example_basic_string_view_find_first_not_of.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ch the character to skip over
+        ///   @param pos the starting position to search from
+        ///   @return Returns the index of the first character that is not
+        ///     equal to the provided character. If no such character
+        ///     exists, bsl::npos is returned.
+        ///
+        [[nodiscard]] constexpr auto
+        find_first_not_of(CHAR_T const ch, index_type const &pos = {}) const noexcept
+            -> index_type
+        {
+            expects(pos.is_valid());
+
+            for (index_type mut_i{pos}; mut_i < m_count; ++mut_i) {
+                if (!TRAITS::eq(*this->at_if(mut_i), ch)) {
+                    return mut_i;
+                }
+
+                bsl::touch();
+            }
+
+            return npos;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the first character at or after
+        ///     pos that is not equal to any of the characters in the
+        ///     provided string. If no such character exists, bsl::npos is
+        ///     returned.
+        ///   @include basic_string_view/example_basic_string_view_find_first_not_of.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the characters to skip over
+        ///   @param pos the starting position to search from
+        ///   @return Returns the index of the first character that is not
+        ///     equal to any of the characters in the provided string. If no
+        ///     such character exists, bsl::npos is returned.
+        ///
+        [[nodiscard]] constexpr auto
+        find_first_not_of(pointer_type const str, index_type const &pos = {}) const noexcept
+            -> index_type
+        {
+            expects(pos.is_valid());
+            return this->find_first_not_of(basic_string_view{str}, pos);
+        }
+
     private:
+        /// <!-- description -->
+        ///   @brief Returns true if the provided character is in this
+        ///     string, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ch the character to search for
+        ///   @return Returns true if the provided character is in this
+        ///     string, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        contains(CHAR_T const ch) const noexcept -> bool
+        {
+            if (this->empty()) {
+                return false;
+            }
+
+            return npos != TRAITS::find(m_ptr, m_count, ch);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the last index that a string of count characters
+        ///     can start at in this string, that is also not after pos.
+        ///     The caller must ensure that 0 < count <= this->length().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pos the last index the caller is interested in
+        ///   @param count the number of characters that must fit
+        ///   @return Returns min(pos, this->length() - count)
+        ///
+        [[nodiscard]] constexpr auto
+        last_index(index_type const &pos, size_type const &count) const noexcept -> index_type
+        {
+            /// NOTE:
+            /// - The caller ensures that count <= m_count, so the math
+            ///   below cannot underflow which is why it is marked as
+            ///   checked.
+            ///
+
+            index_type const last{(m_count - count).checked().get()};
+            if (pos < last) {
+                return pos;
+            }
+
+            return last;
+        }
+
         /// @brief stores a pointer to the string being viewed
         pointer_type m_ptr;
         /// @brief stores the number of elements in the string being viewed
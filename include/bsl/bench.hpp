@@ -0,0 +1,195 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file bench.hpp
+///
+
+#ifndef BSL_BENCH_HPP
+#define BSL_BENCH_HPP
+
+#include "bsl/array.hpp"
+#include "bsl/convert.hpp"
+#include "bsl/cstdint.hpp"
+#include "bsl/cstr_type.hpp"
+#include "bsl/debug.hpp"    // IWYU pragma: export
+#include "bsl/expects.hpp"
+#include "bsl/safe_idx.hpp"
+#include "bsl/safe_integral.hpp"
+#include "bsl/sort.hpp"
+
+#include <bsl/bench_clock.hpp>    // IWYU pragma: export
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief the default number of timed repetitions run by bsl::bench
+        constexpr bsl::uintmx BENCH_DEFAULT_REPS{static_cast<bsl::uintmx>(101)};
+        /// @brief the default number of untimed repetitions run by bsl::bench
+        constexpr bsl::uintmx BENCH_DEFAULT_WARMUP{static_cast<bsl::uintmx>(10)};
+    }
+
+    /// @class bsl::bench_result
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the summary of a benchmark that was run using
+    ///     bsl::bench. All times are in picoseconds per operation.
+    ///
+    struct bench_result final
+    {
+        /// @brief stores the time of the fastest repetition
+        bsl::safe_u64 min;
+        /// @brief stores the time of the median repetition
+        bsl::safe_u64 median;
+        /// @brief stores the time that 99% of the repetitions were at or below
+        bsl::safe_u64 p99;
+    };
+
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Sorts the provided samples and returns the min, median
+        ///     and 99th percentile of the samples, converted from
+        ///     nanoseconds per repetition to picoseconds per operation.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam N the total number of samples
+        ///   @param mut_samples the time each repetition took in nanoseconds
+        ///   @param ops the total number of operations run per repetition
+        ///   @return Returns the resulting bsl::bench_result
+        ///
+        template<bsl::uintmx N>
+        [[nodiscard]] constexpr auto
+        bench_summarize(
+            bsl::array<bsl::safe_u64, N> &mut_samples, bsl::safe_umx const &ops) noexcept
+            -> bench_result
+        {
+            static_assert(N > static_cast<bsl::uintmx>(0));
+            constexpr auto ps_per_ns{1000_u64};
+            constexpr auto pct{100_umx};
+            constexpr auto p99{99_umx};
+
+            bsl::sort(mut_samples);
+
+            /// NOTE:
+            /// - The 99th percentile uses the nearest rank method, which is
+            ///   the sample at ceil(0.99 * N) - 1 once the samples are sorted.
+            ///
+
+            auto const mid{bsl::to_idx(mut_samples.size() / 2_umx)};
+            auto const tail{bsl::to_idx((((mut_samples.size() * p99) + p99) / pct) - 1_umx)};
+            auto const div{bsl::to_u64(ops)};
+
+            return {
+                ((mut_samples.front() * ps_per_ns) / div).checked(),
+                ((*mut_samples.at_if(mid) * ps_per_ns) / div).checked(),
+                ((*mut_samples.at_if(tail) * ps_per_ns) / div).checked()};
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Tells the compiler that the provided value is used, and
+    ///     that memory might have been read or written, without
+    ///     generating any instructions. This keeps the compiler from
+    ///     removing, or moving out of the timed region, the work that
+    ///     is being measured.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of value to keep
+    ///   @param val the value to keep
+    ///
+    template<typename T>
+    void
+    bench_keep(T const &val) noexcept
+    {
+        __asm__ __volatile__("" : : "r"(&val) : "memory");    // NOLINT
+    }
+
+    /// <!-- description -->
+    ///   @brief Runs the provided function WARMUP times without measuring
+    ///     it, and then REPS more times, measuring each call using the
+    ///     system's monotonic clock. The result is outputted using
+    ///     bsl::print as a single line of key=value pairs that tools can
+    ///     parse and compare between builds:
+    ///
+    ///     bench name=<name> ops=<ops> reps=<REPS> min_ps=<> median_ps=<> p99_ps=<>
+    ///
+    ///     All times are in picoseconds per operation, where an operation
+    ///     is whatever func does "ops" times each time it is called. Use
+    ///     bsl::bench_keep() on whatever func computes so that the
+    ///     compiler cannot remove the work being measured.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam REPS the total number of measured repetitions
+    ///   @tparam WARMUP the total number of unmeasured repetitions
+    ///   @tparam FUNC the type of function to measure
+    ///   @param name the name of the benchmark
+    ///   @param ops the total number of operations func runs each call
+    ///   @param mut_func the function to measure
+    ///   @return Returns the resulting bsl::bench_result
+    ///
+    template<
+        bsl::uintmx REPS = details::BENCH_DEFAULT_REPS,
+        bsl::uintmx WARMUP = details::BENCH_DEFAULT_WARMUP,
+        typename FUNC>
+    [[maybe_unused]] auto
+    bench(bsl::cstr_type const name, bsl::safe_umx const &ops, FUNC &&mut_func) noexcept
+        -> bench_result
+    {
+        expects(nullptr != name);
+        expects(ops.is_valid_and_checked());
+        expects(ops.is_pos());
+
+        for (bsl::uintmx mut_i{}; mut_i < WARMUP; ++mut_i) {
+            mut_func();
+        }
+
+        bsl::array<bsl::safe_u64, REPS> mut_samples{};
+        for (auto &mut_sample : mut_samples) {
+            auto const start{bsl::bench_clock_ns()};
+            mut_func();
+            bench_keep(start);
+            mut_sample = bsl::safe_u64{bsl::bench_clock_ns() - start};
+        }
+
+        auto const res{details::bench_summarize(mut_samples, ops)};
+
+        // clang-format off
+
+        bsl::print() << "bench"
+                     << " name=" << name
+                     << " ops=" << ops
+                     << " reps=" << bsl::safe_umx{REPS}
+                     << " min_ps=" << res.min
+                     << " median_ps=" << res.median
+                     << " p99_ps=" << res.p99
+                     << bsl::endl;
+
+        // clang-format on
+
+        return res;
+    }
+}
+
+#endif
@@ -30,6 +30,7 @@
 
 #include "bsl/char_type.hpp"
 #include "bsl/cstring.hpp"
+#include "bsl/safe_idx.hpp"
 #include "bsl/safe_integral.hpp"
 #include "bsl/touch.hpp"
 
@@ -119,6 +120,54 @@ namespace bsl
             return bsl::builtin_strlen(s);
         }
 
+        /// <!-- description -->
+        ///   @brief Compares the first count characters of s1 and s2.
+        ///     Returns 0 if they are the same, a negative value if s1
+        ///     compares less than s2, and a positive value otherwise.
+        ///   @include char_traits/example_char_traits_compare.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param s1 the left hand side of the comparison
+        ///   @param s2 the right hand side of the comparison
+        ///   @param count the total number of characters to compare
+        ///   @return Returns 0 if the characters are the same, a negative
+        ///     value if s1 compares less than s2, and a positive value
+        ///     otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        compare(
+            char_type const *const s1,
+            char_type const *const s2,
+            safe_umx const &count) noexcept -> bsl::int32
+        {
+            return bsl::builtin_memcmp(s1, s2, count);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the first occurrence of ch in the
+        ///     first count characters of s.
+        ///   @include char_traits/example_char_traits_find.hpp
+        ///
+        /// <!-- notes -->
+        ///   @note The BSL returns an index instead of a pointer, and
+        ///     returns bsl::npos (instead of a nullptr) if ch does not
+        ///     occur.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param s the characters to search
+        ///   @param count the total number of characters to search
+        ///   @param ch the character to search for
+        ///   @return Returns the index of the first occurrence of ch in the
+        ///     first count characters of s, or bsl::npos if ch does not
+        ///     occur.
+        ///
+        [[nodiscard]] static constexpr auto
+        find(char_type const *const s, safe_umx const &count, char_type const ch) noexcept
+            -> safe_idx
+        {
+            return bsl::builtin_memchr(s, ch, count);
+        }
+
         /// <!-- description -->
         ///   @brief Converts a value of bsl::int32 to char_type. If there is
         ///     no equivalent value (such as when c is a copy of the eof value),
@@ -0,0 +1,447 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file checked_batch.hpp
+///
+
+#ifndef BSL_CHECKED_BATCH_HPP
+#define BSL_CHECKED_BATCH_HPP
+
+#include "bsl/cstdint.hpp"
+#include "bsl/details/checked_batch_impl.hpp"
+#include "bsl/errc_type.hpp"
+#include "bsl/integer.hpp"
+#include "bsl/is_same.hpp"
+#include "bsl/is_signed.hpp"
+#include "bsl/remove_const.hpp"
+#include "bsl/safe_integral.hpp"
+#include "bsl/span.hpp"
+#include "bsl/unlikely.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Returns the error code a batch operation returns when
+        ///     one of its operations overflowed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of values the batch operated on
+        ///   @return Returns the error code a batch operation returns when
+        ///     one of its operations overflowed.
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        batch_overflow_errc() noexcept -> errc_type
+        {
+            if constexpr (is_signed<T>::value) {
+                return errc_signed_overflow;
+            }
+            else {
+                return errc_unsigned_wrap;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Implements the element-wise batch operations. Validates
+        ///     the sizes of the spans and then runs "op" on each element.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of values to operate on
+        ///   @tparam U either T or T const
+        ///   @tparam OP the type of operation to perform
+        ///   @param mut_dst the destination of the results
+        ///   @param lhs the left hand side of each operation
+        ///   @param rhs the right hand side of each operation
+        ///   @param op the operation to perform
+        ///   @return Returns bsl::errc_success on success,
+        ///     bsl::errc_index_out_of_bounds if the spans do not match and
+        ///     bsl::errc_unsigned_wrap/bsl::errc_signed_overflow if any of
+        ///     the operations overflowed.
+        ///
+        template<typename T, typename U, typename OP>
+        [[nodiscard]] constexpr auto
+        batch_elementwise(
+            span<T> &mut_dst, span<U> const &lhs, span<U> const &rhs, OP const op) noexcept
+            -> errc_type
+        {
+            static_assert(is_same<remove_const_t<U>, T>::value, "spans must have the same type");
+
+            auto const count{batch_count(mut_dst.size(), lhs.size(), rhs.size())};
+            if (unlikely(count.is_invalid())) {
+                return errc_index_out_of_bounds;
+            }
+
+            if (batch_apply<T>(mut_dst.data(), lhs.data(), rhs.data(), count.get(), op)) {
+                return batch_overflow_errc<T>();
+            }
+
+            return errc_success;
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Performs mut_dst[i] = lhs[i] + rhs[i] for each element in
+    ///     lhs and rhs. Instead of checking each addition like
+    ///     bsl::safe_integral does, the overflow of every addition is
+    ///     computed without a branch and OR'd into a single result for
+    ///     the whole batch, which allows the compiler to vectorize the
+    ///     loop. If an error is returned, the contents of mut_dst are
+    ///     unspecified and must not be used.
+    ///   @include example_checked_batch_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to add
+    ///   @tparam U either T or T const
+    ///   @param mut_dst the destination of the results. Must be at least
+    ///     as large as lhs.
+    ///   @param lhs the left hand side of each addition
+    ///   @param rhs the right hand side of each addition. Must be the
+    ///     same size as lhs.
+    ///   @return Returns bsl::errc_success on success,
+    ///     bsl::errc_index_out_of_bounds if the spans do not match and
+    ///     bsl::errc_unsigned_wrap/bsl::errc_signed_overflow if any of
+    ///     the additions overflowed.
+    ///
+    template<typename T, typename U>
+    [[nodiscard]] constexpr auto
+    checked_add(span<T> &mut_dst, span<U> const &lhs, span<U> const &rhs) noexcept -> errc_type
+    {
+        constexpr auto op{[](T const a, T const b, T &mut_res) noexcept -> bool {
+            return builtin_add_wrap(a, b, &mut_res);
+        }};
+
+        return details::batch_elementwise(mut_dst, lhs, rhs, op);
+    }
+
+    /// <!-- description -->
+    ///   @brief Performs mut_dst[i] = lhs[i] - rhs[i] for each element in
+    ///     lhs and rhs, OR'ing the overflow of every subtraction into a
+    ///     single result for the whole batch. If an error is returned,
+    ///     the contents of mut_dst are unspecified and must not be used.
+    ///   @include example_checked_batch_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to subtract
+    ///   @tparam U either T or T const
+    ///   @param mut_dst the destination of the results. Must be at least
+    ///     as large as lhs.
+    ///   @param lhs the left hand side of each subtraction
+    ///   @param rhs the right hand side of each subtraction. Must be the
+    ///     same size as lhs.
+    ///   @return Returns bsl::errc_success on success,
+    ///     bsl::errc_index_out_of_bounds if the spans do not match and
+    ///     bsl::errc_unsigned_wrap/bsl::errc_signed_overflow if any of
+    ///     the subtractions overflowed.
+    ///
+    template<typename T, typename U>
+    [[nodiscard]] constexpr auto
+    checked_sub(span<T> &mut_dst, span<U> const &lhs, span<U> const &rhs) noexcept -> errc_type
+    {
+        constexpr auto op{[](T const a, T const b, T &mut_res) noexcept -> bool {
+            return builtin_sub_wrap(a, b, &mut_res);
+        }};
+
+        return details::batch_elementwise(mut_dst, lhs, rhs, op);
+    }
+
+    /// <!-- description -->
+    ///   @brief Performs mut_dst[i] = lhs[i] * rhs[i] for each element in
+    ///     lhs and rhs, OR'ing the overflow of every multiplication into
+    ///     a single result for the whole batch. If an error is returned,
+    ///     the contents of mut_dst are unspecified and must not be used.
+    ///   @include example_checked_batch_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to multiply
+    ///   @tparam U either T or T const
+    ///   @param mut_dst the destination of the results. Must be at least
+    ///     as large as lhs.
+    ///   @param lhs the left hand side of each multiplication
+    ///   @param rhs the right hand side of each multiplication. Must be
+    ///     the same size as lhs.
+    ///   @return Returns bsl::errc_success on success,
+    ///     bsl::errc_index_out_of_bounds if the spans do not match and
+    ///     bsl::errc_unsigned_wrap/bsl::errc_signed_overflow if any of
+    ///     the multiplications overflowed.
+    ///
+    template<typename T, typename U>
+    [[nodiscard]] constexpr auto
+    checked_mul(span<T> &mut_dst, span<U> const &lhs, span<U> const &rhs) noexcept -> errc_type
+    {
+        constexpr auto op{[](T const a, T const b, T &mut_res) noexcept -> bool {
+            return builtin_mul_wrap(a, b, &mut_res);
+        }};
+
+        return details::batch_elementwise(mut_dst, lhs, rhs, op);
+    }
+
+    /// <!-- description -->
+    ///   @brief Performs mut_dst[i] = mut_dst[i] + (lhs[i] * rhs[i]) (a
+    ///     multiply-accumulate) for each element in lhs and rhs, OR'ing
+    ///     the overflow of every multiplication and addition into a
+    ///     single result for the whole batch. If an error is returned,
+    ///     the contents of mut_dst are unspecified and must not be used.
+    ///   @include example_checked_batch_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to multiply-accumulate
+    ///   @tparam U either T or T const
+    ///   @param mut_dst the accumulators. Must be at least as large as
+    ///     lhs.
+    ///   @param lhs the left hand side of each multiplication
+    ///   @param rhs the right hand side of each multiplication. Must be
+    ///     the same size as lhs.
+    ///   @return Returns bsl::errc_success on success,
+    ///     bsl::errc_index_out_of_bounds if the spans do not match and
+    ///     bsl::errc_unsigned_wrap/bsl::errc_signed_overflow if any of
+    ///     the operations overflowed.
+    ///
+    template<typename T, typename U>
+    [[nodiscard]] constexpr auto
+    checked_mac(span<T> &mut_dst, span<U> const &lhs, span<U> const &rhs) noexcept -> errc_type
+    {
+        constexpr auto op{[](T const a, T const b, T &mut_res) noexcept -> bool {
+            T mut_prod{};
+            bool const mul_overflow{builtin_mul_wrap(a, b, &mut_prod)};
+            bool const add_overflow{builtin_add_wrap(mut_res, mut_prod, &mut_res)};
+            return mul_overflow || add_overflow;
+        }};
+
+        return details::batch_elementwise(mut_dst, lhs, rhs, op);
+    }
+
+    /// <!-- description -->
+    ///   @brief Performs mut_dst[i] = lhs[i] + rhs[i] for each element in
+    ///     lhs and rhs, saturating each result to the min/max value of T
+    ///     instead of overflowing.
+    ///   @include example_checked_batch_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to add
+    ///   @tparam U either T or T const
+    ///   @param mut_dst the destination of the results. Must be at least
+    ///     as large as lhs.
+    ///   @param lhs the left hand side of each addition
+    ///   @param rhs the right hand side of each addition. Must be the
+    ///     same size as lhs.
+    ///   @return Returns bsl::errc_success on success and
+    ///     bsl::errc_index_out_of_bounds if the spans do not match.
+    ///
+    template<typename T, typename U>
+    [[nodiscard]] constexpr auto
+    saturating_add(span<T> &mut_dst, span<U> const &lhs, span<U> const &rhs) noexcept
+        -> errc_type
+    {
+        constexpr auto op{[](T const a, T const b, T &mut_res) noexcept -> bool {
+            mut_res = builtin_add_sat(a, b);
+            return false;
+        }};
+
+        return details::batch_elementwise(mut_dst, lhs, rhs, op);
+    }
+
+    /// <!-- description -->
+    ///   @brief Performs mut_dst[i] = lhs[i] - rhs[i] for each element in
+    ///     lhs and rhs, saturating each result to the min/max value of T
+    ///     instead of overflowing.
+    ///   @include example_checked_batch_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to subtract
+    ///   @tparam U either T or T const
+    ///   @param mut_dst the destination of the results. Must be at least
+    ///     as large as lhs.
+    ///   @param lhs the left hand side of each subtraction
+    ///   @param rhs the right hand side of each subtraction. Must be the
+    ///     same size as lhs.
+    ///   @return Returns bsl::errc_success on success and
+    ///     bsl::errc_index_out_of_bounds if the spans do not match.
+    ///
+    template<typename T, typename U>
+    [[nodiscard]] constexpr auto
+    saturating_sub(span<T> &mut_dst, span<U> const &lhs, span<U> const &rhs) noexcept
+        -> errc_type
+    {
+        constexpr auto op{[](T const a, T const b, T &mut_res) noexcept -> bool {
+            mut_res = builtin_sub_sat(a, b);
+            return false;
+        }};
+
+        return details::batch_elementwise(mut_dst, lhs, rhs, op);
+    }
+
+    /// <!-- description -->
+    ///   @brief Performs mut_dst[i] = lhs[i] * rhs[i] for each element in
+    ///     lhs and rhs, saturating each result to the min/max value of T
+    ///     instead of overflowing.
+    ///   @include example_checked_batch_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to multiply
+    ///   @tparam U either T or T const
+    ///   @param mut_dst the destination of the results. Must be at least
+    ///     as large as lhs.
+    ///   @param lhs the left hand side of each multiplication
+    ///   @param rhs the right hand side of each multiplication. Must be
+    ///     the same size as lhs.
+    ///   @return Returns bsl::errc_success on success and
+    ///     bsl::errc_index_out_of_bounds if the spans do not match.
+    ///
+    template<typename T, typename U>
+    [[nodiscard]] constexpr auto
+    saturating_mul(span<T> &mut_dst, span<U> const &lhs, span<U> const &rhs) noexcept
+        -> errc_type
+    {
+        constexpr auto op{[](T const a, T const b, T &mut_res) noexcept -> bool {
+            mut_res = builtin_mul_sat(a, b);
+            return false;
+        }};
+
+        return details::batch_elementwise(mut_dst, lhs, rhs, op);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the sum of all of the elements in "vals". If the
+    ///     sum does not fit in T, the result is poisoned. Instead of
+    ///     checking each addition like bsl::safe_integral does, the sum
+    ///     is computed using additions that cannot overflow (see
+    ///     details::batch_sum_chunk), which allows the compiler to
+    ///     vectorize the loop and means that, unlike a serial chain of
+    ///     safe_integral additions, a signed sum is only poisoned if the
+    ///     final result does not fit (for spans of up to 2^31 elements,
+    ///     after which the partial sums of each 2^31 elements are
+    ///     added with a check).
+    ///   @include example_checked_batch_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to sum
+    ///   @param vals the values to sum
+    ///   @return Returns the sum of all of the elements in "vals", or a
+    ///     poisoned result if the sum does not fit.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    checked_sum(span<T> const &vals) noexcept -> safe_integral<remove_const_t<T>>
+    {
+        using value_type = remove_const_t<T>;
+        constexpr auto chunk{details::CHECKED_BATCH_SUM_CHUNK};
+
+        auto const *const ptr{vals.data()};
+        auto const count{vals.size().get()};
+
+        value_type mut_sum{};
+        bool mut_overflow{};
+
+        for (bsl::uintmx mut_i{}; mut_i < count; mut_i += chunk) {
+            auto const remaining{count - mut_i};
+            auto const size{(remaining < chunk) ? remaining : chunk};
+
+            value_type mut_part{};
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            bool const part_overflow{details::batch_sum_chunk(&ptr[mut_i], size, mut_part)};
+            bool const add_overflow{builtin_add_wrap(mut_sum, mut_part, &mut_sum)};
+            mut_overflow = mut_overflow || part_overflow || add_overflow;
+        }
+
+        if (unlikely(mut_overflow)) {
+            return safe_integral<value_type>::failure();
+        }
+
+        return safe_integral<value_type>{mut_sum};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the smallest element in "vals". If "vals" is
+    ///     empty, a poisoned result is returned. The loop only contains
+    ///     a select, which allows the compiler to vectorize it.
+    ///   @include example_checked_batch_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to search
+    ///   @param vals the values to search
+    ///   @return Returns the smallest element in "vals". If "vals" is
+    ///     empty, a poisoned result is returned.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    checked_min(span<T> const &vals) noexcept -> safe_integral<remove_const_t<T>>
+    {
+        using value_type = remove_const_t<T>;
+
+        if (unlikely(vals.empty())) {
+            return safe_integral<value_type>::failure();
+        }
+
+        auto const *const ptr{vals.data()};
+        auto const count{vals.size().get()};
+
+        value_type mut_min{*ptr};
+        for (bsl::uintmx mut_i{1U}; mut_i < count; ++mut_i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            auto const val{ptr[mut_i]};
+            mut_min = (val < mut_min) ? val : mut_min;
+        }
+
+        return safe_integral<value_type>{mut_min};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the largest element in "vals". If "vals" is
+    ///     empty, a poisoned result is returned. The loop only contains
+    ///     a select, which allows the compiler to vectorize it.
+    ///   @include example_checked_batch_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to search
+    ///   @param vals the values to search
+    ///   @return Returns the largest element in "vals". If "vals" is
+    ///     empty, a poisoned result is returned.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    checked_max(span<T> const &vals) noexcept -> safe_integral<remove_const_t<T>>
+    {
+        using value_type = remove_const_t<T>;
+
+        if (unlikely(vals.empty())) {
+            return safe_integral<value_type>::failure();
+        }
+
+        auto const *const ptr{vals.data()};
+        auto const count{vals.size().get()};
+
+        value_type mut_max{*ptr};
+        for (bsl::uintmx mut_i{1U}; mut_i < count; ++mut_i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            auto const val{ptr[mut_i]};
+            mut_max = (val > mut_max) ? val : mut_max;
+        }
+
+        return safe_integral<value_type>{mut_max};
+    }
+}
+
+#endif
@@ -0,0 +1,260 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file checked_range.hpp
+///
+
+#ifndef BSL_CHECKED_RANGE_HPP
+#define BSL_CHECKED_RANGE_HPP
+
+#include "bsl/cstdint.hpp"
+#include "bsl/expects.hpp"
+#include "bsl/safe_idx.hpp"
+#include "bsl/safe_integral.hpp"
+#include "bsl/unlikely.hpp"
+
+namespace bsl
+{
+    /// @class bsl::checked_range
+    ///
+    /// <!-- description -->
+    ///   @brief A bsl::checked_range is a view of an array whose bounds
+    ///     have already been proven. The pointer and the number of elements
+    ///     are checked once when the range is created (normally using
+    ///     bsl::span::unchecked_view()), and from then on, indexing into the
+    ///     range is a raw array access. This is meant for hot loops whose
+    ///     bounds are already the size of the range, which would otherwise
+    ///     pay for a check on every access.
+    ///     - Indexing with an index that is greater than or equal to size()
+    ///       is a contract violation. It is caught in debug mode, but in
+    ///       release mode, no check is performed. Always loop up to size().
+    ///     - A checked_range cannot be copied or moved. It can only live in
+    ///       the scope that created it, so it is harder to keep it around
+    ///       longer than the array it is viewing.
+    ///     - A checked_range created from an invalid view is empty.
+    ///   @include example_checked_range_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of element being viewed.
+    ///
+    template<typename T>
+    class checked_range final
+    {
+        /// @brief stores a pointer to the array being viewed
+        T *m_ptr;
+        /// @brief stores the number of elements in the array being viewed
+        bsl::uintmx m_count;
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+        /// @brief alias for: safe_umx
+        using size_type = safe_umx;
+        /// @brief alias for: safe_idx
+        using index_type = safe_idx;
+        /// @brief alias for: T &
+        using reference_type = T &;
+        /// @brief alias for: T const &
+        using const_reference_type = T const &;
+        /// @brief alias for: T *
+        using pointer_type = T *;
+        /// @brief alias for: T const *
+        using const_pointer_type = T const *;
+
+        /// <!-- description -->
+        ///   @brief Creates a checked_range given a pointer to an array,
+        ///     and the number of elements in the array. Note that you
+        ///     should not use this directly but instead, should use a
+        ///     view's unchecked_view() function. If pudm_ptr is a nullptr,
+        ///     the range is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pudm_ptr a pointer to the array being viewed
+        ///   @param count the number of elements in the array being viewed
+        ///
+        explicit constexpr checked_range(
+            pointer_type const pudm_ptr, size_type const &count) noexcept    // --
+            : m_ptr{pudm_ptr}, m_count{}
+        {
+            if (unlikely(nullptr == pudm_ptr)) {
+                return;
+            }
+
+            expects(count.is_valid_and_checked());
+            m_count = count.get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::checked_range
+        ///
+        constexpr ~checked_range() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr checked_range(checked_range const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr checked_range(checked_range &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(checked_range const &o) &noexcept
+            -> checked_range & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(checked_range &&mut_o) &noexcept
+            -> checked_range & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns a reference to the instance of T stored at
+        ///     index "index". The index must be less than size(). This
+        ///     is only checked in debug mode.
+        ///   @include checked_range/example_checked_range_operator_index.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the instance to return
+        ///   @return Returns a reference to the instance of T stored at
+        ///     index "index".
+        ///
+        [[nodiscard]] constexpr auto
+        operator[](index_type const &index) noexcept -> reference_type
+        {
+            expects(index.is_valid());
+            expects(index < this->size());
+
+            return m_ptr[index.get()];
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a reference to the instance of T stored at
+        ///     index "index". The index must be less than size(). This
+        ///     is only checked in debug mode.
+        ///   @include checked_range/example_checked_range_operator_index.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the instance to return
+        ///   @return Returns a reference to the instance of T stored at
+        ///     index "index".
+        ///
+        [[nodiscard]] constexpr auto
+        operator[](index_type const &index) const noexcept -> const_reference_type
+        {
+            expects(index.is_valid());
+            expects(index < this->size());
+
+            return m_ptr[index.get()];
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the array being viewed. If the
+        ///     range was created from an invalid view, this will return
+        ///     a nullptr.
+        ///   @include checked_range/example_checked_range_data.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the array being viewed. If the
+        ///     range was created from an invalid view, this will return
+        ///     a nullptr.
+        ///
+        [[nodiscard]] constexpr auto
+        data() noexcept -> pointer_type
+        {
+            return m_ptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the array being viewed. If the
+        ///     range was created from an invalid view, this will return
+        ///     a nullptr.
+        ///   @include checked_range/example_checked_range_data.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the array being viewed. If the
+        ///     range was created from an invalid view, this will return
+        ///     a nullptr.
+        ///
+        [[nodiscard]] constexpr auto
+        data() const noexcept -> const_pointer_type
+        {
+            return m_ptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns size().is_zero()
+        ///   @include checked_range/example_checked_range_empty.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns size().is_zero()
+        ///
+        [[nodiscard]] constexpr auto
+        empty() const noexcept -> bool
+        {
+            return this->size().is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of elements in the array being
+        ///     viewed. This is the bound that every index must be less
+        ///     than.
+        ///   @include checked_range/example_checked_range_size.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of elements in the array being
+        ///     viewed.
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> size_type
+        {
+            return size_type{m_count};
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Creates user-defined deduction guide for U *
+    ///
+    template<typename U>
+    checked_range(U *, bsl::safe_umx const &) -> checked_range<U>;
+}
+
+#endif
@@ -64,6 +64,12 @@ namespace bsl
     ///     - We don't implement all of the iterator functions that make up
     ///       a contiguous iterator as defined by the C++ spec. Some of these
     ///       can be added in future upon request.
+    ///     - In release mode, the bounds are checked once when the iterator
+    ///       is created, and from then on, the iterator is a bare pointer
+    ///       into the array. Incrementing past end() or decrementing past
+    ///       the beginning of the array is only caught in debug mode. This
+    ///       allows a loop over a view's begin() and end() to compile down
+    ///       to the same code as a raw loop (including auto-vectorization).
     ///   @include example_contiguous_iterator_overview.hpp
     ///
     /// <!-- template parameters -->
@@ -105,17 +111,27 @@ namespace bsl
             pointer_type const pudm_ptr,    // --
             size_type const &count,         // --
             index_type const &i) noexcept
-            : m_ptr{pudm_ptr}, m_count{count}, m_i{i}
+            : m_ptr{pudm_ptr}, m_count{count}
         {
             if (unlikely(nullptr == pudm_ptr)) {
                 m_count = {};
-                m_i = {};
                 return;
             }
 
             expects(count.is_valid_and_checked());
             expects(i.is_valid());
             expects(i <= count);
+
+#if BSL_RELEASE_MODE
+            if (unlikely(i > count)) {
+                m_cur = &m_ptr[count.get()];
+            }
+            else {
+                m_cur = &m_ptr[i.get()];
+            }
+#else
+            m_i = i;
+#endif
         }
 
         /// <!-- description -->
@@ -209,13 +225,18 @@ namespace bsl
         ///
         [[nodiscard]] constexpr auto
         // NOLINTNEXTLINE(bsl-using-ident-unique-namespace)
-        index() const noexcept -> index_type const &
+        index() const noexcept -> index_type
         {
+#if BSL_RELEASE_MODE
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return index_type{static_cast<bsl::uintmx>(m_cur - m_ptr)};
+#else
             ensures(m_i.is_valid());
             ensures(m_i <= m_count);
             ensures(m_i >= index_type::magic_0());
 
             return m_i;
+#endif
         }
 
         /// <!-- description -->
@@ -288,11 +309,19 @@ namespace bsl
                 return nullptr;
             }
 
+#if BSL_RELEASE_MODE
+            if (unlikely(this->index() >= m_count)) {
+                return nullptr;
+            }
+
+            return m_cur;
+#else
             if (unlikely(m_i >= m_count)) {
                 return nullptr;
             }
 
             return &m_ptr[m_i.get()];
+#endif
         }
 
         /// <!-- description -->
@@ -313,11 +342,19 @@ namespace bsl
                 return nullptr;
             }
 
+#if BSL_RELEASE_MODE
+            if (unlikely(this->index() >= m_count)) {
+                return nullptr;
+            }
+
+            return m_cur;
+#else
             if (unlikely(m_i >= m_count)) {
                 return nullptr;
             }
 
             return &m_ptr[m_i.get()];
+#endif
         }
 
         /// <!-- description -->
@@ -330,7 +367,11 @@ namespace bsl
         [[nodiscard]] constexpr auto
         operator*() noexcept -> value_type &
         {
+#if BSL_RELEASE_MODE
+            return *m_cur;
+#else
             return m_ptr[m_i.get()];
+#endif
         }
 
         /// <!-- description -->
@@ -343,7 +384,11 @@ namespace bsl
         [[nodiscard]] constexpr auto
         operator*() const noexcept -> value_type const &
         {
+#if BSL_RELEASE_MODE
+            return *m_cur;
+#else
             return m_ptr[m_i.get()];
+#endif
         }
 
         /// <!-- description -->
@@ -356,6 +401,20 @@ namespace bsl
         [[maybe_unused]] constexpr auto
         operator++() noexcept -> contiguous_iterator &
         {
+#if BSL_RELEASE_MODE
+            /// NOTE:
+            /// - The iterator is clamped to end() the same way it is in debug
+            ///   mode, using a compare and select instead of a branch. In a
+            ///   loop, the compare is the same as the loop's own check
+            ///   against end(), so the compiler can usually merge the two.
+            ///
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            pointer_type const end{m_ptr + m_count.get()};
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            m_cur = (m_cur != end) ? (m_cur + 1) : end;
+            return *this;
+#else
             if (unlikely(m_i >= m_count)) {
                 return *this;
             }
@@ -365,6 +424,7 @@ namespace bsl
             ensures(m_i.is_valid());
             ensures(m_i <= m_count);
             return *this;
+#endif
         }
 
         /// <!-- description -->
@@ -377,6 +437,16 @@ namespace bsl
         [[maybe_unused]] constexpr auto
         operator--() noexcept -> contiguous_iterator &
         {
+#if BSL_RELEASE_MODE
+            /// NOTE:
+            /// - The iterator is clamped to begin() the same way it is in
+            ///   debug mode (see operator++).
+            ///
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            m_cur = (m_cur != m_ptr) ? (m_cur - 1) : m_ptr;
+            return *this;
+#else
             if (unlikely(m_i.is_zero())) {
                 return *this;
             }
@@ -386,6 +456,7 @@ namespace bsl
             ensures(m_i.is_valid());
             ensures(m_i >= index_type::magic_0());
             return *this;
+#endif
         }
 
     private:
@@ -393,8 +464,13 @@ namespace bsl
         pointer_type m_ptr;
         /// @brief stores the number of elements in the array being iterated
         size_type m_count;
+#if BSL_RELEASE_MODE
+        /// @brief stores a pointer to the current element being iterated
+        pointer_type m_cur{};
+#else
         /// @brief stores the current index in the array being iterated
-        index_type m_i;
+        index_type m_i{};
+#endif
     };
 
     /// <!-- description -->
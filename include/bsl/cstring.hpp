@@ -30,12 +30,15 @@
 
 #include "bsl/char_type.hpp"
 #include "bsl/cstr_type.hpp"
+#include "bsl/details/strlen_by_word.hpp"
 #include "bsl/discard.hpp"
 #include "bsl/expects.hpp"
 #include "bsl/is_constant_evaluated.hpp"
 #include "bsl/is_trivial.hpp"
+#include "bsl/npos.hpp"
 #include "bsl/safe_idx.hpp"
 #include "bsl/safe_integral.hpp"
+#include "bsl/touch.hpp"
 #include "bsl/unlikely.hpp"
 
 // Notes: --
@@ -71,12 +74,16 @@ namespace bsl
     {
         expects(nullptr != str);
 
-        bsl::safe_idx mut_len{};
-        while ('\0' != str[mut_len.get()]) {
-            ++mut_len;
+        if (is_constant_evaluated()) {
+            bsl::safe_idx mut_len{};
+            while ('\0' != str[mut_len.get()]) {
+                ++mut_len;
+            }
+
+            return safe_umx{mut_len.get()};
         }
 
-        return safe_umx{mut_len.get()};
+        return safe_umx{details::strlen_by_word(str)};
     }
 
     /// <!-- description -->
@@ -188,6 +195,94 @@ namespace bsl
         bsl::discard(__builtin_memcpy(pmut_dst, src, count.get()));
         return pmut_dst;
     }
+
+    /// <!-- description -->
+    ///   @brief Same as std::memchr with parameter checks, with the
+    ///     exception that the index of the first occurrence of ch is
+    ///     returned instead of a pointer to it. If ch does not occur in
+    ///     the first count chars of str, bsl::npos is returned.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str a pointer to the chars to search
+    ///   @param ch the char to search for
+    ///   @param count the total number of chars to search
+    ///   @return Returns the index of the first occurrence of ch, or
+    ///     bsl::npos if ch does not occur.
+    ///
+    [[nodiscard]] constexpr auto
+    builtin_memchr(cstr_type const str, char_type const ch, safe_umx const &count) noexcept
+        -> safe_idx
+    {
+        expects(nullptr != str);
+        expects(count.is_valid_and_checked());
+
+        if (is_constant_evaluated()) {
+            for (safe_idx mut_i{}; mut_i < count; ++mut_i) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                if (ch == str[mut_i.get()]) {
+                    return mut_i;
+                }
+
+                bsl::touch();
+            }
+
+            return npos;
+        }
+
+        /// NOTE:
+        /// - At runtime this is forwarded to a memchr function which either
+        ///   the compiler will provide, or the user will have to provide,
+        ///   which should scan more than one char at a time.
+        ///
+
+        auto const *const ptr{static_cast<cstr_type>(__builtin_memchr(str, ch, count.get()))};
+        if (nullptr == ptr) {
+            return npos;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return safe_idx{static_cast<bsl::uintmx>(ptr - str)};
+    }
+
+    /// <!-- description -->
+    ///   @brief Same as std::memcmp with parameter checks. Compares the
+    ///     first count chars of lhs and rhs (as unsigned chars), returning
+    ///     0 if they are the same, a negative value if lhs compares less
+    ///     than rhs, and a positive value otherwise.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param lhs a pointer to the left hand side of the comparison
+    ///   @param rhs a pointer to the right hand side of the comparison
+    ///   @param count the total number of chars to compare
+    ///   @return Returns the same result as std::memcmp.
+    ///
+    [[nodiscard]] constexpr auto
+    builtin_memcmp(cstr_type const lhs, cstr_type const rhs, safe_umx const &count) noexcept
+        -> bsl::int32
+    {
+        expects(nullptr != lhs);
+        expects(nullptr != rhs);
+        expects(count.is_valid_and_checked());
+
+        if (is_constant_evaluated()) {
+            for (safe_idx mut_i{}; mut_i < count; ++mut_i) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                auto const l{static_cast<bsl::uint8>(lhs[mut_i.get()])};
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                auto const r{static_cast<bsl::uint8>(rhs[mut_i.get()])};
+
+                if (l != r) {
+                    return static_cast<bsl::int32>(l) - static_cast<bsl::int32>(r);
+                }
+
+                bsl::touch();
+            }
+
+            return static_cast<bsl::int32>(0);
+        }
+
+        return __builtin_memcmp(lhs, rhs, count.get());
+    }
 }
 
 #endif
@@ -33,6 +33,7 @@
 #include "bsl/conditional.hpp"
 #include "bsl/debug_levels.hpp"              // IWYU pragma: export
 #include "bsl/details/out.hpp"               // IWYU pragma: export
+#include "bsl/details/out_buffer.hpp"
 #include "bsl/details/out_type_alert.hpp"    // IWYU pragma: export
 #include "bsl/details/out_type_debug.hpp"    // IWYU pragma: export
 #include "bsl/details/out_type_empty.hpp"    // IWYU pragma: export
@@ -88,7 +89,21 @@ namespace bsl
     {
         // False positive
         // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-        return details::out_type<DL, details::out_type_print>{};
+        details::out_type<DL, details::out_type_print> const o{};
+
+        if (is_constant_evaluated()) {
+            return o;
+        }
+
+        if constexpr (o.empty()) {
+            return o;
+        }
+
+        if constexpr (details::OUT_BUFFER_ENABLED) {
+            details::out_buffer_this_thread()->set_level(DL);
+        }
+
+        return o;
     }
 
     /// <!-- description -->
@@ -120,6 +135,10 @@ namespace bsl
             return o;
         }
 
+        if constexpr (details::OUT_BUFFER_ENABLED) {
+            details::out_buffer_this_thread()->set_level(DL);
+        }
+
         o << bsl::bold_grn << "DEBUG" << bsl::rst;
         details::print_thread_id(o);
         o << ": ";
@@ -156,6 +175,10 @@ namespace bsl
             return o;
         }
 
+        if constexpr (details::OUT_BUFFER_ENABLED) {
+            details::out_buffer_this_thread()->set_level(DL);
+        }
+
         o << bsl::bold_ylw << "ALERT" << bsl::rst;
         details::print_thread_id(o);
         o << ": ";
@@ -0,0 +1,87 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BSL_DETAILS_BINLOG_HPP
+#define BSL_DETAILS_BINLOG_HPP
+
+#include "../cstdint.hpp"
+
+namespace bsl::details
+{
+    /// NOTE:
+    /// - When BSL_BINARY_LOG is defined, bsl::out does not convert
+    ///   integrals to text. Instead, each integral (including the ones
+    ///   used to output pointers, bsl::errc_type and source locations) is
+    ///   written as a binary item, and everything else is written as text
+    ///   as usual. A binary item looks like this:
+    ///
+    ///     BINLOG_MARKER
+    ///     tag                    (BINLOG_TAG_xxx bits | sizeof(T))
+    ///     [fill, align, sign,    (only if BINLOG_TAG_OPS is set)
+    ///      flags, width_lo,
+    ///      width_hi, type]
+    ///     [raw bytes of T]       (only if BINLOG_TAG_POISONED is not set)
+    ///
+    /// - Text never contains a BINLOG_MARKER, as a literal NUL char
+    ///   (whether it is written on its own or inside of a string) is
+    ///   written as BINLOG_MARKER followed by BINLOG_TAG_NUL.
+    /// - The raw bytes of T are written in the native byte order, so the
+    ///   output must be decoded on a machine with the same byte order
+    ///   (see utils/binlog_decode).
+    ///
+
+#ifdef BSL_BINARY_LOG
+    /// @brief true if binary logging is enabled
+    constexpr bool BINLOG_ENABLED{true};
+#else
+    /// @brief true if binary logging is enabled
+    constexpr bool BINLOG_ENABLED{false};
+#endif
+
+    /// @brief defines the byte that starts a binary item
+    constexpr bsl::uint8 BINLOG_MARKER{static_cast<bsl::uint8>(0x00)};
+    /// @brief defines the bits of a tag that store sizeof(T)
+    constexpr bsl::uint8 BINLOG_TAG_SIZE_MASK{static_cast<bsl::uint8>(0x0F)};
+    /// @brief defines the tag bit that is set if T is signed
+    constexpr bsl::uint8 BINLOG_TAG_SIGNED{static_cast<bsl::uint8>(0x10)};
+    /// @brief defines the tag bit that is set if fmt_options follow
+    constexpr bsl::uint8 BINLOG_TAG_OPS{static_cast<bsl::uint8>(0x20)};
+    /// @brief defines the tag bit that is set if the integral was poisoned
+    constexpr bsl::uint8 BINLOG_TAG_POISONED{static_cast<bsl::uint8>(0x40)};
+    /// @brief defines the tag used to output a literal NUL char
+    constexpr bsl::uint8 BINLOG_TAG_NUL{static_cast<bsl::uint8>(0x80)};
+
+    /// @brief defines the flags bit used for fmt_options::alternate_form()
+    constexpr bsl::uint8 BINLOG_FLAG_ALTERNATE_FORM{static_cast<bsl::uint8>(0x01)};
+    /// @brief defines the flags bit used for fmt_options::sign_aware()
+    constexpr bsl::uint8 BINLOG_FLAG_SIGN_AWARE{static_cast<bsl::uint8>(0x02)};
+
+    /// @brief defines the total number of bytes used to store fmt_options
+    constexpr bsl::uintmx BINLOG_OPS_SIZE{static_cast<bsl::uintmx>(7)};
+    /// @brief defines the max total number of bytes a binary item can use
+    constexpr bsl::uintmx BINLOG_MAX_ITEM_SIZE{
+        static_cast<bsl::uintmx>(2) + BINLOG_OPS_SIZE + sizeof(bsl::uint64)};
+}
+
+#endif
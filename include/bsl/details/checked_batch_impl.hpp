@@ -0,0 +1,176 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file checked_batch_impl.hpp
+///
+
+#ifndef BSL_DETAILS_CHECKED_BATCH_IMPL_HPP
+#define BSL_DETAILS_CHECKED_BATCH_IMPL_HPP
+
+#include "../conditional.hpp"
+#include "../cstdint.hpp"
+#include "../is_signed.hpp"
+#include "../numeric_limits.hpp"
+#include "../safe_integral.hpp"
+
+namespace bsl::details
+{
+    /// @brief the max number of elements a sum adds without checking
+    constexpr bsl::uintmx CHECKED_BATCH_SUM_CHUNK{static_cast<bsl::uintmx>(0x80000000U)};
+    /// @brief the number of bits in each half of a 64 bit value
+    constexpr bsl::uint64 CHECKED_BATCH_HALF_BITS{static_cast<bsl::uint64>(32)};
+    /// @brief the mask for the low half of a 64 bit value
+    constexpr bsl::uint64 CHECKED_BATCH_LOW_MASK{static_cast<bsl::uint64>(0xFFFFFFFFU)};
+
+    /// <!-- description -->
+    ///   @brief Returns the number of elements a batch operation can be
+    ///     performed on given the size of the destination and of the two
+    ///     inputs. Returns bsl::safe_umx::failure() if the inputs are not
+    ///     the same size, or the destination is smaller than the inputs.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param dst the size of the destination
+    ///   @param lhs the size of the left hand side input
+    ///   @param rhs the size of the right hand side input
+    ///   @return Returns the number of elements a batch operation can be
+    ///     performed on, or bsl::safe_umx::failure() on error.
+    ///
+    [[nodiscard]] constexpr auto
+    batch_count(safe_umx const &dst, safe_umx const &lhs, safe_umx const &rhs) noexcept
+        -> safe_umx
+    {
+        if (lhs != rhs) {
+            return safe_umx::failure();
+        }
+
+        if (dst < lhs) {
+            return safe_umx::failure();
+        }
+
+        return lhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Sets mut_res to the sum of [ptr, ptr + count) and returns
+    ///     true if the sum does not fit in T. count must not be larger
+    ///     than CHECKED_BATCH_SUM_CHUNK. The sum is computed exactly
+    ///     using plain additions that cannot overflow, which the compiler
+    ///     can vectorize:
+    ///     - Types smaller than 64 bits are summed in 64 bits.
+    ///     - 64 bit types are split into a high and a low 32 bit half,
+    ///       and the halves are summed separately. Once the carry from
+    ///       the low halves is added to the high halves, the sum fits if
+    ///       and only if the high halves fit in 32 bits.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to sum
+    ///   @param ptr the values to sum
+    ///   @param count the number of values to sum
+    ///   @param mut_res the (wrapped) sum
+    ///   @return Returns true if the sum does not fit in T
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    batch_sum_chunk(T const *const ptr, bsl::uintmx const count, T &mut_res) noexcept -> bool
+    {
+        if constexpr (sizeof(T) < sizeof(bsl::uint64)) {
+            using wide_type = conditional_t<is_signed<T>::value, bsl::int64, bsl::uint64>;
+
+            wide_type mut_sum{};
+            for (bsl::uintmx mut_i{}; mut_i < count; ++mut_i) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                mut_sum += static_cast<wide_type>(ptr[mut_i]);
+            }
+
+            mut_res = static_cast<T>(mut_sum);
+
+            constexpr auto min{static_cast<wide_type>(numeric_limits<T>::min_value())};
+            constexpr auto max{static_cast<wide_type>(numeric_limits<T>::max_value())};
+            return (mut_sum < min) || (mut_sum > max);
+        }
+        else {
+            using high_type = conditional_t<is_signed<T>::value, bsl::int64, bsl::uint64>;
+
+            high_type mut_high{};
+            bsl::uint64 mut_low{};
+            for (bsl::uintmx mut_i{}; mut_i < count; ++mut_i) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                auto const val{ptr[mut_i]};
+                mut_high += static_cast<high_type>(val >> CHECKED_BATCH_HALF_BITS);
+                mut_low += static_cast<bsl::uint64>(val) & CHECKED_BATCH_LOW_MASK;
+            }
+
+            mut_high += static_cast<high_type>(mut_low >> CHECKED_BATCH_HALF_BITS);
+            mut_low &= CHECKED_BATCH_LOW_MASK;
+
+            auto const high_bits{static_cast<bsl::uint64>(mut_high) << CHECKED_BATCH_HALF_BITS};
+            mut_res = static_cast<T>(high_bits | mut_low);
+
+            if constexpr (is_signed<T>::value) {
+                constexpr auto min{static_cast<high_type>(numeric_limits<bsl::int32>::min_value())};
+                constexpr auto max{static_cast<high_type>(numeric_limits<bsl::int32>::max_value())};
+                return (mut_high < min) || (mut_high > max);
+            }
+            else {
+                return mut_high > CHECKED_BATCH_LOW_MASK;
+            }
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Performs mut_dst[i] = op(lhs[i], rhs[i]) for each i in
+    ///     [0, count) and returns true if any of the operations
+    ///     overflowed. The overflow flags are OR'd together rather than
+    ///     checked one at a time, so the loop has no branches.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values being operated on
+    ///   @tparam OP the type of operation to perform
+    ///   @param pmut_dst the destination of the results
+    ///   @param lhs the left hand side of each operation
+    ///   @param rhs the right hand side of each operation
+    ///   @param count the number of elements to operate on
+    ///   @param op the operation to perform
+    ///   @return Returns true if any of the operations overflowed
+    ///
+    template<typename T, typename OP>
+    [[nodiscard]] constexpr auto
+    batch_apply(
+        T *const pmut_dst,
+        T const *const lhs,
+        T const *const rhs,
+        bsl::uintmx const count,
+        OP const op) noexcept -> bool
+    {
+        bsl::uintmx mut_overflow{};
+        for (bsl::uintmx mut_i{}; mut_i < count; ++mut_i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            mut_overflow |= static_cast<bsl::uintmx>(op(lhs[mut_i], rhs[mut_i], pmut_dst[mut_i]));
+        }
+
+        return static_cast<bsl::uintmx>(0) != mut_overflow;
+    }
+}
+
+#endif
@@ -0,0 +1,64 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#ifndef BSL_DETAILS_CPU_RELAX_HPP
+#define BSL_DETAILS_CPU_RELAX_HPP
+
+#include "../cstdint.hpp"
+
+namespace bsl::details
+{
+    /// <!-- description -->
+    ///   @brief Tells the CPU that the calling thread is spinning on a
+    ///     lock. On x86 this is a pause, and on AArch64 it is a yield.
+    ///     This saves power and lets a sibling hyperthread run instead.
+    ///     It does not give up the CPU to the OS.
+    ///
+    inline void
+    cpu_relax() noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        __builtin_arm_yield();
+#endif
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the current value of the CPU's cycle counter
+    ///     (e.g., the TSC on x86). Only the difference between two
+    ///     calls on the same CPU has any meaning.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the current value of the CPU's cycle counter
+    ///
+    [[nodiscard]] inline auto
+    cpu_cycles() noexcept -> bsl::uint64
+    {
+        return static_cast<bsl::uint64>(__builtin_readcyclecounter());
+    }
+}
+
+#endif
@@ -0,0 +1,141 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BSL_DETAILS_FMT_IMPL_BINLOG_HPP
+#define BSL_DETAILS_FMT_IMPL_BINLOG_HPP
+
+#include "../carray.hpp"
+#include "../char_type.hpp"
+#include "../cstdint.hpp"
+#include "../discard.hpp"
+#include "../fmt_options.hpp"
+#include "../is_signed.hpp"
+#include "../safe_integral.hpp"
+#include "../touch.hpp"
+#include "binlog.hpp"
+#include "out.hpp"
+
+namespace bsl::details
+{
+    /// <!-- description -->
+    ///   @brief Writes an integral to the provided out as a binary item
+    ///     instead of converting it to text (see binlog.hpp for the
+    ///     format). Nothing but a few byte stores and a memcpy are needed,
+    ///     which is why this is used when BSL_BINARY_LOG is defined.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam OUT_T the type of out (i.e., debug, alert, etc)
+    ///   @tparam T the type of integral to output
+    ///   @param o the instance of out<T> to output to
+    ///   @param ops the fmt options used to format the output, or a
+    ///     nullptr if the integral was not outputted using bsl::fmt
+    ///   @param val the integral being outputted
+    ///
+    template<typename OUT_T, typename T>
+    constexpr void
+    fmt_impl_binlog(
+        out<OUT_T> const o, fmt_options const *const ops, safe_integral<T> const &val) noexcept
+    {
+        carray<char_type, BINLOG_MAX_ITEM_SIZE> mut_buf{};
+        bsl::uintmx mut_size{};
+
+        auto mut_tag{static_cast<bsl::uint8>(sizeof(T))};
+        if constexpr (is_signed<T>::value) {
+            mut_tag |= BINLOG_TAG_SIGNED;
+        }
+
+        if (nullptr != ops) {
+            mut_tag |= BINLOG_TAG_OPS;
+        }
+        else {
+            bsl::touch();
+        }
+
+        auto mut_val{val};
+        if (mut_val.is_poisoned()) {
+            mut_tag |= BINLOG_TAG_POISONED;
+        }
+        else {
+            bsl::touch();
+        }
+
+        *mut_buf.at_if(mut_size) = static_cast<char_type>(BINLOG_MARKER);
+        ++mut_size;
+        *mut_buf.at_if(mut_size) = static_cast<char_type>(mut_tag);
+        ++mut_size;
+
+        if (nullptr != ops) {
+            constexpr auto byte_mask{static_cast<bsl::uintmx>(0xFF)};
+            constexpr auto byte_bits{static_cast<bsl::uintmx>(8)};
+
+            bsl::uint8 mut_flags{};
+            if (ops->alternate_form()) {
+                mut_flags |= BINLOG_FLAG_ALTERNATE_FORM;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (ops->sign_aware()) {
+                mut_flags |= BINLOG_FLAG_SIGN_AWARE;
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const width{ops->width().get()};
+
+            *mut_buf.at_if(mut_size) = ops->fill();
+            ++mut_size;
+            *mut_buf.at_if(mut_size) = static_cast<char_type>(ops->align());
+            ++mut_size;
+            *mut_buf.at_if(mut_size) = static_cast<char_type>(ops->sign());
+            ++mut_size;
+            *mut_buf.at_if(mut_size) = static_cast<char_type>(mut_flags);
+            ++mut_size;
+            *mut_buf.at_if(mut_size) = static_cast<char_type>(width & byte_mask);
+            ++mut_size;
+            *mut_buf.at_if(mut_size) = static_cast<char_type>((width >> byte_bits) & byte_mask);
+            ++mut_size;
+            *mut_buf.at_if(mut_size) = static_cast<char_type>(ops->type());
+            ++mut_size;
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (!mut_val.is_poisoned()) {
+            auto const raw{mut_val.get()};
+            bsl::discard(__builtin_memcpy(mut_buf.at_if(mut_size), &raw, sizeof(T)));
+            mut_size += sizeof(T);
+        }
+        else {
+            bsl::touch();
+        }
+
+        o.write_binlog_item(mut_buf.data(), mut_size);
+    }
+}
+
+#endif
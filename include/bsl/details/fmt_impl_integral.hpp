@@ -38,7 +38,9 @@
 #include "../safe_integral.hpp"
 #include "../touch.hpp"
 #include "../unlikely.hpp"
+#include "binlog.hpp"
 #include "fmt_impl_align.hpp"
+#include "fmt_impl_binlog.hpp"
 #include "fmt_impl_integral_helpers.hpp"
 #include "out.hpp"
 
@@ -163,7 +165,8 @@ namespace bsl
 
     /// <!-- description -->
     ///   @brief Outputs the provided integral to the provided
-    ///     output type.
+    ///     output type. If BSL_BINARY_LOG is defined, the integral is
+    ///     written as a binary item instead of being converted to text.
     ///
     /// <!-- inputs/outputs -->
     ///   @tparam OUT_T the type of outputter provided
@@ -184,6 +187,11 @@ namespace bsl
             return o;
         }
 
+        if constexpr (details::BINLOG_ENABLED) {
+            details::fmt_impl_binlog(o, nullptr, val);
+            return o;
+        }
+
         auto mut_val{val};
         if (unlikely(mut_val.is_poisoned())) {
             constexpr bsl::cstr_type msg{"[error]"};
@@ -206,10 +214,7 @@ namespace bsl
             }
         }
 
-        for (safe_idx mut_i{info.digits}; mut_i.is_pos(); --mut_i) {
-            o.write_to_console(*info.buf.at_if((mut_i - safe_idx::magic_1()).get()));
-        }
-
+        o.write_to_console(info.data(), info.digits.get());
         return o;
     }
 
@@ -34,7 +34,9 @@
 #include "../safe_idx.hpp"
 #include "../safe_integral.hpp"
 #include "../touch.hpp"
+#include "binlog.hpp"
 #include "fmt_impl_align.hpp"
+#include "fmt_impl_binlog.hpp"
 #include "fmt_impl_integral_info.hpp"
 #include "out.hpp"
 
@@ -91,6 +93,152 @@ namespace bsl::details
         return base10;
     }
 
+    /// <!-- description -->
+    ///   @brief Returns a table of all of the two digit pairs from "00"
+    ///     to "99", which is used to convert to base 10 two digits at a
+    ///     time.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns a table of all of the two digit pairs from "00"
+    ///     to "99"
+    ///
+    [[nodiscard]] constexpr auto
+    make_fmt_digit_pairs() noexcept -> carray<char_type, FMT_DIGIT_PAIRS_SIZE>
+    {
+        constexpr bsl::uintmx base10{static_cast<bsl::uintmx>(10)};
+        carray<char_type, FMT_DIGIT_PAIRS_SIZE> mut_pairs{};
+
+        for (bsl::uintmx mut_i{}; mut_i < FMT_DIGIT_PAIRS_SIZE; mut_i += FMT_DIGIT_PAIR_SIZE) {
+            auto const pair{mut_i / FMT_DIGIT_PAIR_SIZE};
+            *mut_pairs.at_if(mut_i) = static_cast<char_type>('0' + (pair / base10));
+            *mut_pairs.at_if(mut_i + 1U) = static_cast<char_type>('0' + (pair % base10));
+        }
+
+        return mut_pairs;
+    }
+
+    /// @brief stores all of the two digit pairs from "00" to "99"
+    constexpr carray<char_type, FMT_DIGIT_PAIRS_SIZE> FMT_DIGIT_PAIRS{make_fmt_digit_pairs()};
+    /// @brief stores the digits used to convert to base 2 and base 16
+    constexpr carray<char_type, FMT_HEX_DIGITS_SIZE> FMT_HEX_DIGITS{
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+
+    /// <!-- description -->
+    ///   @brief Returns the absolute value of the provided integral as a
+    ///     bsl::uint64. Unlike -val, this works for min() as well.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral to convert
+    ///   @param val the integral to convert
+    ///   @return Returns the absolute value of the provided integral
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    get_integral_magnitude(safe_integral<T> const &val) noexcept -> bsl::uint64
+    {
+        /// NOTE:
+        /// - The math here is supposed to wrap. Converting a negative
+        ///   integral to a bsl::uint64 and then subtracting it from 0
+        ///   gives the two's complement magnitude, which always fits.
+        ///
+
+        if constexpr (is_signed<T>::value) {
+            if (val.is_neg()) {
+                return static_cast<bsl::uint64>(0) - static_cast<bsl::uint64>(val.get());
+            }
+
+            return static_cast<bsl::uint64>(val.get());
+        }
+        else {
+            return static_cast<bsl::uint64>(val.get());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Converts the provided magnitude to base 10, two digits
+    ///     at a time, storing the digits at the end of mut_info.buf.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mag the magnitude to convert (cannot be 0)
+    ///   @param mut_info where to store the digits
+    ///
+    constexpr void
+    get_integral_info_base10(bsl::uint64 const mag, fmt_impl_integral_info &mut_info) noexcept
+    {
+        constexpr bsl::uint64 base10{static_cast<bsl::uint64>(10)};
+        constexpr bsl::uint64 base100{static_cast<bsl::uint64>(100)};
+
+        /// NOTE:
+        /// - All of the math below is done on a raw unsigned integral
+        ///   instead of a safe_integral. None of it can overflow, as the
+        ///   value only ever gets smaller and the buffer is larger than
+        ///   the max number of digits any integral can have.
+        ///
+
+        auto mut_val{mag};
+        auto mut_pos{mut_info.buf.size()};
+
+        while (mut_val >= base100) {
+            auto const pair{(mut_val % base100) * FMT_DIGIT_PAIR_SIZE};
+            mut_val /= base100;
+
+            mut_pos -= FMT_DIGIT_PAIR_SIZE;
+            *mut_info.buf.at_if(mut_pos) = *FMT_DIGIT_PAIRS.at_if(pair);
+            *mut_info.buf.at_if(mut_pos + 1U) = *FMT_DIGIT_PAIRS.at_if(pair + 1U);
+        }
+
+        if (mut_val >= base10) {
+            auto const pair{mut_val * FMT_DIGIT_PAIR_SIZE};
+            mut_pos -= FMT_DIGIT_PAIR_SIZE;
+            *mut_info.buf.at_if(mut_pos) = *FMT_DIGIT_PAIRS.at_if(pair);
+            *mut_info.buf.at_if(mut_pos + 1U) = *FMT_DIGIT_PAIRS.at_if(pair + 1U);
+        }
+        else {
+            --mut_pos;
+            *mut_info.buf.at_if(mut_pos) = static_cast<char_type>('0' + mut_val);
+        }
+
+        mut_info.digits = safe_idx{mut_info.buf.size() - mut_pos};
+    }
+
+    /// <!-- description -->
+    ///   @brief Converts the provided magnitude to a power of 2 base
+    ///     (i.e., base 2 or base 16) using shifts and masks, storing the
+    ///     digits at the end of mut_info.buf. The total number of digits
+    ///     is calculated up front by counting the leading zeros.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mag the magnitude to convert (cannot be 0)
+    ///   @param bits the total number of bits in each digit (1 or 4)
+    ///   @param mut_info where to store the digits
+    ///
+    constexpr void
+    get_integral_info_base2n(
+        bsl::uint64 const mag, bsl::uintmx const bits, fmt_impl_integral_info &mut_info) noexcept
+    {
+        constexpr bsl::uintmx total_bits{static_cast<bsl::uintmx>(64)};
+        auto const mask{(static_cast<bsl::uint64>(1) << bits) - static_cast<bsl::uint64>(1)};
+
+        /// NOTE:
+        /// - mag cannot be 0, so __builtin_clzll is well defined. The
+        ///   rest of the math is on raw unsigned integrals and cannot
+        ///   overflow for the same reasons as the base 10 version.
+        ///
+
+        auto const used_bits{total_bits - static_cast<bsl::uintmx>(__builtin_clzll(mag))};
+        auto const digits{(used_bits + bits - 1U) / bits};
+
+        auto mut_val{mag};
+        auto mut_pos{mut_info.buf.size()};
+        for (bsl::uintmx mut_i{}; mut_i < digits; ++mut_i) {
+            --mut_pos;
+            *mut_info.buf.at_if(mut_pos) = *FMT_HEX_DIGITS.at_if(mut_val & mask);
+            mut_val >>= bits;
+        }
+
+        mut_info.digits = safe_idx{digits};
+    }
+
     /// <!-- description -->
     ///   @brief This function gathers information about an integral
     ///     number which is used by fmt_impl_integral. Specifically:
@@ -102,15 +250,14 @@ namespace bsl::details
     ///       includes things like "0x" and +/-. All of these
     ///       extra characters consume characters from any "width" the
     ///       user might have provided and need to be accounted for.
-    ///     - The fmt_impl_integral function use a common divide by base
-    ///       approach to convert a number to a string. This approach
-    ///       converts the number in reverse order, so the characters
-    ///       must be stored in a buffer and then outputted in reverse
-    ///       order.
-    ///     - The buffer that we store the digits in (which is in reverse
-    ///       order as stated above) is a simple C-style array and not a
-    ///       bsl::array as the bsl::array depends on this functionality
-    ///       which would create a circular reference.
+    ///     - Base 10 is converted two digits at a time using a lookup
+    ///       table, and base 2 and 16 are converted using shifts and
+    ///       masks. Either way, the digits are stored in order at the
+    ///       end of the buffer so that they can be outputted using a
+    ///       single write (see fmt_impl_integral_info::data()).
+    ///     - The buffer that we store the digits in is a simple C-style
+    ///       array and not a bsl::array as the bsl::array depends on
+    ///       this functionality which would create a circular reference.
     ///     - The total number of digits that the number will consume
     ///       must also be recorded. This prevents the need to add a 0
     ///       at the end of the buffer.
@@ -126,21 +273,19 @@ namespace bsl::details
     get_integral_info(fmt_options const &ops, safe_integral<T> const &val) noexcept
         -> fmt_impl_integral_info
     {
-        constexpr safe_integral<T> base10{static_cast<T>(10)};
-        constexpr safe_integral<T> last_numerical_digit{static_cast<T>(9)};
+        constexpr safe_integral<T> base2{static_cast<T>(2)};
+        constexpr safe_integral<T> base16{static_cast<T>(16)};
+        constexpr bsl::uintmx bits2{static_cast<bsl::uintmx>(1)};
+        constexpr bsl::uintmx bits16{static_cast<bsl::uintmx>(4)};
 
         fmt_impl_integral_info mut_info{};
         auto const base{get_integral_info_base<T>(ops, mut_info)};
 
         /// NOTE:
         /// - The provided val must be valid before this function is called,
-        ///   otherwise the results are undefined. We also convert val from
-        ///   a potential index type to a non-index type (if it is one). This
-        ///   way we can work on it without breaking the safe_integral rules
-        ///   and it simplifies how this works.
+        ///   otherwise the results are undefined.
         ///
 
-        safe_integral<T> mut_val{val.get()};
         switch (ops.sign()) {
             case fmt_sign::fmt_sign_pos_neg:
                 [[fallthrough]];
@@ -153,7 +298,7 @@ namespace bsl::details
                 [[fallthrough]];
             default: {
                 if constexpr (is_signed<T>::value) {
-                    if (mut_val.is_neg()) {
+                    if (val.is_neg()) {
                         ++mut_info.extras;
                     }
                     else {
@@ -165,65 +310,21 @@ namespace bsl::details
             }
         }
 
-        if (mut_val.is_zero()) {
-            ++mut_info.digits;
+        auto const mag{get_integral_magnitude(val)};
+        if (static_cast<bsl::uint64>(0) == mag) {
+            *mut_info.buf.at_if(mut_info.buf.size() - 1U) = '0';
+            mut_info.digits = safe_idx::magic_1();
             return mut_info;
         }
 
-        /// NOTE:
-        /// - The buffer is large enough that it will never overflow, so we
-        ///   check for 0 in the for loop instead. This can be seen in the
-        ///   unit tests as the case where the buffer would overflow is
-        ///   impossible to hit with any tests given to it.
-        ///
-
-        for (mut_info.digits = {}; !mut_val.checked().is_zero(); ++mut_info.digits) {
-            /// NOTE:
-            /// - Base cannot be 0. As stated above, we assume that the
-            ///   provided val is valid, so the results of this math must
-            ///   also be valid which is why it is marked as checked.
-            ///
-
-            safe_integral<T> mut_digit{(mut_val % base).checked()};
-            mut_val = (mut_val / base).checked();
-
-            /// NOTE:
-            /// - If the provided val is negative, we cannot simply swap
-            ///   it's whole val because if it is min(), such a swap would
-            ///   result in overflow. So we need to negate each digit.
-            ///   Since each digit is the result of division, it will
-            ///   always be smaller than the provided type's max(), and
-            ///   there fore doing the negation is safe which is why it
-            ///   is marked as checked.
-            ///
-
-            if constexpr (is_signed<T>::value) {
-                if (mut_digit.is_neg()) {
-                    mut_digit = (-mut_digit).checked();
-                }
-                else {
-                    bsl::touch();
-                }
-            }
-
-            if (mut_digit > last_numerical_digit) {
-                mut_digit -= base10;
-                mut_digit += static_cast<T>('A');
-            }
-            else {
-                mut_digit += static_cast<T>('0');
-            }
-
-            /// NOTE:
-            /// - Since the highest value that we support is a 16bit
-            ///   integral, even if the provided val is 8bits, we are
-            ///   only using the bottom half of the ASCII table, so
-            ///   the math above cannot overflow which is why we mark
-            ///   it as checked.
-            ///
-
-            *mut_info.buf.at_if(mut_info.digits.get()) =
-                static_cast<char_type>(mut_digit.checked().get());
+        if (base == base16) {
+            get_integral_info_base2n(mag, bits16, mut_info);
+        }
+        else if (base == base2) {
+            get_integral_info_base2n(mag, bits2, mut_info);
+        }
+        else {
+            get_integral_info_base10(mag, mut_info);
         }
 
         return mut_info;
@@ -232,7 +333,9 @@ namespace bsl::details
     /// <!-- description -->
     ///   @brief This function is responsible for implementing the guts
     ///     for integral types. For integrals, all of the fmt options
-    ///     must be accounted for.
+    ///     must be accounted for. If BSL_BINARY_LOG is defined, the
+    ///     integral and its fmt options are written as a binary item
+    ///     instead, and are formatted later by utils/binlog_decode.
     ///
     /// <!-- inputs/outputs -->
     ///   @tparam OUT_T the type of out (i.e., debug, alert, etc)
@@ -246,6 +349,11 @@ namespace bsl::details
     fmt_impl_integral(
         out<OUT_T> const o, fmt_options const &ops, safe_integral<T> const &val) noexcept
     {
+        if constexpr (BINLOG_ENABLED) {
+            fmt_impl_binlog(o, &ops, val);
+            return;
+        }
+
         auto const info{get_integral_info(ops, val)};
         safe_umx const len{(info.digits + info.extras).get()};
         auto const padding{fmt_impl_align_pre(o, ops, len, false)};
@@ -334,15 +442,7 @@ namespace bsl::details
             bsl::touch();
         }
 
-        if (val.is_zero()) {
-            o.write_to_console('0');
-        }
-        else {
-            for (safe_idx mut_i{info.digits}; mut_i.is_pos(); --mut_i) {
-                o.write_to_console(*info.buf.at_if((mut_i - safe_idx::magic_1()).get()));
-            }
-        }
-
+        o.write_to_console(info.data(), info.digits.get());
         fmt_impl_align_suf(o, ops, len, false);
     }
 }
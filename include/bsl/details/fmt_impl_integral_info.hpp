@@ -34,6 +34,12 @@ namespace bsl::details
 {
     /// @brief stores the maximum number of digits.
     constexpr safe_umx MAX_NUM_DIGITS{static_cast<bsl::uintmx>(70)};
+    /// @brief stores the total number of chars in a two digit pair
+    constexpr bsl::uintmx FMT_DIGIT_PAIR_SIZE{static_cast<bsl::uintmx>(2)};
+    /// @brief stores the total number of chars in the two digit pair table
+    constexpr bsl::uintmx FMT_DIGIT_PAIRS_SIZE{static_cast<bsl::uintmx>(200)};
+    /// @brief stores the total number of chars in the hex digit table
+    constexpr bsl::uintmx FMT_HEX_DIGITS_SIZE{static_cast<bsl::uintmx>(16)};
 
     /// @class bsl::details::fmt_impl_integral_info
     ///
@@ -48,8 +54,22 @@ namespace bsl::details
         safe_idx extras{};
         /// @brief stores the total number digits that make up the integral
         safe_idx digits{};
-        /// @brief stores the integral as a string in reverse
+        /// @brief stores the integral as a string, right aligned in buf
         carray<char_type, MAX_NUM_DIGITS.get()> buf{};
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the first digit in buf. The
+        ///     digits are stored in order, so all of them can be
+        ///     outputted by writing "digits" chars starting here.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the first digit in buf
+        ///
+        [[nodiscard]] constexpr auto
+        data() const noexcept -> char_type const *
+        {
+            return buf.at_if(buf.size() - digits.get());
+        }
     };
 }
 
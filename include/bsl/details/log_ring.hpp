@@ -0,0 +1,417 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BSL_DETAILS_LOG_RING_HPP
+#define BSL_DETAILS_LOG_RING_HPP
+
+#include "../carray.hpp"
+#include "../char_type.hpp"
+#include "../cstdint.hpp"
+#include "../cstr_type.hpp"
+#include "../discard.hpp"
+#include "../touch.hpp"
+
+namespace bsl::details
+{
+    /// @brief defines the max number of chars a single log record can hold
+    constexpr bsl::uintmx LOG_RECORD_SIZE{static_cast<bsl::uintmx>(256)};
+    /// @brief defines the total number of records a log ring can hold (power of 2)
+    constexpr bsl::uintmx LOG_RING_SIZE{static_cast<bsl::uintmx>(64)};
+    /// @brief defines the total number of log rings (i.e., max producers)
+    constexpr bsl::uintmx LOG_RING_TOTAL{static_cast<bsl::uintmx>(16)};
+
+    /// @brief defines the mask used to turn a ring position into an index
+    constexpr bsl::uintmx LOG_RING_MASK{LOG_RING_SIZE - static_cast<bsl::uintmx>(1)};
+
+    static_assert(
+        static_cast<bsl::uintmx>(0) == (LOG_RING_SIZE & LOG_RING_MASK),
+        "LOG_RING_SIZE must be a power of 2");
+
+    /// @class bsl::details::log_record
+    ///
+    /// <!-- description -->
+    ///   @brief Stores a single line of output that was written to a
+    ///     log_ring, along with the global sequence number that was
+    ///     assigned to it and the debug level it was written with.
+    ///
+    class log_record final
+    {
+    public:
+        /// @brief stores the global sequence number of this record
+        bsl::uint64 m_seq{};
+        /// @brief stores the debug level this record was written with
+        bsl::uintmx m_level{};
+        /// @brief stores the total number of chars in m_data
+        bsl::uintmx m_size{};
+        /// @brief stores the chars of this record
+        carray<char_type, LOG_RECORD_SIZE> m_data{};
+    };
+
+    /// @class bsl::details::log_ring
+    ///
+    /// <!-- description -->
+    ///   @brief A lock-free, single-producer, single-consumer ring of
+    ///     log_records. The producer is the thread that owns the ring
+    ///     and the consumer is whoever calls bsl::log_drain(). The
+    ///     producer never blocks. If the ring is full, the record is
+    ///     dropped and counted instead. A thread claims a ring the first
+    ///     time it writes to one, and gives it back when it exits, so
+    ///     that another thread can claim it. Records that are still in
+    ///     a ring that was given back can still be drained.
+    ///
+    class log_ring final
+    {
+        /// @brief stores the records in this ring
+        carray<log_record, LOG_RING_SIZE> m_records{};
+        /// @brief stores the total number of records ever pushed (producer owned)
+        bsl::uintmx m_head{};
+        /// @brief stores the total number of records ever popped (consumer owned)
+        bsl::uintmx m_tail{};
+        /// @brief stores the total number of records that were dropped
+        bsl::uintmx m_dropped{};
+        /// @brief stores true while a thread owns this ring
+        bool m_owned{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Claims the ring for the calling thread, which becomes
+        ///     its only producer until it calls release().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the ring was claimed, false if it
+        ///     is already owned by another thread.
+        ///
+        [[nodiscard]] auto
+        try_claim() noexcept -> bool
+        {
+            bool mut_expected{};
+            return __atomic_compare_exchange_n(
+                &m_owned, &mut_expected, true, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives the ring back so that another thread can claim
+        ///     it. Must only be called by the thread that owns the ring.
+        ///
+        void
+        release() noexcept
+        {
+            __atomic_store_n(&m_owned, false, __ATOMIC_RELEASE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a record to the ring. If the ring is full, the
+        ///     record is dropped and false is returned. Must only be
+        ///     called by the thread that owns the ring.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param seq the global sequence number of the record
+        ///   @param level the debug level of the record
+        ///   @param str the chars to add (at most LOG_RECORD_SIZE)
+        ///   @param len the total number of chars to add
+        ///   @return Returns true if the record was added, false otherwise
+        ///
+        [[nodiscard]] auto
+        push(
+            bsl::uint64 const seq,
+            bsl::uintmx const level,
+            cstr_type const str,
+            bsl::uintmx const len) noexcept -> bool
+        {
+            auto const head{__atomic_load_n(&m_head, __ATOMIC_RELAXED)};
+            auto const tail{__atomic_load_n(&m_tail, __ATOMIC_ACQUIRE)};
+
+            if (LOG_RING_SIZE == head - tail) {
+                constexpr auto one{static_cast<bsl::uintmx>(1)};
+                bsl::discard(__atomic_fetch_add(&m_dropped, one, __ATOMIC_RELAXED));
+                return false;
+            }
+
+            auto *const pmut_rec{m_records.at_if(head & LOG_RING_MASK)};
+            pmut_rec->m_seq = seq;
+            pmut_rec->m_level = level;
+            pmut_rec->m_size = len;
+            bsl::discard(__builtin_memcpy(pmut_rec->m_data.data(), str, len));
+
+            __atomic_store_n(&m_head, head + static_cast<bsl::uintmx>(1), __ATOMIC_RELEASE);
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the oldest record in the ring,
+        ///     or a nullptr if the ring is empty. The record remains
+        ///     valid until pop() is called. Must only be called by the
+        ///     consumer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the oldest record in the ring,
+        ///     or a nullptr if the ring is empty.
+        ///
+        [[nodiscard]] auto
+        front() const noexcept -> log_record const *
+        {
+            auto const tail{__atomic_load_n(&m_tail, __ATOMIC_RELAXED)};
+            auto const head{__atomic_load_n(&m_head, __ATOMIC_ACQUIRE)};
+
+            if (head == tail) {
+                return nullptr;
+            }
+
+            return m_records.at_if(tail & LOG_RING_MASK);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of records that are currently
+        ///     in the ring. Must only be called by the consumer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of records that are
+        ///     currently in the ring.
+        ///
+        [[nodiscard]] auto
+        size() const noexcept -> bsl::uintmx
+        {
+            auto const tail{__atomic_load_n(&m_tail, __ATOMIC_RELAXED)};
+            auto const head{__atomic_load_n(&m_head, __ATOMIC_ACQUIRE)};
+
+            return head - tail;
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes the oldest record from the ring, giving its
+        ///     slot back to the producer. Must only be called by the
+        ///     consumer, and only after front() returned a record.
+        ///
+        void
+        pop() noexcept
+        {
+            auto const tail{__atomic_load_n(&m_tail, __ATOMIC_RELAXED)};
+            __atomic_store_n(&m_tail, tail + static_cast<bsl::uintmx>(1), __ATOMIC_RELEASE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of records that were
+        ///     dropped because the ring was full.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of records that were
+        ///     dropped because the ring was full.
+        ///
+        [[nodiscard]] auto
+        dropped() const noexcept -> bsl::uintmx
+        {
+            return __atomic_load_n(&m_dropped, __ATOMIC_RELAXED);
+        }
+    };
+
+    /// @brief stores the log rings. Threads claim them on first use.
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    constinit inline carray<log_ring, LOG_RING_TOTAL> g_mut_log_rings{};
+    /// @brief stores the next global log sequence number
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    constinit inline bsl::uint64 g_mut_log_seq{};
+    /// @brief stores the total number of writes that had no log ring
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    constinit inline bsl::uintmx g_mut_log_fallbacks{};
+
+    /// @class bsl::details::log_ring_owner
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the log ring a thread claimed, and gives it back
+    ///     when the thread exits (i.e., when its thread local instance
+    ///     of this class is destroyed).
+    ///
+    class log_ring_owner final
+    {
+        /// @brief stores the log ring this thread owns (nullptr if none)
+        log_ring *m_ring{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a log_ring_owner that does not own a ring.
+        ///
+        constexpr log_ring_owner() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Gives back the ring this thread owns, if any.
+        ///
+        ~log_ring_owner() noexcept
+        {
+            this->release();
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        log_ring_owner(log_ring_owner const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        log_ring_owner(log_ring_owner &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(log_ring_owner const &o) &noexcept
+            -> log_ring_owner & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(log_ring_owner &&mut_o) &noexcept
+            -> log_ring_owner & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns the ring this thread owns. If it does not
+        ///     own one yet, the first ring that no other thread owns is
+        ///     claimed. If every ring is owned, a nullptr is returned,
+        ///     and the next call tries again.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the ring this thread owns, or a nullptr if
+        ///     no log ring is available.
+        ///
+        [[nodiscard]] auto
+        get() noexcept -> log_ring *
+        {
+            if (nullptr != m_ring) {
+                return m_ring;
+            }
+
+            for (bsl::uintmx mut_i{}; mut_i < LOG_RING_TOTAL; ++mut_i) {
+                auto *const pmut_ring{g_mut_log_rings.at_if(mut_i)};
+                if (pmut_ring->try_claim()) {
+                    m_ring = pmut_ring;
+                    break;
+                }
+            }
+
+            return m_ring;
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives back the ring this thread owns, if any, so
+        ///     that another thread can claim it.
+        ///
+        void
+        release() noexcept
+        {
+            if (nullptr == m_ring) {
+                return;
+            }
+
+            m_ring->release();
+            m_ring = nullptr;
+        }
+    };
+
+    /// @brief stores the log ring the calling thread owns
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    constinit inline thread_local log_ring_owner g_mut_log_ring_owner{};
+
+    /// <!-- description -->
+    ///   @brief Returns the calling thread's log ring, claiming one if
+    ///     it does not have one yet. The ring is given back when the
+    ///     thread exits.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the calling thread's log ring, or a nullptr if
+    ///     no log ring is available.
+    ///
+    [[nodiscard]] inline auto
+    log_ring_this_thread() noexcept -> log_ring *
+    {
+        return g_mut_log_ring_owner.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes a string to the calling thread's log ring. Strings
+    ///     that are larger than a single record are split into as many
+    ///     records as needed.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str the string to write
+    ///   @param len the total number of chars to write
+    ///   @param level the debug level to write the string with
+    ///   @return Returns false if the calling thread has no log ring
+    ///     (which is counted, see bsl::log_fallbacks()), true otherwise
+    ///     (even if a record was dropped).
+    ///
+    [[nodiscard]] inline auto
+    log_ring_write(cstr_type const str, bsl::uintmx const len, bsl::uintmx const level) noexcept
+        -> bool
+    {
+        auto *const pmut_ring{log_ring_this_thread()};
+        if (nullptr == pmut_ring) {
+            constexpr auto one{static_cast<bsl::uintmx>(1)};
+            bsl::discard(__atomic_fetch_add(&g_mut_log_fallbacks, one, __ATOMIC_RELAXED));
+            return false;
+        }
+
+        bsl::uintmx mut_i{};
+        while (mut_i < len) {
+            auto mut_chunk{len - mut_i};
+            if (mut_chunk > LOG_RECORD_SIZE) {
+                mut_chunk = LOG_RECORD_SIZE;
+            }
+            else {
+                bsl::touch();
+            }
+
+            /// NOTE:
+            /// - The sequence number is taken before the record is
+            ///   published, so another thread can take a larger one and
+            ///   publish its record first. bsl::log_drain() only orders
+            ///   the records that are published when it is called, and
+            ///   leaves ordering across calls to the consumer.
+            ///
+
+            constexpr auto one{static_cast<bsl::uint64>(1)};
+            auto const seq{__atomic_fetch_add(&g_mut_log_seq, one, __ATOMIC_RELAXED)};
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            bsl::discard(pmut_ring->push(seq, level, str + mut_i, mut_chunk));
+            mut_i += mut_chunk;
+        }
+
+        return true;
+    }
+}
+
+#endif
@@ -31,8 +31,11 @@
 #include "../char_type.hpp"
 #include "../cstdint.hpp"
 #include "../cstr_type.hpp"
+#include "../discard.hpp"
 #include "../is_constant_evaluated.hpp"
 #include "../is_same.hpp"
+#include "binlog.hpp"
+#include "out_buffer.hpp"
 #include "out_char.hpp"
 #include "out_cstr.hpp"
 
@@ -53,10 +56,14 @@ namespace bsl
     ///   @brief Used to output characters and strings to stdout and stderr.
     ///     This class accepts "labels" which determines whether the output
     ///     goes to stdout or stderr and whether or not a prefix is printed
-    ///     such as "DEBUG". Note that this class is written such that it
-    ///     is completely compiled out during compilation as it has not
-    ///     member variables, or non-static member functions (i.e., everything
-    ///     is a constexpr). Note that you should not use this class
+    ///     such as "DEBUG". Note that this class has no member variables.
+    ///     All output is collected in the calling thread's
+    ///     details::out_buffer, which is written to the console once per
+    ///     line (or once per statement) instead of once per character.
+    ///     If BSL_NO_OUT_BUFFER is defined (for environments without
+    ///     thread local storage), output is written straight to the
+    ///     console instead.
+    ///     Note that you should not use this class
     ///     directly but instead should use one of the functions from debug.hpp
     ///     which ensures debug levels are handled properly. The only time
     ///     your code might use this class is when defining your own fmt_impl
@@ -74,18 +81,89 @@ namespace bsl
     template<typename T>
     class out final
     {
+        /// <!-- description -->
+        ///   @brief Tells the calling thread's output buffer that another
+        ///     bsl::out is using it.
+        ///
+        static constexpr void
+        acquire() noexcept
+        {
+            if (is_constant_evaluated()) {
+                return;
+            }
+
+            if constexpr (!empty() && details::OUT_BUFFER_ENABLED) {
+                details::out_buffer_this_thread()->acquire();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs a character to the calling thread's output
+        ///     buffer, or straight to the console if there is none.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the character to output
+        ///
+        static constexpr void
+        put(char_type const c) noexcept
+        {
+            if constexpr (details::OUT_BUFFER_ENABLED) {
+                details::out_buffer_this_thread()->write(c);
+            }
+            else {
+                details::out_char(c);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs a string to the calling thread's output
+        ///     buffer, or straight to the console if there is none.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to output
+        ///   @param len the total number of bytes to output
+        ///
+        static constexpr void
+        put(cstr_type const str, bsl::uintmx const len) noexcept
+        {
+            if constexpr (details::OUT_BUFFER_ENABLED) {
+                details::out_buffer_this_thread()->write(str, len);
+            }
+            else {
+                details::out_cstr(str, len);
+            }
+        }
+
     public:
         /// <!-- description -->
         ///   @brief Default constructor. Creates a bsl::out, which ensures
         ///     synchronization of other bsl::out operations as well as
         ///     adds a label if needed.
         ///
-        constexpr out() noexcept = default;
+        constexpr out() noexcept
+        {
+            acquire();
+        }
 
         /// <!-- description -->
-        ///   @brief Destroyes a previously created bsl::out
+        ///   @brief Destroyes a previously created bsl::out. If output is
+        ///     buffered, once the last bsl::out that is using the calling
+        ///     thread's output buffer is destroyed, any output that is still buffered is flushed
+        ///     to the console. This means that a single bsl::out statement
+        ///     (e.g., bsl::debug() << a << b;), including the label that
+        ///     bsl::debug() adds, results in a single write to the
+        ///     console, even if it does not end in a bsl::endl.
         ///
-        constexpr ~out() noexcept = default;
+        constexpr ~out() noexcept
+        {
+            if (is_constant_evaluated()) {
+                return;
+            }
+
+            if constexpr (!empty() && details::OUT_BUFFER_ENABLED) {
+                details::out_buffer_this_thread()->release();
+            }
+        }
 
         /// <!-- description -->
         ///   @brief copy constructor
@@ -93,7 +171,11 @@ namespace bsl
         /// <!-- inputs/outputs -->
         ///   @param o the object being copied
         ///
-        constexpr out(out const &o) noexcept = default;
+        constexpr out(out const &o) noexcept
+        {
+            bsl::discard(o);
+            acquire();
+        }
 
         /// <!-- description -->
         ///   @brief move constructor
@@ -101,7 +183,11 @@ namespace bsl
         /// <!-- inputs/outputs -->
         ///   @param mut_o the object being moved
         ///
-        constexpr out(out &&mut_o) noexcept = default;
+        constexpr out(out &&mut_o) noexcept
+        {
+            bsl::discard(mut_o);
+            acquire();
+        }
 
         /// <!-- description -->
         ///   @brief copy assignment
@@ -197,7 +283,12 @@ namespace bsl
 
         /// <!-- description -->
         ///   @brief Outputs a character to either stdout or stderr,
-        ///     depending on the bsl::out's label.
+        ///     depending on the bsl::out's label. If output is buffered,
+        ///     the character is added to the calling thread's output
+        ///     buffer, which is flushed on a bsl::endl, when it is full,
+        ///     or when the statement ends.
+        ///     When BSL_BINARY_LOG is defined, a NUL char is escaped so
+        ///     that it cannot be mistaken for the start of a binary item.
         ///
         /// <!-- inputs/outputs -->
         ///   @param c the character to output
@@ -209,26 +300,29 @@ namespace bsl
                 return;
             }
 
-            if constexpr (is_print()) {
-                details::out_char(c);
-            }
+            if constexpr (!empty()) {
+                if constexpr (details::BINLOG_ENABLED) {
+                    if ('\0' == c) {
+                        constexpr auto marker{static_cast<char_type>(details::BINLOG_MARKER)};
+                        constexpr auto tag{static_cast<char_type>(details::BINLOG_TAG_NUL)};
+                        put(marker);
+                        put(tag);
+                        return;
+                    }
+                }
 
-            if constexpr (is_debug()) {
-                details::out_char(c);
-            }
-
-            if constexpr (is_alert()) {
-                details::out_char(c);
-            }
-
-            if constexpr (is_error()) {
-                details::out_char(c);
+                put(c);
             }
         }
 
         /// <!-- description -->
         ///   @brief Outputs a string to either stdout or stderr,
-        ///     depending on the bsl::out's label.
+        ///     depending on the bsl::out's label. If output is buffered,
+        ///     the string is added to the calling thread's output buffer,
+        ///     which is flushed on each newline, when it is full, or when
+        ///     the statement ends. When BSL_BINARY_LOG is defined, each
+        ///     NUL char in the string is escaped the same way
+        ///     write_to_console(c) escapes it.
         ///
         /// <!-- inputs/outputs -->
         ///   @param str the string to output
@@ -241,20 +335,49 @@ namespace bsl
                 return;
             }
 
-            if constexpr (is_print()) {
-                details::out_cstr(str, len);
-            }
+            if constexpr (!empty()) {
+                if constexpr (details::BINLOG_ENABLED) {
+                    bsl::uintmx mut_start{};
+                    for (bsl::uintmx mut_i{}; mut_i < len; ++mut_i) {
+                        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                        if ('\0' != str[mut_i]) {
+                            continue;
+                        }
 
-            if constexpr (is_debug()) {
-                details::out_cstr(str, len);
+                        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                        put(str + mut_start, mut_i - mut_start);
+                        write_to_console('\0');
+                        mut_start = mut_i + static_cast<bsl::uintmx>(1);
+                    }
+
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    put(str + mut_start, len - mut_start);
+                    return;
+                }
+
+                put(str, len);
             }
+        }
 
-            if constexpr (is_alert()) {
-                details::out_cstr(str, len);
+        /// <!-- description -->
+        ///   @brief Outputs a binary item (see details/binlog.hpp) as is.
+        ///     Unlike write_to_console(), NUL chars are not escaped, as
+        ///     every binary item starts with one. This should only be
+        ///     used by details::fmt_impl_binlog().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param item the binary item to output
+        ///   @param len the total number of bytes to output
+        ///
+        static constexpr void
+        write_binlog_item(cstr_type const item, bsl::uintmx const len) noexcept
+        {
+            if (is_constant_evaluated()) {
+                return;
             }
 
-            if constexpr (is_error()) {
-                details::out_cstr(str, len);
+            if constexpr (!empty()) {
+                put(item, len);
             }
         }
     };
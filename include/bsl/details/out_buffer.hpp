@@ -0,0 +1,292 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BSL_DETAILS_OUT_BUFFER_HPP
+#define BSL_DETAILS_OUT_BUFFER_HPP
+
+#include "../carray.hpp"
+#include "../char_type.hpp"
+#include "../cstdint.hpp"
+#include "../cstr_type.hpp"
+#include "../debug_levels.hpp"
+#include "../discard.hpp"
+#include "../touch.hpp"
+#include "out_cstr.hpp"
+
+#ifdef BSL_LOG_RING
+#include "log_ring.hpp"
+#endif
+
+namespace bsl::details
+{
+    /// @brief defines the total number of chars an out_buffer can hold
+    constexpr bsl::uintmx OUT_BUFFER_SIZE{static_cast<bsl::uintmx>(256)};
+
+#if !defined(BSL_NO_OUT_BUFFER) || defined(BSL_LOG_RING)
+    /// @brief true if bsl::out output is collected in a per-thread out_buffer
+    constexpr bool OUT_BUFFER_ENABLED{true};
+#else
+    /// @brief true if bsl::out output is collected in a per-thread out_buffer
+    constexpr bool OUT_BUFFER_ENABLED{false};
+#endif
+
+#ifdef BSL_LOG_RING
+    static_assert(OUT_BUFFER_SIZE == LOG_RECORD_SIZE, "a full out_buffer must fit in a record");
+#endif
+
+    /// @class bsl::details::out_buffer
+    ///
+    /// <!-- description -->
+    ///   @brief Collects the characters written by a bsl::out so that
+    ///     they can be written to the console using a single call to
+    ///     out_cstr() instead of one call to out_char() per character.
+    ///     The buffer is flushed when a newline is written (either on
+    ///     its own or inside of a string), when it is full, and when the
+    ///     last bsl::out that is using it is destroyed (i.e., when the
+    ///     bsl::out statement ends). A line that is longer than the
+    ///     buffer is written in more than one piece.
+    ///     The buffer lives in thread local storage. Not every
+    ///     environment the BSL runs in provides it, so defining
+    ///     BSL_NO_OUT_BUFFER removes the buffer, and bsl::out writes
+    ///     straight to the console instead (one write per character).
+    ///     BSL_LOG_RING needs the buffer, so it ignores BSL_NO_OUT_BUFFER.
+    ///     If BSL_LOG_RING is defined, flushed output is written to
+    ///     the calling thread's lock-free log ring (see bsl::log_drain)
+    ///     instead of the console, tagged with the debug level of the
+    ///     bsl::out statement that wrote it. If the calling thread could
+    ///     not get a log ring, output is written to the console instead.
+    ///
+    class out_buffer final
+    {
+        /// @brief stores the chars that have not been flushed yet
+        carray<char_type, OUT_BUFFER_SIZE> m_buf{};
+        /// @brief stores the total number of chars in m_buf
+        bsl::uintmx m_size{};
+        /// @brief stores the total number of bsl::outs using this buffer
+        bsl::uintmx m_users{};
+        /// @brief stores the debug level of the current bsl::out statement
+        bsl::uintmx m_level{CRITICAL_ONLY};
+
+        /// <!-- description -->
+        ///   @brief Writes a string to wherever output is configured to go.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to write
+        ///   @param len the total number of chars to write
+        ///
+        constexpr void
+        sink(cstr_type const str, bsl::uintmx const len) const noexcept
+        {
+#ifdef BSL_LOG_RING
+            if (log_ring_write(str, len, m_level)) {
+                return;
+            }
+#endif
+
+            out_cstr(str, len);
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Tells the buffer that another bsl::out is using it.
+        ///
+        constexpr void
+        acquire() noexcept
+        {
+            ++m_users;
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the buffer that a bsl::out is no longer using
+        ///     it. Once no bsl::outs are using the buffer, it is flushed.
+        ///
+        constexpr void
+        release() noexcept
+        {
+            --m_users;
+            if (static_cast<bsl::uintmx>(0) == m_users) {
+                this->flush();
+                m_level = CRITICAL_ONLY;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the debug level of the current bsl::out
+        ///     statement. The debug level is reset to CRITICAL_ONLY once
+        ///     the statement ends.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param level the debug level of the current bsl::out statement
+        ///
+        constexpr void
+        set_level(bsl::uintmx const level) noexcept
+        {
+            m_level = level;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes all of the buffered chars to the console and
+        ///     empties the buffer.
+        ///
+        constexpr void
+        flush() noexcept
+        {
+            if (static_cast<bsl::uintmx>(0) == m_size) {
+                return;
+            }
+
+            this->sink(m_buf.data(), m_size);
+            m_size = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a char to the buffer. If the buffer is full, it
+        ///     is flushed first, and if the char is a newline, the buffer
+        ///     is flushed after the char is added.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the char to add
+        ///
+        constexpr void
+        write(char_type const c) noexcept
+        {
+            if (m_buf.size() == m_size) {
+                this->flush();
+            }
+            else {
+                bsl::touch();
+            }
+
+            *m_buf.at_if(m_size) = c;
+            ++m_size;
+
+            if ('\n' == c) {
+                this->flush();
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a string that does not contain a newline
+        ///     (other than as its last char) to the buffer. If the string
+        ///     does not fit, the buffer is flushed first, and if the
+        ///     string is larger than the buffer itself, it is written
+        ///     directly to the console.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to add
+        ///   @param len the total number of chars to add
+        ///
+        constexpr void
+        write_line(cstr_type const str, bsl::uintmx const len) noexcept
+        {
+            if (len > m_buf.size() - m_size) {
+                this->flush();
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (len > m_buf.size()) {
+                this->sink(str, len);
+                return;
+            }
+
+            /// NOTE:
+            /// - This header is included by assert.hpp, so it cannot use
+            ///   bsl::builtin_memcpy (which uses expects).
+            ///
+
+            bsl::discard(__builtin_memcpy(m_buf.at_if(m_size), str, len));
+            m_size += len;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a string to the buffer, one line at a time. The
+        ///     buffer is flushed after each newline in the string, just
+        ///     like it is when a newline is added using write(c).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to add
+        ///   @param len the total number of chars to add
+        ///
+        constexpr void
+        write(cstr_type const str, bsl::uintmx const len) noexcept
+        {
+            bsl::uintmx mut_i{};
+            while (mut_i < len) {
+                bsl::uintmx mut_end{mut_i};
+                bool mut_newline{};
+                while ((mut_end < len) && !mut_newline) {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    mut_newline = ('\n' == str[mut_end]);
+                    ++mut_end;
+                }
+
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                this->write_line(str + mut_i, mut_end - mut_i);
+                if (mut_newline) {
+                    this->flush();
+                }
+                else {
+                    bsl::touch();
+                }
+
+                mut_i = mut_end;
+            }
+        }
+    };
+
+#if !defined(BSL_NO_OUT_BUFFER) || defined(BSL_LOG_RING)
+    /// @brief stores the calling thread's out_buffer
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    constinit inline thread_local out_buffer g_mut_out_buffer{};
+#endif
+
+    /// <!-- description -->
+    ///   @brief Returns the calling thread's out_buffer, or a nullptr if
+    ///     OUT_BUFFER_ENABLED is false, in which case bsl::out must write
+    ///     straight to the console.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the calling thread's out_buffer, or a nullptr if
+    ///     OUT_BUFFER_ENABLED is false.
+    ///
+    [[nodiscard]] inline auto
+    out_buffer_this_thread() noexcept -> out_buffer *
+    {
+#if !defined(BSL_NO_OUT_BUFFER) || defined(BSL_LOG_RING)
+        return &g_mut_out_buffer;
+#else
+        return nullptr;
+#endif
+    }
+}
+
+#endif
@@ -0,0 +1,152 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file poison_bitmap.hpp
+///
+
+#ifndef BSL_DETAILS_POISON_BITMAP_HPP
+#define BSL_DETAILS_POISON_BITMAP_HPP
+
+#include "../cstdint.hpp"
+
+namespace bsl::details
+{
+    /// @brief defines the number of poison bits stored in each word
+    constexpr bsl::uintmx POISON_BITMAP_BITS{static_cast<bsl::uintmx>(64)};
+    /// @brief defines the mask used to get a bit's position in its word
+    constexpr bsl::uintmx POISON_BITMAP_MASK{POISON_BITMAP_BITS - static_cast<bsl::uintmx>(1)};
+    /// @brief defines the shift used to get the word a bit lives in
+    constexpr bsl::uintmx POISON_BITMAP_SHIFT{static_cast<bsl::uintmx>(6)};
+
+    /// <!-- description -->
+    ///   @brief Returns the number of words needed to store one poison
+    ///     bit for each of "count" elements.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param count the number of elements that need a poison bit
+    ///   @return Returns the number of words needed to store one poison
+    ///     bit for each of "count" elements.
+    ///
+    [[nodiscard]] constexpr auto
+    poison_bitmap_words(bsl::uintmx const count) noexcept -> bsl::uintmx
+    {
+        return (count + POISON_BITMAP_MASK) >> POISON_BITMAP_SHIFT;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the poison bit "bit" is set in the
+    ///     provided bitmap. The caller must ensure that "bit" is in bounds.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pudm_words the bitmap to read from
+    ///   @param bit the bit to test
+    ///   @return Returns true if the poison bit "bit" is set in the
+    ///     provided bitmap.
+    ///
+    [[nodiscard]] constexpr auto
+    poison_bitmap_test(bsl::uint64 const *const pudm_words, bsl::uintmx const bit) noexcept
+        -> bool
+    {
+        constexpr auto one{static_cast<bsl::uint64>(1)};
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto const word{pudm_words[bit >> POISON_BITMAP_SHIFT]};
+        return static_cast<bsl::uint64>(0) != (word & (one << (bit & POISON_BITMAP_MASK)));
+    }
+
+    /// <!-- description -->
+    ///   @brief Sets the poison bit "bit" in the provided bitmap to
+    ///     "poisoned". The caller must ensure that "bit" is in bounds.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_words the bitmap to write to
+    ///   @param bit the bit to set or clear
+    ///   @param poisoned the value to set the bit to
+    ///
+    constexpr void
+    poison_bitmap_assign(
+        bsl::uint64 *const pmut_words, bsl::uintmx const bit, bool const poisoned) noexcept
+    {
+        constexpr auto one{static_cast<bsl::uint64>(1)};
+        auto const mask{one << (bit & POISON_BITMAP_MASK)};
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto &mut_word{pmut_words[bit >> POISON_BITMAP_SHIFT]};
+        if (poisoned) {
+            mut_word |= mask;
+        }
+        else {
+            mut_word &= ~mask;
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if any of the bits in [first, first + count)
+    ///     are set in the provided bitmap. Whole words are tested at once,
+    ///     so this costs one load per 64 elements.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pudm_words the bitmap to read from
+    ///   @param first the first bit to test
+    ///   @param count the total number of bits to test
+    ///   @return Returns true if any of the bits in [first, first + count)
+    ///     are set in the provided bitmap.
+    ///
+    [[nodiscard]] constexpr auto
+    poison_bitmap_any(
+        bsl::uint64 const *const pudm_words,
+        bsl::uintmx const first,
+        bsl::uintmx const count) noexcept -> bool
+    {
+        constexpr auto zero{static_cast<bsl::uint64>(0)};
+        constexpr auto ones{~zero};
+
+        bsl::uintmx mut_bit{first};
+        bsl::uintmx const last{first + count};
+
+        while (mut_bit < last) {
+            auto const pos{mut_bit & POISON_BITMAP_MASK};
+            auto mut_width{POISON_BITMAP_BITS - pos};
+            if (mut_width > last - mut_bit) {
+                mut_width = last - mut_bit;
+            }
+
+            auto mut_mask{ones << pos};
+            if (mut_width + pos < POISON_BITMAP_BITS) {
+                mut_mask &= ~(ones << (mut_width + pos));
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            if (zero != (pudm_words[mut_bit >> POISON_BITMAP_SHIFT] & mut_mask)) {
+                return true;
+            }
+
+            mut_bit += mut_width;
+        }
+
+        return false;
+    }
+}
+
+#endif
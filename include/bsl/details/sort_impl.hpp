@@ -0,0 +1,984 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BSL_DETAILS_SORT_IMPL_HPP
+#define BSL_DETAILS_SORT_IMPL_HPP
+
+#include "../convert.hpp"
+#include "../move.hpp"
+#include "../safe_idx.hpp"
+#include "../safe_integral.hpp"
+#include "../swap.hpp"
+#include "../touch.hpp"
+
+namespace bsl::details
+{
+    /// @brief ranges smaller than this are sorted using insertion sort
+    constexpr safe_umx SORT_INSERTION_THRESHOLD{static_cast<bsl::uintmx>(24)};
+    /// @brief ranges larger than this use a ninther to select a pivot
+    constexpr safe_umx SORT_NINTHER_THRESHOLD{static_cast<bsl::uintmx>(128)};
+    /// @brief max number of moves a partial insertion sort may perform
+    constexpr safe_umx SORT_PARTIAL_INSERTION_LIMIT{static_cast<bsl::uintmx>(8)};
+    /// @brief size of the runs that stable sort insertion sorts first
+    constexpr safe_umx SORT_STABLE_BLOCK_SIZE{static_cast<bsl::uintmx>(20)};
+    /// @brief a partition is bad if a side is smaller than size >> this
+    constexpr safe_umx SORT_UNBALANCED_SHIFT{static_cast<bsl::uintmx>(3)};
+
+    /// @class bsl::details::sort_partition_result
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the result of partitioning a range.
+    ///
+    struct sort_partition_result final
+    {
+        /// @brief stores the final position of the pivot
+        safe_idx pos;
+        /// @brief stores true if no elements had to be swapped
+        bool already_partitioned;
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns a reference to the element at the provided index.
+    ///     All of the sort algorithms work directly on the container's
+    ///     underlying data so that they do not pay for a bounds check on
+    ///     every access. The algorithms themselves only ever produce
+    ///     indices inside of [0, size()).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to return
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param idx the index of the element to return
+    ///   @return Returns a reference to the element at the provided index
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    sort_elem(T *const pmut_data, safe_idx const &idx) noexcept -> T &
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return pmut_data[idx.get()];
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns val >> shift as a safe_idx.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param val the value to shift
+    ///   @param shift the number of bits to shift val by
+    ///   @return Returns val >> shift as a safe_idx.
+    ///
+    [[nodiscard]] constexpr auto
+    sort_shr(safe_umx const &val, safe_umx const &shift) noexcept -> safe_idx
+    {
+        /// NOTE:
+        /// - A right shift cannot overflow, so it is marked as checked.
+        ///
+
+        return to_idx((val >> shift).checked());
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the index halfway between first and last.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param first the first index
+    ///   @param last the last index. Must be >= first
+    ///   @return Returns the index halfway between first and last.
+    ///
+    [[nodiscard]] constexpr auto
+    sort_mid(safe_idx const &first, safe_idx const &last) noexcept -> safe_idx
+    {
+        return first + sort_shr(to_umx(last - first), safe_umx::magic_1());
+    }
+
+    /// <!-- description -->
+    ///   @brief Swaps the elements at the provided indices.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to swap
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param a the index of the first element to swap
+    ///   @param b the index of the second element to swap
+    ///
+    template<typename T>
+    constexpr void
+    sort_swap(T *const pmut_data, safe_idx const &a, safe_idx const &b) noexcept
+    {
+        bsl::swap(sort_elem(pmut_data, a), sort_elem(pmut_data, b));
+    }
+
+    /// <!-- description -->
+    ///   @brief Sorts [first, last) using insertion sort. Insertion sort
+    ///     is stable, and is the fastest algorithm for small ranges.
+    ///     Instead of swapping, each element is moved out into a
+    ///     temporary and the larger elements are shifted up one slot,
+    ///     which halves the number of writes.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to sort
+    ///   @tparam COMPARE the type of comparison function to use
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param first the first element in the range to sort
+    ///   @param last one past the last element in the range to sort
+    ///   @param pudm_udm_cmp the comparison function to use
+    ///
+    template<typename T, typename COMPARE>
+    constexpr void
+    sort_insertion(
+        T *const pmut_data,
+        safe_idx const &first,
+        safe_idx const &last,
+        COMPARE &&pudm_udm_cmp) noexcept
+    {
+        if (first == last) {
+            return;
+        }
+
+        for (safe_idx mut_i{first + safe_idx::magic_1()}; mut_i < last; ++mut_i) {
+            auto mut_j{mut_i};
+            auto const prev{mut_j - safe_idx::magic_1()};
+            if (!pudm_udm_cmp(sort_elem(pmut_data, mut_j), sort_elem(pmut_data, prev))) {
+                continue;
+            }
+
+            T mut_tmp{bsl::move(sort_elem(pmut_data, mut_j))};
+            do {
+                auto const k{mut_j - safe_idx::magic_1()};
+                sort_elem(pmut_data, mut_j) = bsl::move(sort_elem(pmut_data, k));
+                mut_j = k;
+            } while (mut_j > first &&
+                     pudm_udm_cmp(mut_tmp, sort_elem(pmut_data, mut_j - safe_idx::magic_1())));
+
+            sort_elem(pmut_data, mut_j) = bsl::move(mut_tmp);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Attempts to sort [first, last) using insertion sort, but
+    ///     gives up once more than SORT_PARTIAL_INSERTION_LIMIT elements
+    ///     have been moved. This is used to quickly finish ranges that
+    ///     are already (or are almost) sorted. The range must not be
+    ///     empty.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to sort
+    ///   @tparam COMPARE the type of comparison function to use
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param first the first element in the range to sort
+    ///   @param last one past the last element in the range to sort
+    ///   @param pudm_udm_cmp the comparison function to use
+    ///   @return Returns true if the range was sorted, false otherwise
+    ///
+    template<typename T, typename COMPARE>
+    [[nodiscard]] constexpr auto
+    sort_partial_insertion(
+        T *const pmut_data,
+        safe_idx const &first,
+        safe_idx const &last,
+        COMPARE &&pudm_udm_cmp) noexcept -> bool
+    {
+        safe_umx mut_moves{};
+        for (safe_idx mut_i{first + safe_idx::magic_1()}; mut_i < last; ++mut_i) {
+            auto mut_j{mut_i};
+            auto const prev{mut_j - safe_idx::magic_1()};
+            if (!pudm_udm_cmp(sort_elem(pmut_data, mut_j), sort_elem(pmut_data, prev))) {
+                continue;
+            }
+
+            T mut_tmp{bsl::move(sort_elem(pmut_data, mut_j))};
+            do {
+                auto const k{mut_j - safe_idx::magic_1()};
+                sort_elem(pmut_data, mut_j) = bsl::move(sort_elem(pmut_data, k));
+                mut_j = k;
+            } while (mut_j > first &&
+                     pudm_udm_cmp(mut_tmp, sort_elem(pmut_data, mut_j - safe_idx::magic_1())));
+
+            sort_elem(pmut_data, mut_j) = bsl::move(mut_tmp);
+
+            /// NOTE:
+            /// - The number of moves is bounded by the size of the
+            ///   range, so the math below cannot overflow.
+            ///
+
+            mut_moves = (mut_moves + to_umx(mut_i - mut_j)).checked();
+            if (mut_moves > SORT_PARTIAL_INSERTION_LIMIT) {
+                return false;
+            }
+
+            bsl::touch();
+        }
+
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Sorts the elements at the three provided indices so that
+    ///     a <= b <= c.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to sort
+    ///   @tparam COMPARE the type of comparison function to use
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param a the index of the first element
+    ///   @param b the index of the second element
+    ///   @param c the index of the third element
+    ///   @param pudm_udm_cmp the comparison function to use
+    ///
+    template<typename T, typename COMPARE>
+    constexpr void
+    sort3(
+        T *const pmut_data,
+        safe_idx const &a,
+        safe_idx const &b,
+        safe_idx const &c,
+        COMPARE &&pudm_udm_cmp) noexcept
+    {
+        if (pudm_udm_cmp(sort_elem(pmut_data, b), sort_elem(pmut_data, a))) {
+            sort_swap(pmut_data, a, b);
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (pudm_udm_cmp(sort_elem(pmut_data, c), sort_elem(pmut_data, b))) {
+            sort_swap(pmut_data, b, c);
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (pudm_udm_cmp(sort_elem(pmut_data, b), sort_elem(pmut_data, a))) {
+            sort_swap(pmut_data, a, b);
+        }
+        else {
+            bsl::touch();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Restores the max-heap property of the heap stored in
+    ///     [first, first + len), starting from the provided root.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to sort
+    ///   @tparam COMPARE the type of comparison function to use
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param first the first element of the heap
+    ///   @param root the heap relative index of the root to sift down
+    ///   @param len the total number of elements in the heap
+    ///   @param pudm_udm_cmp the comparison function to use
+    ///
+    template<typename T, typename COMPARE>
+    constexpr void
+    sort_sift_down(
+        T *const pmut_data,
+        safe_idx const &first,
+        safe_idx const &root,
+        safe_idx const &len,
+        COMPARE &&pudm_udm_cmp) noexcept
+    {
+        auto mut_root{root};
+        while (true) {
+            auto mut_child{(mut_root + mut_root) + safe_idx::magic_1()};
+            if (mut_child >= len) {
+                break;
+            }
+
+            auto const next{mut_child + safe_idx::magic_1()};
+            if (next < len) {
+                if (pudm_udm_cmp(
+                        sort_elem(pmut_data, first + mut_child),
+                        sort_elem(pmut_data, first + next))) {
+                    mut_child = next;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (!pudm_udm_cmp(
+                    sort_elem(pmut_data, first + mut_root),
+                    sort_elem(pmut_data, first + mut_child))) {
+                break;
+            }
+
+            sort_swap(pmut_data, first + mut_root, first + mut_child);
+            mut_root = mut_child;
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Turns [first, first + len) into a max-heap.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to sort
+    ///   @tparam COMPARE the type of comparison function to use
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param first the first element of the heap
+    ///   @param len the total number of elements in the heap
+    ///   @param pudm_udm_cmp the comparison function to use
+    ///
+    template<typename T, typename COMPARE>
+    constexpr void
+    sort_make_heap(
+        T *const pmut_data,
+        safe_idx const &first,
+        safe_idx const &len,
+        COMPARE &&pudm_udm_cmp) noexcept
+    {
+        auto mut_i{sort_shr(to_umx(len), safe_umx::magic_1())};
+        while (mut_i > safe_idx::magic_0()) {
+            --mut_i;
+            sort_sift_down(pmut_data, first, mut_i, len, pudm_udm_cmp);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Sorts the max-heap stored in [first, first + len).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to sort
+    ///   @tparam COMPARE the type of comparison function to use
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param first the first element of the heap
+    ///   @param len the total number of elements in the heap
+    ///   @param pudm_udm_cmp the comparison function to use
+    ///
+    template<typename T, typename COMPARE>
+    constexpr void
+    sort_heap(
+        T *const pmut_data,
+        safe_idx const &first,
+        safe_idx const &len,
+        COMPARE &&pudm_udm_cmp) noexcept
+    {
+        auto mut_last{len};
+        while (mut_last > safe_idx::magic_1()) {
+            --mut_last;
+            sort_swap(pmut_data, first, first + mut_last);
+            sort_sift_down(pmut_data, first, safe_idx::magic_0(), mut_last, pudm_udm_cmp);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Sorts [first, last) using heapsort. This is the fallback
+    ///     that guarantees O(n log n) when quicksort keeps choosing bad
+    ///     pivots.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to sort
+    ///   @tparam COMPARE the type of comparison function to use
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param first the first element in the range to sort
+    ///   @param last one past the last element in the range to sort
+    ///   @param pudm_udm_cmp the comparison function to use
+    ///
+    template<typename T, typename COMPARE>
+    constexpr void
+    sort_heapsort(
+        T *const pmut_data,
+        safe_idx const &first,
+        safe_idx const &last,
+        COMPARE &&pudm_udm_cmp) noexcept
+    {
+        auto const len{last - first};
+        sort_make_heap(pmut_data, first, len, pudm_udm_cmp);
+        sort_heap(pmut_data, first, len, pudm_udm_cmp);
+    }
+
+    /// <!-- description -->
+    ///   @brief Partitions [first, last) around the pivot stored at
+    ///     first. Elements less than the pivot end up to the left of the
+    ///     pivot, and elements greater than or equal to the pivot end up
+    ///     to the right of the pivot.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to sort
+    ///   @tparam COMPARE the type of comparison function to use
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param first the first element in the range (the pivot)
+    ///   @param last one past the last element in the range
+    ///   @param pudm_udm_cmp the comparison function to use
+    ///   @return Returns the final position of the pivot, and whether or
+    ///     not the range was already partitioned.
+    ///
+    template<typename T, typename COMPARE>
+    [[nodiscard]] constexpr auto
+    sort_partition_right(
+        T *const pmut_data,
+        safe_idx const &first,
+        safe_idx const &last,
+        COMPARE &&pudm_udm_cmp) noexcept -> sort_partition_result
+    {
+        T mut_pivot{bsl::move(sort_elem(pmut_data, first))};
+        auto mut_i{first + safe_idx::magic_1()};
+        auto mut_j{last};
+
+        while (mut_i < mut_j && pudm_udm_cmp(sort_elem(pmut_data, mut_i), mut_pivot)) {
+            ++mut_i;
+        }
+
+        while (mut_i < mut_j &&
+               !pudm_udm_cmp(sort_elem(pmut_data, mut_j - safe_idx::magic_1()), mut_pivot)) {
+            --mut_j;
+        }
+
+        bool const already_partitioned{mut_i >= mut_j};
+        while (mut_i < mut_j) {
+            --mut_j;
+            sort_swap(pmut_data, mut_i, mut_j);
+            ++mut_i;
+
+            while (mut_i < mut_j && pudm_udm_cmp(sort_elem(pmut_data, mut_i), mut_pivot)) {
+                ++mut_i;
+            }
+
+            while (mut_i < mut_j &&
+                   !pudm_udm_cmp(sort_elem(pmut_data, mut_j - safe_idx::magic_1()), mut_pivot)) {
+                --mut_j;
+            }
+        }
+
+        auto const pos{mut_i - safe_idx::magic_1()};
+        sort_elem(pmut_data, first) = bsl::move(sort_elem(pmut_data, pos));
+        sort_elem(pmut_data, pos) = bsl::move(mut_pivot);
+
+        return {pos, already_partitioned};
+    }
+
+    /// <!-- description -->
+    ///   @brief Partitions [first, last) around the pivot stored at
+    ///     first. Elements less than or equal to the pivot end up to the
+    ///     left of the pivot, and elements greater than the pivot end up
+    ///     to the right of the pivot. This is used when the range is
+    ///     known to contain many elements that are equal to the pivot,
+    ///     which are then skipped in a single pass.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to sort
+    ///   @tparam COMPARE the type of comparison function to use
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param first the first element in the range (the pivot)
+    ///   @param last one past the last element in the range
+    ///   @param pudm_udm_cmp the comparison function to use
+    ///   @return Returns the final position of the pivot
+    ///
+    template<typename T, typename COMPARE>
+    [[nodiscard]] constexpr auto
+    sort_partition_left(
+        T *const pmut_data,
+        safe_idx const &first,
+        safe_idx const &last,
+        COMPARE &&pudm_udm_cmp) noexcept -> safe_idx
+    {
+        T mut_pivot{bsl::move(sort_elem(pmut_data, first))};
+        auto mut_i{first + safe_idx::magic_1()};
+        auto mut_j{last};
+
+        while (mut_i < mut_j && !pudm_udm_cmp(mut_pivot, sort_elem(pmut_data, mut_i))) {
+            ++mut_i;
+        }
+
+        while (mut_i < mut_j &&
+               pudm_udm_cmp(mut_pivot, sort_elem(pmut_data, mut_j - safe_idx::magic_1()))) {
+            --mut_j;
+        }
+
+        while (mut_i < mut_j) {
+            --mut_j;
+            sort_swap(pmut_data, mut_i, mut_j);
+            ++mut_i;
+
+            while (mut_i < mut_j && !pudm_udm_cmp(mut_pivot, sort_elem(pmut_data, mut_i))) {
+                ++mut_i;
+            }
+
+            while (mut_i < mut_j &&
+                   pudm_udm_cmp(mut_pivot, sort_elem(pmut_data, mut_j - safe_idx::magic_1()))) {
+                --mut_j;
+            }
+        }
+
+        auto const pos{mut_i - safe_idx::magic_1()};
+        sort_elem(pmut_data, first) = bsl::move(sort_elem(pmut_data, pos));
+        sort_elem(pmut_data, pos) = bsl::move(mut_pivot);
+
+        return pos;
+    }
+
+    /// <!-- description -->
+    ///   @brief Selects a pivot for [first, last) and moves it to first.
+    ///     Small ranges use the median of 3, and larger ranges use the
+    ///     median of 3 medians (a.k.a. Tukey's ninther).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to sort
+    ///   @tparam COMPARE the type of comparison function to use
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param first the first element in the range
+    ///   @param last one past the last element in the range
+    ///   @param pudm_udm_cmp the comparison function to use
+    ///
+    template<typename T, typename COMPARE>
+    constexpr void
+    sort_choose_pivot(
+        T *const pmut_data,
+        safe_idx const &first,
+        safe_idx const &last,
+        COMPARE &&pudm_udm_cmp) noexcept
+    {
+        constexpr auto one{safe_idx::magic_1()};
+        constexpr auto two{safe_idx::magic_2()};
+        constexpr auto three{safe_idx::magic_3()};
+
+        auto const mid{sort_mid(first, last)};
+        if (to_umx(last - first) > SORT_NINTHER_THRESHOLD) {
+            sort3(pmut_data, first, mid, last - one, pudm_udm_cmp);
+            sort3(pmut_data, first + one, mid - one, last - two, pudm_udm_cmp);
+            sort3(pmut_data, first + two, mid + one, last - three, pudm_udm_cmp);
+            sort3(pmut_data, mid - one, mid, mid + one, pudm_udm_cmp);
+            sort_swap(pmut_data, first, mid);
+        }
+        else {
+            sort3(pmut_data, mid, first, last - one, pudm_udm_cmp);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Swaps a few elements of a range that produced a highly
+    ///     unbalanced partition. This breaks up the patterns that cause
+    ///     quicksort to choose bad pivots (e.g., organ pipes).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to sort
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param first the first element in the range
+    ///   @param last one past the last element in the range
+    ///
+    template<typename T>
+    constexpr void
+    sort_break_patterns(T *const pmut_data, safe_idx const &first, safe_idx const &last) noexcept
+    {
+        constexpr auto one{safe_idx::magic_1()};
+        constexpr auto two{safe_idx::magic_2()};
+        constexpr auto three{safe_idx::magic_3()};
+
+        auto const size{to_umx(last - first)};
+        if (size < SORT_INSERTION_THRESHOLD) {
+            return;
+        }
+
+        auto const quarter{sort_shr(size, safe_umx::magic_2())};
+        sort_swap(pmut_data, first, first + quarter);
+        sort_swap(pmut_data, last - one, last - quarter);
+
+        if (size > SORT_NINTHER_THRESHOLD) {
+            sort_swap(pmut_data, first + one, (first + quarter) + one);
+            sort_swap(pmut_data, first + two, (first + quarter) + two);
+            sort_swap(pmut_data, last - two, (last - quarter) - one);
+            sort_swap(pmut_data, last - three, (last - quarter) - two);
+        }
+        else {
+            bsl::touch();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns floor(log2(val)), or 0 if val is 0.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param val the value to get the log of
+    ///   @return Returns floor(log2(val)), or 0 if val is 0.
+    ///
+    [[nodiscard]] constexpr auto
+    sort_log2(safe_umx const &val) noexcept -> safe_umx
+    {
+        safe_umx mut_log{};
+        auto mut_val{(val >> safe_umx::magic_1()).checked()};
+
+        /// NOTE:
+        /// - mut_log is bounded by the number of bits in safe_umx, so
+        ///   the math below cannot overflow.
+        ///
+
+        while (!mut_val.is_zero()) {
+            mut_log = (mut_log + safe_umx::magic_1()).checked();
+            mut_val = (mut_val >> safe_umx::magic_1()).checked();
+        }
+
+        return mut_log;
+    }
+
+    /// <!-- description -->
+    ///   @brief Sorts [first, last) using pattern-defeating quicksort.
+    ///     Small ranges are finished with insertion sort, ranges that
+    ///     are already partitioned are finished with a partial insertion
+    ///     sort, and once too many bad pivots have been chosen, the range
+    ///     is finished with heapsort, which bounds the worst case to
+    ///     O(n log n). Only the smaller side of each partition is sorted
+    ///     recursively, which bounds the stack usage to O(log n).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to sort
+    ///   @tparam COMPARE the type of comparison function to use
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param first the first element in the range to sort
+    ///   @param last one past the last element in the range to sort
+    ///   @param pudm_udm_cmp the comparison function to use
+    ///   @param bad_allowed the number of bad pivots that can be chosen
+    ///     before falling back to heapsort
+    ///   @param leftmost true if there is no element to the left of first
+    ///     that belongs to the range that was partitioned
+    ///
+    template<typename T, typename COMPARE>
+    // NOLINTNEXTLINE(misc-no-recursion)
+    constexpr void
+    sort_pdq(
+        T *const pmut_data,
+        safe_idx const &first,
+        safe_idx const &last,
+        COMPARE &&pudm_udm_cmp,
+        safe_umx const &bad_allowed,
+        bool const leftmost) noexcept
+    {
+        auto mut_first{first};
+        auto mut_last{last};
+        auto mut_bad_allowed{bad_allowed};
+        auto mut_leftmost{leftmost};
+
+        while (true) {
+            auto const size{to_umx(mut_last - mut_first)};
+            if (size < SORT_INSERTION_THRESHOLD) {
+                sort_insertion(pmut_data, mut_first, mut_last, pudm_udm_cmp);
+                return;
+            }
+
+            sort_choose_pivot(pmut_data, mut_first, mut_last, pudm_udm_cmp);
+
+            /// NOTE:
+            /// - If the element to the left of this range is not less
+            ///   than the pivot, it is equal to the pivot (it was the
+            ///   pivot of a previous partition, and everything in this
+            ///   range is greater than or equal to it). In this case,
+            ///   every element that is equal to the pivot is moved to
+            ///   the left and skipped, which is what makes ranges with
+            ///   many duplicates run in linear time.
+            ///
+
+            if (!mut_leftmost) {
+                auto const prev{mut_first - safe_idx::magic_1()};
+                if (!pudm_udm_cmp(sort_elem(pmut_data, prev), sort_elem(pmut_data, mut_first))) {
+                    mut_first = sort_partition_left(pmut_data, mut_first, mut_last, pudm_udm_cmp) +
+                                safe_idx::magic_1();
+                    continue;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const part{sort_partition_right(pmut_data, mut_first, mut_last, pudm_udm_cmp)};
+            auto const next{part.pos + safe_idx::magic_1()};
+            auto const l_size{to_umx(part.pos - mut_first)};
+            auto const r_size{to_umx(mut_last - next)};
+            auto const min_size{to_umx(sort_shr(size, SORT_UNBALANCED_SHIFT))};
+
+            if (l_size < min_size || r_size < min_size) {
+                if (mut_bad_allowed.is_zero()) {
+                    sort_heapsort(pmut_data, mut_first, mut_last, pudm_udm_cmp);
+                    return;
+                }
+
+                /// NOTE:
+                /// - mut_bad_allowed is not zero, so this cannot
+                ///   underflow.
+                ///
+
+                mut_bad_allowed = (mut_bad_allowed - safe_umx::magic_1()).checked();
+                sort_break_patterns(pmut_data, mut_first, part.pos);
+                sort_break_patterns(pmut_data, next, mut_last);
+            }
+            else {
+                if (part.already_partitioned) {
+                    if (sort_partial_insertion(pmut_data, mut_first, part.pos, pudm_udm_cmp) &&
+                        sort_partial_insertion(pmut_data, next, mut_last, pudm_udm_cmp)) {
+                        return;
+                    }
+
+                    bsl::touch();
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            if (l_size < r_size) {
+                sort_pdq(
+                    pmut_data, mut_first, part.pos, pudm_udm_cmp, mut_bad_allowed, mut_leftmost);
+                mut_first = next;
+                mut_leftmost = false;
+            }
+            else {
+                sort_pdq(pmut_data, next, mut_last, pudm_udm_cmp, mut_bad_allowed, false);
+                mut_last = part.pos;
+            }
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Swaps the n elements starting at a with the n elements
+    ///     starting at b. The two ranges must not overlap.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to swap
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param a the first element of the first range
+    ///   @param b the first element of the second range
+    ///   @param n the total number of elements to swap
+    ///
+    template<typename T>
+    constexpr void
+    sort_swap_range(
+        T *const pmut_data, safe_idx const &a, safe_idx const &b, safe_idx const &n) noexcept
+    {
+        for (safe_idx mut_i{}; mut_i < n; ++mut_i) {
+            sort_swap(pmut_data, a + mut_i, b + mut_i);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Rotates [first, last) so that the element at mid becomes
+    ///     the first element, using O(1) space.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to rotate
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param first the first element in the range to rotate
+    ///   @param mid the element that becomes the first element
+    ///   @param last one past the last element in the range to rotate
+    ///
+    template<typename T>
+    constexpr void
+    sort_rotate(
+        T *const pmut_data,
+        safe_idx const &first,
+        safe_idx const &mid,
+        safe_idx const &last) noexcept
+    {
+        auto mut_i{mid - first};
+        auto mut_j{last - mid};
+
+        while (mut_i != mut_j) {
+            if (mut_i > mut_j) {
+                sort_swap_range(pmut_data, mid - mut_i, mid, mut_j);
+                mut_i -= mut_j;
+            }
+            else {
+                sort_swap_range(pmut_data, mid - mut_i, (mid + mut_j) - mut_i, mut_i);
+                mut_j -= mut_i;
+            }
+        }
+
+        sort_swap_range(pmut_data, mid - mut_i, mid, mut_i);
+    }
+
+    /// <!-- description -->
+    ///   @brief Merges the two sorted ranges [first, mid) and [mid, last)
+    ///     in place using the SymMerge algorithm from Kim and Kutzner.
+    ///     This is stable, uses O(1) space (other than O(log n) stack
+    ///     space), and performs O(m log(n/m + 1)) comparisons where m is
+    ///     the size of the smaller range.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to merge
+    ///   @tparam COMPARE the type of comparison function to use
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param first the first element in the first range
+    ///   @param mid the first element in the second range
+    ///   @param last one past the last element in the second range
+    ///   @param pudm_udm_cmp the comparison function to use
+    ///
+    template<typename T, typename COMPARE>
+    // NOLINTNEXTLINE(misc-no-recursion, readability-function-cognitive-complexity)
+    constexpr void
+    sort_sym_merge(
+        T *const pmut_data,
+        safe_idx const &first,
+        safe_idx const &mid,
+        safe_idx const &last,
+        COMPARE &&pudm_udm_cmp) noexcept
+    {
+        constexpr auto one{safe_idx::magic_1()};
+
+        if (mid - first == one) {
+            auto mut_i{mid};
+            auto mut_j{last};
+            while (mut_i < mut_j) {
+                auto const h{sort_mid(mut_i, mut_j)};
+                if (pudm_udm_cmp(sort_elem(pmut_data, h), sort_elem(pmut_data, first))) {
+                    mut_i = h + one;
+                }
+                else {
+                    mut_j = h;
+                }
+            }
+
+            for (safe_idx mut_k{first}; mut_k + one < mut_i; ++mut_k) {
+                sort_swap(pmut_data, mut_k, mut_k + one);
+            }
+
+            return;
+        }
+
+        if (last - mid == one) {
+            auto mut_i{first};
+            auto mut_j{mid};
+            while (mut_i < mut_j) {
+                auto const h{sort_mid(mut_i, mut_j)};
+                if (!pudm_udm_cmp(sort_elem(pmut_data, mid), sort_elem(pmut_data, h))) {
+                    mut_i = h + one;
+                }
+                else {
+                    mut_j = h;
+                }
+            }
+
+            for (safe_idx mut_k{mid}; mut_k > mut_i; --mut_k) {
+                sort_swap(pmut_data, mut_k, mut_k - one);
+            }
+
+            return;
+        }
+
+        auto const half{sort_mid(first, last)};
+        auto const n{half + mid};
+
+        safe_idx mut_start{};
+        safe_idx mut_r{};
+        if (mid > half) {
+            mut_start = n - last;
+            mut_r = half;
+        }
+        else {
+            mut_start = first;
+            mut_r = mid;
+        }
+
+        auto const p{n - one};
+        while (mut_start < mut_r) {
+            auto const c{sort_mid(mut_start, mut_r)};
+            if (!pudm_udm_cmp(sort_elem(pmut_data, p - c), sort_elem(pmut_data, c))) {
+                mut_start = c + one;
+            }
+            else {
+                mut_r = c;
+            }
+        }
+
+        auto const end{n - mut_start};
+        if (mut_start < mid && mid < end) {
+            sort_rotate(pmut_data, mut_start, mid, end);
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (first < mut_start && mut_start < half) {
+            sort_sym_merge(pmut_data, first, mut_start, half, pudm_udm_cmp);
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (half < end && end < last) {
+            sort_sym_merge(pmut_data, half, end, last, pudm_udm_cmp);
+        }
+        else {
+            bsl::touch();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Sorts [first, last) using a bottom-up, in place merge
+    ///     sort. Blocks of SORT_STABLE_BLOCK_SIZE elements are first
+    ///     sorted using insertion sort, and are then merged together
+    ///     using sort_sym_merge().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element to sort
+    ///   @tparam COMPARE the type of comparison function to use
+    ///   @param pmut_data a pointer to the data being sorted
+    ///   @param size the total number of elements to sort
+    ///   @param pudm_udm_cmp the comparison function to use
+    ///
+    template<typename T, typename COMPARE>
+    constexpr void
+    sort_stable(T *const pmut_data, safe_idx const &size, COMPARE &&pudm_udm_cmp) noexcept
+    {
+        auto mut_block{to_idx(SORT_STABLE_BLOCK_SIZE)};
+
+        safe_idx mut_a{};
+        while (mut_block <= size - mut_a) {
+            sort_insertion(pmut_data, mut_a, mut_a + mut_block, pudm_udm_cmp);
+            mut_a += mut_block;
+        }
+
+        sort_insertion(pmut_data, mut_a, size, pudm_udm_cmp);
+
+        /// NOTE:
+        /// - All of the comparisons below are written as a distance
+        ///   from the end of the range so that the math cannot
+        ///   overflow, even for huge blocks.
+        ///
+
+        while (mut_block < size) {
+            mut_a = {};
+            while (mut_block < size - mut_a) {
+                auto const mid{mut_a + mut_block};
+                auto mut_b{size};
+                if (mut_block <= size - mid) {
+                    mut_b = mid + mut_block;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                sort_sym_merge(pmut_data, mut_a, mid, mut_b, pudm_udm_cmp);
+                mut_a = mut_b;
+            }
+
+            if (mut_block > size - mut_block) {
+                break;
+            }
+
+            mut_block += mut_block;
+        }
+    }
+}
+
+#endif
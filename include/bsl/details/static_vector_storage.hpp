@@ -0,0 +1,136 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file static_vector_storage.hpp
+///
+
+#ifndef BSL_DETAILS_STATIC_VECTOR_STORAGE_HPP
+#define BSL_DETAILS_STATIC_VECTOR_STORAGE_HPP
+
+#include "../cstdint.hpp"
+
+namespace bsl::details
+{
+    /// @class bsl::details::static_vector_storage
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the elements of a bsl::static_vector whose T is not
+    ///     trivially copyable. The elements are the only member of a
+    ///     union, so neither constructing nor destroying the storage
+    ///     constructs or destroys any of them. bsl::static_vector does
+    ///     that one element at a time instead.
+    ///
+    /// <!-- notes -->
+    ///   @note "union" is not supported by the BSL as it is not compliant
+    ///     with AUTOSAR. It is only used here, internally, as there is no
+    ///     other way to have storage for a T that does not construct the
+    ///     T without a reinterpret_cast, which is not allowed in a
+    ///     constant expression.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of element being stored.
+    ///   @tparam N the max number of elements that can be stored.
+    ///
+    template<typename T, bsl::uintmx N>
+    union static_vector_storage final    // NOLINT
+    {
+        /// @brief stores the (possibly unconstructed) elements
+        T m_data[N];    // NOLINT
+
+        /// <!-- description -->
+        ///   @brief Creates the storage. No elements are constructed.
+        ///
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init, hicpp-member-init)
+        constexpr static_vector_storage() noexcept
+        {}
+
+        /// <!-- description -->
+        ///   @brief Destroys the storage. No elements are destroyed.
+        ///
+        constexpr ~static_vector_storage() noexcept
+        {}
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr static_vector_storage(static_vector_storage const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr static_vector_storage(static_vector_storage &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(static_vector_storage const &o) &noexcept
+            -> static_vector_storage & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(static_vector_storage &&mut_o) &noexcept
+            -> static_vector_storage & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the storage of the first element.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the storage of the first element.
+        ///
+        [[nodiscard]] constexpr auto
+        data() &noexcept -> T *
+        {
+            return static_cast<T *>(m_data);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the storage of the first element.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the storage of the first element.
+        ///
+        [[nodiscard]] constexpr auto
+        data() const &noexcept -> T const *
+        {
+            return static_cast<T const *>(m_data);
+        }
+    };
+}
+
+#endif
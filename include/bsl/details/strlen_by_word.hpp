@@ -0,0 +1,125 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BSL_DETAILS_STRLEN_BY_WORD_HPP
+#define BSL_DETAILS_STRLEN_BY_WORD_HPP
+
+#include "../cstdint.hpp"
+#include "../cstr_type.hpp"
+#include "../discard.hpp"
+
+namespace bsl::details
+{
+    /// @brief defines the size of the words strlen_by_word() reads
+    constexpr bsl::uintmx STRLEN_WORD_SIZE{sizeof(bsl::uint64)};
+    /// @brief defines a word with each byte set to 0x01
+    constexpr bsl::uint64 STRLEN_WORD_ONES{static_cast<bsl::uint64>(0x0101010101010101U)};
+    /// @brief defines a word with the high bit of each byte set
+    constexpr bsl::uint64 STRLEN_WORD_HIGHS{static_cast<bsl::uint64>(0x8080808080808080U)};
+
+    /// @brief true if ASAN is enabled, in which case strlen_by_word()
+    ///   only reads one byte at a time
+#if defined(__SANITIZE_ADDRESS__)
+    constexpr bool STRLEN_BYTEWISE{true};
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+    constexpr bool STRLEN_BYTEWISE{true};
+#else
+    constexpr bool STRLEN_BYTEWISE{false};
+#endif
+#else
+    constexpr bool STRLEN_BYTEWISE{false};
+#endif
+
+    /// <!-- description -->
+    ///   @brief Returns the same result as std::strlen. This is the
+    ///     runtime version of bsl::builtin_strlen. Once str is aligned,
+    ///     it is read a word at a time, and each word is tested for a
+    ///     '\0' byte using (w - 0x01..01) & ~w & 0x80..80, which is
+    ///     non-zero if and only if w contains a zero byte.
+    ///
+    /// <!-- notes -->
+    ///   @note Only aligned words are read, and an aligned word never
+    ///     crosses a page boundary, so reading the bytes that follow the
+    ///     '\0' in the same word cannot fault. ASAN still sees these
+    ///     reads as being outside of the string, so when ASAN is enabled,
+    ///     the string is read one byte at a time instead (and ASAN checks
+    ///     every read).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str a pointer to a string to get the length of
+    ///   @return Returns the same result as std::strlen
+    ///
+    [[nodiscard]] inline auto
+    strlen_by_word(cstr_type const str) noexcept -> bsl::uintmx
+    {
+        bsl::uintmx mut_len{};
+
+        if constexpr (!STRLEN_BYTEWISE) {
+            constexpr bsl::uintmx align_mask{STRLEN_WORD_SIZE - static_cast<bsl::uintmx>(1)};
+
+            // We need the address of the string to know when we can start
+            // reading whole (aligned) words. No math is performed on the
+            // pointer itself.
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto const addr{reinterpret_cast<bsl::uintmx>(str)};
+
+            while (((addr + mut_len) & align_mask) != static_cast<bsl::uintmx>(0)) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                if ('\0' == str[mut_len]) {
+                    return mut_len;
+                }
+
+                ++mut_len;
+            }
+
+            bsl::uint64 mut_word{};
+            while (true) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                bsl::discard(__builtin_memcpy(&mut_word, &str[mut_len], STRLEN_WORD_SIZE));
+                if (((mut_word - STRLEN_WORD_ONES) & ~mut_word & STRLEN_WORD_HIGHS) != 0U) {
+                    break;
+                }
+
+                mut_len += STRLEN_WORD_SIZE;
+            }
+        }
+
+        /// NOTE:
+        /// - Unless ASAN is enabled, the word at mut_len contains the
+        ///   '\0', so all that is left is to find which byte it is in
+        ///   (without caring about endianness). With ASAN, this is the
+        ///   whole search.
+        ///
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        while ('\0' != str[mut_len]) {
+            ++mut_len;
+        }
+
+        return mut_len;
+    }
+}
+
+#endif
@@ -42,6 +42,7 @@
 #include "bsl/enable_if.hpp"
 #include "bsl/expects.hpp"
 #include "bsl/fmt_options.hpp"    // IWYU pragma: export
+#include "bsl/fmt_spec.hpp"       // IWYU pragma: export
 #include "bsl/is_bool.hpp"
 #include "bsl/is_constant_evaluated.hpp"
 #include "bsl/is_integral.hpp"
@@ -382,15 +383,16 @@ namespace bsl
         /// <!-- description -->
         ///   @brief Creates a bsl::fmt, which when passed to an outputter
         ///     will output the provided value given the provided format
-        ///     string.
+        ///     string. The format string is parsed at compile-time (see
+        ///     bsl::fmt_spec).
         ///   @include fmt/example_fmt_constructor_f_val.hpp
         ///
         /// <!-- inputs/outputs -->
-        ///   @param str the format options used to format the output of val
+        ///   @param spec the format string used to format the output of val
         ///   @param val the value to output given the provided format string
         ///
-        constexpr fmt(cstr_type const str, VAL_T const &val) noexcept    // --
-            : fmt{fmt_options{str}, val}
+        constexpr fmt(fmt_spec const &spec, VAL_T const &val) noexcept    // --
+            : fmt{spec.ops(), val}
         {}
 
         /// <!-- description -->
@@ -398,17 +400,18 @@ namespace bsl
         ///     will output the provided value given the provided format
         ///     string. Note that this version also accepts a dynamic width,
         ///     meaning the width can be determined at runtime. If the width
-        ///     is provided, the width in the format string is ignored.
+        ///     is provided, the width in the format string is ignored. The
+        ///     format string is parsed at compile-time (see bsl::fmt_spec).
         ///   @include fmt/example_fmt_constructor_f_val_width.hpp
         ///
         /// <!-- inputs/outputs -->
-        ///   @param str the format options used to format the output of val
+        ///   @param spec the format string used to format the output of val
         ///   @param val the value to output given the provided format string
         ///   @param width a dynamic width which overrides the width field
         ///     in the format string (used to set the width field at runtime).
         ///
-        constexpr fmt(cstr_type const str, VAL_T const &val, safe_umx const &width) noexcept
-            : fmt{fmt_options{str}, val, width}
+        constexpr fmt(fmt_spec const &spec, VAL_T const &val, safe_umx const &width) noexcept
+            : fmt{spec.ops(), val, width}
         {}
 
         /// <!-- description -->
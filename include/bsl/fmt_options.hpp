@@ -32,6 +32,7 @@
 #include "bsl/cstr_type.hpp"
 #include "bsl/cstring.hpp"
 #include "bsl/details/fmt_fsm.hpp"
+#include "bsl/discard.hpp"
 #include "bsl/ensures.hpp"
 #include "bsl/expects.hpp"
 #include "bsl/fmt_align.hpp"
@@ -106,50 +107,8 @@ namespace bsl
         ///
         explicit constexpr fmt_options(cstr_type const f) noexcept
         {
-            safe_idx mut_idx{};
-            details::fmt_fsm mut_fsm{};
-
             expects(nullptr != f);
-
-            auto const len{bsl::builtin_strlen(f)};
-            while (mut_idx < len) {
-                switch (mut_fsm) {    // GRCOV_EXCLUDE_BR
-                    case details::fmt_fsm::fmt_fsm_align: {
-                        this->fmt_options_impl_align(f, mut_idx, len);
-                        mut_fsm = details::fmt_fsm::fmt_fsm_sign;
-                        break;
-                    }
-
-                    case details::fmt_fsm::fmt_fsm_sign: {
-                        this->fmt_options_impl_sign(f, mut_idx);
-                        mut_fsm = details::fmt_fsm::fmt_fsm_alternate_form;
-                        break;
-                    }
-
-                    case details::fmt_fsm::fmt_fsm_alternate_form: {
-                        this->fmt_options_impl_alternate_form(f, mut_idx);
-                        mut_fsm = details::fmt_fsm::fmt_fsm_sign_aware;
-                        break;
-                    }
-
-                    case details::fmt_fsm::fmt_fsm_sign_aware: {
-                        this->fmt_options_impl_sign_aware(f, mut_idx);
-                        mut_fsm = details::fmt_fsm::fmt_fsm_width;
-                        break;
-                    }
-
-                    case details::fmt_fsm::fmt_fsm_width: {
-                        this->fmt_options_impl_width(f, mut_idx, len);
-                        mut_fsm = details::fmt_fsm::fmt_fsm_type;
-                        break;
-                    }
-
-                    case details::fmt_fsm::fmt_fsm_type: {
-                        this->fmt_options_impl_type(f, mut_idx);
-                        break;
-                    }
-                }
-            }
+            bsl::discard(this->parse(f));
         }
 
         /// <!-- description -->
@@ -392,7 +351,88 @@ namespace bsl
             m_type = val;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if every character in the provided format
+        ///     string is part of the {fmt} syntax, meaning it does not
+        ///     contain an unknown character, or anything after the "type"
+        ///     field. A bsl::fmt_options that is created from an invalid
+        ///     format string ignores these characters. bsl::fmt_spec uses
+        ///     this to reject an invalid format string at compile-time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param f the format string to validate
+        ///   @return Returns true if every character in the provided format
+        ///     string is part of the {fmt} syntax, false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_valid(cstr_type const f) noexcept -> bool
+        {
+            expects(nullptr != f);
+
+            fmt_options mut_ops{""};
+            return mut_ops.parse(f);
+        }
+
     private:
+        /// <!-- description -->
+        ///   @brief Parses the provided format string using the fmt_fsm,
+        ///     filling out the fmt_options as it goes.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param f the provided format string to parse
+        ///   @return Returns true if every character in the format string
+        ///     was consumed by the fmt_fsm, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        parse(cstr_type const f) noexcept -> bool
+        {
+            safe_idx mut_idx{};
+            details::fmt_fsm mut_fsm{};
+            bool mut_valid{true};
+
+            auto const len{bsl::builtin_strlen(f)};
+            while (mut_idx < len) {
+                switch (mut_fsm) {    // GRCOV_EXCLUDE_BR
+                    case details::fmt_fsm::fmt_fsm_align: {
+                        this->fmt_options_impl_align(f, mut_idx, len);
+                        mut_fsm = details::fmt_fsm::fmt_fsm_sign;
+                        break;
+                    }
+
+                    case details::fmt_fsm::fmt_fsm_sign: {
+                        this->fmt_options_impl_sign(f, mut_idx);
+                        mut_fsm = details::fmt_fsm::fmt_fsm_alternate_form;
+                        break;
+                    }
+
+                    case details::fmt_fsm::fmt_fsm_alternate_form: {
+                        this->fmt_options_impl_alternate_form(f, mut_idx);
+                        mut_fsm = details::fmt_fsm::fmt_fsm_sign_aware;
+                        break;
+                    }
+
+                    case details::fmt_fsm::fmt_fsm_sign_aware: {
+                        this->fmt_options_impl_sign_aware(f, mut_idx);
+                        mut_fsm = details::fmt_fsm::fmt_fsm_width;
+                        break;
+                    }
+
+                    case details::fmt_fsm::fmt_fsm_width: {
+                        this->fmt_options_impl_width(f, mut_idx, len);
+                        mut_fsm = details::fmt_fsm::fmt_fsm_type;
+                        break;
+                    }
+
+                    case details::fmt_fsm::fmt_fsm_type: {
+                        mut_valid = this->fmt_options_impl_type(f, mut_idx, len);
+                        break;
+                    }
+                }
+            }
+
+            return mut_valid;
+        }
+
         /// <!-- description -->
         ///   @brief Returns the fill value for alignment.
         ///
@@ -682,10 +722,17 @@ namespace bsl
         /// <!-- inputs/outputs -->
         ///   @param f the provided format string to parse
         ///   @param mut_idx the index in the fmt options string to start from
+        ///   @param len the total number of characters in the fmt options
+        ///     string being parsed.
+        ///   @return Returns true if the "type" field is valid and is the
+        ///     last character in the format string, false otherwise.
         ///
-        constexpr void
-        fmt_options_impl_type(cstr_type const f, safe_idx &mut_idx) noexcept
+        [[nodiscard]] constexpr auto
+        fmt_options_impl_type(cstr_type const f, safe_idx &mut_idx, safe_umx const &len) noexcept
+            -> bool
         {
+            bool const last{(mut_idx + safe_idx::magic_1()) == len};
+
             switch (f[mut_idx.get()]) {
                 case 'b': {
                     m_type = fmt_type::fmt_type_b;
@@ -723,11 +770,13 @@ namespace bsl
                 }
 
                 default: {
-                    break;
+                    mut_idx = safe_idx::max_value();
+                    return false;
                 }
             }
 
             mut_idx = safe_idx::max_value();
+            return last;
         }
     };
 
@@ -0,0 +1,107 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file fmt_spec.hpp
+///
+
+#ifndef BSL_FMT_SPEC_HPP
+#define BSL_FMT_SPEC_HPP
+
+#include "bsl/cstr_type.hpp"
+#include "bsl/fmt_options.hpp"
+#include "bsl/touch.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief This function is intentionally not constexpr. It is
+        ///     called by bsl::fmt_spec when the format string is invalid,
+        ///     and since bsl::fmt_spec is always parsed at compile-time,
+        ///     calling it is a compile-time error.
+        ///
+        inline void
+        fmt_spec_is_invalid() noexcept
+        {}
+    }
+
+    /// @class bsl::fmt_spec
+    ///
+    /// <!-- description -->
+    ///   @brief A bsl::fmt_spec is a format string that is always parsed
+    ///     at compile-time. It is what bsl::fmt{"08x", val} converts the
+    ///     string literal to, so the bsl::fmt_options state machine never
+    ///     runs when the program does, and every call site is given a
+    ///     bsl::fmt_options that the compiler already knows the value of.
+    ///     A format string with an unknown character, or with anything
+    ///     after the "type" field (see bsl::fmt_options::is_valid), is a
+    ///     compile-time error. If the format string is only known at
+    ///     runtime, create a bsl::fmt_options from it and give that to
+    ///     bsl::fmt instead, which ignores these characters.
+    ///   @include fmt/example_fmt_spec.hpp
+    ///
+    class fmt_spec final
+    {
+        /// @brief stores the parsed format string
+        fmt_options m_ops;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a bsl::fmt_spec by parsing the provided format
+        ///     string at compile-time. This is not explicit so that a
+        ///     string literal can be given to bsl::fmt directly.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param f the format string to parse
+        ///
+        // NOLINTNEXTLINE(hicpp-explicit-conversions, google-explicit-constructor)
+        consteval fmt_spec(cstr_type const f) noexcept    // --
+            : m_ops{f}
+        {
+            if (!fmt_options::is_valid(f)) {
+                details::fmt_spec_is_invalid();
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the bsl::fmt_options the format string was
+        ///     parsed into.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the bsl::fmt_options the format string was
+        ///     parsed into.
+        ///
+        [[nodiscard]] constexpr auto
+        ops() const noexcept -> fmt_options const &
+        {
+            return m_ops;
+        }
+    };
+}
+
+#endif
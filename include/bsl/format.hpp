@@ -0,0 +1,444 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file format.hpp
+///
+
+#ifndef BSL_FORMAT_HPP
+#define BSL_FORMAT_HPP
+
+#include "bsl/carray.hpp"
+#include "bsl/char_type.hpp"
+#include "bsl/cstdint.hpp"
+#include "bsl/cstr_type.hpp"
+#include "bsl/debug.hpp"
+#include "bsl/declval.hpp"
+#include "bsl/discard.hpp"
+#include "bsl/details/out.hpp"
+#include "bsl/details/out_type_print.hpp"
+#include "bsl/fmt.hpp"
+#include "bsl/fmt_options.hpp"
+#include "bsl/index_sequence.hpp"
+#include "bsl/index_sequence_for.hpp"
+#include "bsl/is_constant_evaluated.hpp"
+#include "bsl/is_detected.hpp"
+#include "bsl/is_null_pointer.hpp"
+#include "bsl/is_pointer.hpp"
+#include "bsl/is_same.hpp"
+#include "bsl/safe_idx.hpp"
+#include "bsl/touch.hpp"
+#include "bsl/type_identity.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief the max number of characters in a "{:spec}" placeholder
+        constexpr bsl::uintmx FORMAT_MAX_SPEC_LEN{static_cast<bsl::uintmx>(15)};
+
+        /// <!-- description -->
+        ///   @brief This function is intentionally not constexpr. It is
+        ///     called by bsl::format_string when the format string does not
+        ///     match its arguments, and since bsl::format_string is always
+        ///     parsed at compile-time, calling it is a compile-time error.
+        ///
+        inline void
+        format_string_is_invalid() noexcept
+        {}
+
+        /// @brief detects if fmt_impl() can output a T with format options
+        template<typename T>
+        using format_fmt_impl_type = decltype(fmt_impl(
+            declval<out<out_type_print>>(), declval<fmt_options const &>(), declval<T const &>()));
+
+        /// @brief true if a T is output using fmt_impl() and supports a "spec"
+        template<typename T>
+        constexpr bool format_supports_fmt{
+            is_detected<format_fmt_impl_type, T>::value && !is_null_pointer<T>::value &&
+            (!is_pointer<T>::value || is_same<T, cstr_type>::value)};
+
+        /// @brief the per-argument default for bsl::format_string
+        template<typename T>
+        constexpr fmt_options format_nullops{nullops};
+    }
+
+    /// @class bsl::format_string
+    ///
+    /// <!-- description -->
+    ///   @brief A bsl::format_string is a whole line of output such as
+    ///     "{} at {:#x}", where each "{}" or "{:spec}" is replaced by the
+    ///     next argument given to bsl::format. The format string is parsed
+    ///     at compile-time (including each "spec", which uses the same
+    ///     syntax as bsl::fmt), and a format string with the wrong number
+    ///     of placeholders for its arguments, a "spec" that is too long or
+    ///     invalid, or a "spec" for a type that does not support bsl::fmt,
+    ///     is a compile-time error. A literal "{" or "}" is written as "{{"
+    ///     or "}}", and a lone "}" is a compile-time error.
+    ///   @include example_format_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam ARGS the types of the arguments being formatted
+    ///
+    template<typename... ARGS>
+    class format_string final
+    {
+        /// @brief stores the number of placeholders in the format string
+        static constexpr bsl::uintmx NUM_ARGS{sizeof...(ARGS)};
+
+        /// @brief stores the format string
+        cstr_type m_str;
+        /// @brief stores the fmt_options for each placeholder
+        carray<fmt_options, NUM_ARGS + static_cast<bsl::uintmx>(1)> m_ops;
+        /// @brief stores where the text before each placeholder begins
+        carray<bsl::uintmx, NUM_ARGS + static_cast<bsl::uintmx>(1)> m_pos;
+        /// @brief stores the length of the text before each placeholder
+        carray<bsl::uintmx, NUM_ARGS + static_cast<bsl::uintmx>(1)> m_len;
+        /// @brief stores true if the text before a placeholder has "{{" or "}}"
+        carray<bool, NUM_ARGS + static_cast<bsl::uintmx>(1)> m_esc;
+
+        /// <!-- description -->
+        ///   @brief Returns true if the characters at idx and idx + 1 are
+        ///     both c, meaning c is an escaped brace.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the character to check
+        ///   @param len the total length of the format string
+        ///   @param c the brace to check for
+        ///   @return Returns true if the characters at idx and idx + 1 are
+        ///     both c, false otherwise.
+        ///
+        [[nodiscard]] consteval auto
+        is_escaped(bsl::uintmx const idx, bsl::uintmx const len, char_type const c) const noexcept
+            -> bool
+        {
+            bsl::uintmx const next{idx + static_cast<bsl::uintmx>(1)};
+            return (next < len) && (c == m_str[idx]) && (c == m_str[next]);
+        }
+
+        /// <!-- description -->
+        ///   @brief Parses the "spec" of a "{:spec}" placeholder that
+        ///     starts at mut_idx, and returns the index of its "}".
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param arg the index of the argument the placeholder belongs to
+        ///   @param mut_idx the index of the first character of the "spec"
+        ///   @param len the total length of the format string
+        ///   @return Returns the index of the "}" that ends the placeholder
+        ///
+        consteval auto
+        parse_spec(bsl::uintmx const arg, bsl::uintmx mut_idx, bsl::uintmx const len) noexcept
+            -> bsl::uintmx
+        {
+            constexpr carray<bool, NUM_ARGS + static_cast<bsl::uintmx>(1)> supported{
+                {details::format_supports_fmt<ARGS>..., false}};
+
+            carray<char_type, details::FORMAT_MAX_SPEC_LEN + static_cast<bsl::uintmx>(1)>
+                mut_spec{};
+
+            for (bsl::uintmx mut_i{}; mut_idx < len; ++mut_idx) {
+                if ('}' == m_str[mut_idx]) {
+                    break;
+                }
+
+                if (!(mut_i < details::FORMAT_MAX_SPEC_LEN)) {
+                    details::format_string_is_invalid();
+                }
+
+                *mut_spec.at_if(mut_i) = m_str[mut_idx];
+                ++mut_i;
+            }
+
+            if (!*supported.at_if(arg)) {
+                details::format_string_is_invalid();
+            }
+
+            if (!fmt_options::is_valid(mut_spec.data())) {
+                details::format_string_is_invalid();
+            }
+
+            *m_ops.at_if(arg) = fmt_options{mut_spec.data()};
+            return mut_idx;
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a bsl::format_string by parsing the provided
+        ///     format string at compile-time. This is not explicit so that
+        ///     a string literal can be given to bsl::format directly.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the format string to parse
+        ///
+        // NOLINTNEXTLINE(hicpp-explicit-conversions, google-explicit-constructor)
+        consteval format_string(cstr_type const str) noexcept    // --
+            : m_str{str}
+            , m_ops{{details::format_nullops<ARGS>..., nullops}}
+            , m_pos{}
+            , m_len{}
+            , m_esc{}
+        {
+            bsl::uintmx const len{builtin_strlen(str).get()};
+
+            bsl::uintmx mut_arg{};
+            bsl::uintmx mut_pos{};
+
+            for (bsl::uintmx mut_idx{}; mut_idx < len; ++mut_idx) {
+                if (this->is_escaped(mut_idx, len, '{') || this->is_escaped(mut_idx, len, '}')) {
+                    *m_esc.at_if(mut_arg) = true;
+                    ++mut_idx;
+                    continue;
+                }
+
+                if ('}' == m_str[mut_idx]) {
+                    details::format_string_is_invalid();
+                }
+
+                if ('{' != m_str[mut_idx]) {
+                    continue;
+                }
+
+                if (!(mut_arg < NUM_ARGS)) {
+                    details::format_string_is_invalid();
+                }
+
+                *m_pos.at_if(mut_arg) = mut_pos;
+                *m_len.at_if(mut_arg) = mut_idx - mut_pos;
+
+                ++mut_idx;
+                if ((mut_idx < len) && (':' == m_str[mut_idx])) {
+                    mut_idx = this->parse_spec(mut_arg, mut_idx + static_cast<bsl::uintmx>(1), len);
+                }
+
+                if (!(mut_idx < len) || ('}' != m_str[mut_idx])) {
+                    details::format_string_is_invalid();
+                }
+
+                mut_pos = mut_idx + static_cast<bsl::uintmx>(1);
+                ++mut_arg;
+            }
+
+            if (NUM_ARGS != mut_arg) {
+                details::format_string_is_invalid();
+            }
+
+            *m_pos.at_if(NUM_ARGS) = mut_pos;
+            *m_len.at_if(NUM_ARGS) = len - mut_pos;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the bsl::fmt_options of the placeholder for
+        ///     the argument at index "arg". A "{}" placeholder returns
+        ///     bsl::nullops.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param arg the index of the argument to get the options for
+        ///   @return Returns the bsl::fmt_options of the placeholder for
+        ///     the argument at index "arg".
+        ///
+        [[nodiscard]] constexpr auto
+        ops(safe_idx const &arg) const noexcept -> fmt_options const &
+        {
+            return *m_ops.at_if(arg.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the text that comes before the placeholder for
+        ///     the argument at index "arg". If "arg" is the number of
+        ///     arguments, the text after the last placeholder is output.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of outputter provided
+        ///   @param o the instance of the outputter used to output the text.
+        ///   @param arg the index of the argument to output the text for
+        ///
+        template<typename T>
+        constexpr void
+        write_text(out<T> const o, safe_idx const &arg) const noexcept
+        {
+            bsl::uintmx const len{*m_len.at_if(arg.get())};
+            if (static_cast<bsl::uintmx>(0) == len) {
+                return;
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            cstr_type const str{m_str + *m_pos.at_if(arg.get())};
+            if (!*m_esc.at_if(arg.get())) {
+                o.write_to_console(str, len);
+                return;
+            }
+
+            /// NOTE:
+            /// - The constructor only accepts a brace in the text if it is
+            ///   doubled, so each brace found here is written once, and the
+            ///   brace that follows it is skipped.
+            ///
+
+            bsl::uintmx mut_start{};
+            for (bsl::uintmx mut_i{}; mut_i < len; ++mut_i) {
+                if (('{' != str[mut_i]) && ('}' != str[mut_i])) {
+                    continue;
+                }
+
+                ++mut_i;
+
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                o.write_to_console(str + mut_start, mut_i - mut_start);
+                mut_start = mut_i + static_cast<bsl::uintmx>(1);
+            }
+
+            if (mut_start < len) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                o.write_to_console(str + mut_start, len - mut_start);
+            }
+            else {
+                bsl::touch();
+            }
+        }
+    };
+
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Outputs the argument at index I, and the text that
+        ///     comes before it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam I the index of the argument being output
+        ///   @tparam T the type of outputter provided
+        ///   @tparam F the type of bsl::format_string provided
+        ///   @tparam U the type of argument being output
+        ///   @param o the instance of the outputter used to output the value.
+        ///   @param f the format string to output
+        ///   @param arg the argument to output
+        ///
+        template<bsl::uintmx I, typename T, typename F, typename U>
+        constexpr void
+        format_arg(out<T> const o, F const &f, U const &arg) noexcept
+        {
+            constexpr safe_idx idx{I};
+            f.write_text(o, idx);
+
+            if constexpr (format_supports_fmt<U>) {
+                // These trigger for c-style strings, which we wish to support.
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay, hicpp-no-array-decay)
+                fmt_impl(o, f.ops(idx), arg);
+            }
+            else {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay, hicpp-no-array-decay)
+                o << arg;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Implements bsl::format
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of outputter provided
+        ///   @tparam F the type of bsl::format_string provided
+        ///   @tparam ARGS the types of the arguments being formatted
+        ///   @tparam IDXS the index of each argument being formatted
+        ///   @param o the instance of the outputter used to output the line.
+        ///   @param f the format string to output
+        ///   @param idxs ignored
+        ///   @param args the arguments to output
+        ///
+        template<typename T, typename F, typename... ARGS, bsl::uintmx... IDXS>
+        constexpr void
+        format_impl(
+            out<T> const o,
+            F const &f,
+            index_sequence<IDXS...> const idxs,
+            ARGS const &...args) noexcept
+        {
+            bsl::discard(idxs);
+
+            (format_arg<IDXS>(o, f, args), ...);
+            constexpr safe_idx idx{sizeof...(ARGS)};
+            f.write_text(o, idx);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Outputs a whole line, given by a format string and its
+    ///     arguments, to the provided outputter. Unlike a chain of "<<",
+    ///     the checks that every "<<" performs are only done once. The
+    ///     line is written to the calling thread's output buffer, so if
+    ///     it fits in the buffer (see details::OUT_BUFFER_SIZE), it is
+    ///     flushed as a single write and cannot be interleaved with the
+    ///     output of other threads. This is not the case if
+    ///     BSL_NO_OUT_BUFFER is defined, in which case each piece of the
+    ///     line is written to the console on its own, or if the line is
+    ///     longer than the buffer, or has a newline before its end, in
+    ///     which case it is written in more than one piece.
+    ///   @include example_format_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of outputter provided
+    ///   @tparam ARGS the types of the arguments being formatted
+    ///   @param o the instance of the outputter used to output the line.
+    ///   @param f the format string to output
+    ///   @param args the arguments to output
+    ///   @return return o
+    ///
+    template<typename T, typename... ARGS>
+    [[maybe_unused]] constexpr auto
+    format(
+        out<T> const o,
+        format_string<type_identity_t<ARGS>...> const &f,
+        ARGS const &...args) noexcept -> out<T>
+    {
+        if (is_constant_evaluated()) {
+            return o;
+        }
+
+        if constexpr (o.empty()) {
+            return o;
+        }
+
+        details::format_impl(o, f, index_sequence_for<ARGS...>{}, args...);
+        return o;
+    }
+
+    /// <!-- description -->
+    ///   @brief Same as bsl::format(bsl::print(), f, args...) << bsl::endl.
+    ///   @include example_format_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam ARGS the types of the arguments being formatted
+    ///   @param f the format string to output
+    ///   @param args the arguments to output
+    ///
+    template<typename... ARGS>
+    constexpr void
+    println(format_string<type_identity_t<ARGS>...> const &f, ARGS const &...args) noexcept
+    {
+        if (is_constant_evaluated()) {
+            return;
+        }
+
+        format(print(), f, args...) << endl;
+    }
+}
+
+#endif
@@ -41,6 +41,57 @@ namespace bsl
 {
     namespace details
     {
+        /// @brief defines the total number of chars parsed per block
+        constexpr bsl::uintmx FROM_CHARS_BLOCK_SIZE{static_cast<bsl::uintmx>(8)};
+        /// @brief defines the number of bits in a char
+        constexpr bsl::uint64 FROM_CHARS_CHAR_BITS{static_cast<bsl::uint64>(8)};
+        /// @brief defines the position of the last char in a block
+        constexpr bsl::uint64 FROM_CHARS_LAST_CHAR_SHIFT{static_cast<bsl::uint64>(56)};
+        /// @brief defines a block with every char set to 0x01
+        constexpr bsl::uint64 FROM_CHARS_ONES{static_cast<bsl::uint64>(0x0101010101010101U)};
+        /// @brief defines a block with the low 7 bits of every char set
+        constexpr bsl::uint64 FROM_CHARS_LOWS{static_cast<bsl::uint64>(0x7F7F7F7F7F7F7F7FU)};
+        /// @brief defines a block with the high bit of every char set
+        constexpr bsl::uint64 FROM_CHARS_HIGHS{static_cast<bsl::uint64>(0x8080808080808080U)};
+        /// @brief defines a block with the low nibble of every char set
+        constexpr bsl::uint64 FROM_CHARS_NIBBLES{static_cast<bsl::uint64>(0x0F0F0F0F0F0F0F0FU)};
+        /// @brief defines a block with the lower case bit of every char set
+        constexpr bsl::uint64 FROM_CHARS_LOWER{static_cast<bsl::uint64>(0x2020202020202020U)};
+        /// @brief defines a block of '0' chars
+        constexpr bsl::uint64 FROM_CHARS_ZEROS{static_cast<bsl::uint64>(0x3030303030303030U)};
+        /// @brief defines the mask used to combine the digits in a block
+        constexpr bsl::uint64 FROM_CHARS_MASK8{static_cast<bsl::uint64>(0x00FF00FF00FF00FFU)};
+        /// @brief defines the mask used to combine the digits in a block
+        constexpr bsl::uint64 FROM_CHARS_MASK16{static_cast<bsl::uint64>(0x0000FFFF0000FFFFU)};
+        /// @brief defines the mask used to combine the digits in a block
+        constexpr bsl::uint64 FROM_CHARS_MASK32{static_cast<bsl::uint64>(0x00000000FFFFFFFFU)};
+        /// @brief defines the shift used to combine the digits in a block
+        constexpr bsl::uint64 FROM_CHARS_SHIFT16{static_cast<bsl::uint64>(16)};
+        /// @brief defines the shift used to combine the digits in a block
+        constexpr bsl::uint64 FROM_CHARS_SHIFT32{static_cast<bsl::uint64>(32)};
+        /// @brief defines the amount added to a hex letter's low nibble
+        constexpr bsl::uint64 FROM_CHARS_HEX_LETTER{static_cast<bsl::uint64>(9)};
+        /// @brief defines the largest value a char in a block can have
+        constexpr bsl::uint64 FROM_CHARS_MAX_CHAR{static_cast<bsl::uint64>(127)};
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided char is whitespace
+        ///     (i.e., ' ', '\t', '\n', '\v', '\f' or '\r').
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the char to query
+        ///   @return Returns true if the provided char is whitespace
+        ///
+        [[nodiscard]] constexpr auto
+        from_chars_is_whitespace(char_type const c) noexcept -> bool
+        {
+            if (' ' == c) {
+                return true;
+            }
+
+            return ('\t' <= c) && (c <= '\r');
+        }
+
         /// <!-- description -->
         ///   @brief Returns the index of the first character in the
         ///     string that is not whitespace.
@@ -55,33 +106,11 @@ namespace bsl
         {
             safe_idx mut_i{};
             for (; mut_i < str.length(); ++mut_i) {
-                char_type const digit{*str.at_if(mut_i)};
-
-                if (' ' == digit) {
-                    continue;
-                }
-
-                if ('\t' == digit) {
-                    continue;
-                }
-
-                if ('\n' == digit) {
-                    continue;
+                if (!from_chars_is_whitespace(*str.at_if(mut_i))) {
+                    break;
                 }
 
-                if ('\v' == digit) {
-                    continue;
-                }
-
-                if ('\f' == digit) {
-                    continue;
-                }
-
-                if ('\r' == digit) {
-                    continue;
-                }
-
-                break;
+                bsl::touch();
             }
 
             if (unlikely(str.length() == mut_i)) {
@@ -92,167 +121,309 @@ namespace bsl
         }
 
         /// <!-- description -->
-        ///   @brief Implements bsl::from_chars for base 10 numbers.
+        ///   @brief Returns a block with the high bit of each char set
+        ///     if lower < char < upper, and cleared otherwise. Chars with
+        ///     their high bit set are never in range.
         ///
         /// <!-- inputs/outputs -->
-        ///   @tparam T The type of integral being parsed
-        ///   @param str the string to parse
-        ///   @param idx the starting position in the string of the base 10
-        ///     number to parse (i.e., the string with whitespace removed)
-        ///   @return Returns the resulting base 10 number.
+        ///   @param chars the block of chars to query
+        ///   @param lower the (exclusive) lower bound of the range
+        ///   @param upper the (exclusive) upper bound of the range
+        ///   @return Returns a block with the high bit of each char set
+        ///     if lower < char < upper, and cleared otherwise.
         ///
-        template<typename T>
         [[nodiscard]] constexpr auto
-        from_chars_parse_dec(string_view const &str, safe_idx const &idx) noexcept
-            -> safe_integral<T>
+        from_chars_block_between(
+            bsl::uint64 const chars, bsl::uint64 const lower, bsl::uint64 const upper) noexcept
+            -> bsl::uint64
         {
-            constexpr safe_integral<T> base10{static_cast<T>(10)};
+            bsl::uint64 const low{chars & FROM_CHARS_LOWS};
+            bsl::uint64 const below{(FROM_CHARS_ONES * (FROM_CHARS_MAX_CHAR + upper)) - low};
+            bsl::uint64 const above{low + (FROM_CHARS_ONES * (FROM_CHARS_MAX_CHAR - lower))};
 
-            bool mut_negate{};
-            safe_integral<T> mut_val{};
+            return below & above & ~chars & FROM_CHARS_HIGHS;
+        }
 
-            auto mut_idx{idx};
-            if constexpr (is_signed<T>::value) {
-                if ('-' == *str.front_if()) {
-                    mut_negate = true;
-                    ++mut_idx;
-                }
-                else {
-                    bsl::touch();
-                }
+        /// <!-- description -->
+        ///   @brief Loads up to FROM_CHARS_BLOCK_SIZE chars from the
+        ///     provided string into a block. The chars are loaded into
+        ///     the end of the block (the first char lands in the lowest
+        ///     byte that is loaded), and the bytes in front of them are
+        ///     filled with '0' so that the block always holds a full
+        ///     FROM_CHARS_BLOCK_SIZE digits with the same value.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to load the chars from
+        ///   @param idx the index of the first char to load
+        ///   @param num the total number of chars to load
+        ///   @return Returns the resulting block
+        ///
+        [[nodiscard]] constexpr auto
+        from_chars_block_load(
+            string_view const &str, bsl::uintmx const idx, bsl::uintmx const num) noexcept
+            -> bsl::uint64
+        {
+            bsl::uint64 mut_chars{FROM_CHARS_ZEROS};
+            for (bsl::uintmx mut_i{}; mut_i < num; ++mut_i) {
+                auto const c{static_cast<bsl::uint8>(*str.at_if(safe_idx{idx + mut_i}))};
+                mut_chars >>= FROM_CHARS_CHAR_BITS;
+                mut_chars |= (static_cast<bsl::uint64>(c) << FROM_CHARS_LAST_CHAR_SHIFT);
             }
 
-            for (safe_idx mut_i{mut_idx}; mut_i < str.length(); ++mut_i) {
-                safe_integral<T> const digit{static_cast<T>(*str.at_if(mut_i))};
-
-                constexpr safe_integral<T> lower_num{static_cast<T>('/')};
-                constexpr safe_integral<T> upper_num{static_cast<T>(':')};
-
-                if (digit > lower_num) {
-                    if (digit < upper_num) {
-                        constexpr safe_integral<T> offset{static_cast<T>('0')};
-                        if constexpr (is_signed<T>::value) {
-                            if (mut_negate) {
-                                mut_val *= base10;
-                                mut_val -= (digit - offset);
-                            }
-                            else {
-                                mut_val *= base10;
-                                mut_val += (digit - offset);
-                            }
-                        }
-                        else {
-                            mut_val *= base10;
-                            mut_val += (digit - offset);
-                        }
-
-                        continue;
-                    }
+            return mut_chars;
+        }
 
-                    bsl::touch();
-                }
-                else {
-                    bsl::touch();
-                }
+        /// <!-- description -->
+        ///   @brief Validates each char in the provided block and converts
+        ///     each of them from a char to the value of the digit it
+        ///     represents. Returns FROM_CHARS_HIGHS if any of the chars
+        ///     is not a digit in the provided base (a value that can
+        ///     never be a block of digits).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param chars the block of chars to convert
+        ///   @param base the base of the digits (2, 8, 10 or 16)
+        ///   @return Returns the resulting block of digits, or
+        ///     FROM_CHARS_HIGHS on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        from_chars_block_digits(bsl::uint64 const chars, bsl::uint64 const base) noexcept
+            -> bsl::uint64
+        {
+            constexpr bsl::uint64 base10{static_cast<bsl::uint64>(10)};
+            constexpr bsl::uint64 base16{static_cast<bsl::uint64>(16)};
 
-                return safe_integral<T>::failure();
+            constexpr auto lower_num{static_cast<bsl::uint64>('/')};
+            constexpr auto lower_zero{static_cast<bsl::uint64>('0')};
+            constexpr auto lower_alpha{static_cast<bsl::uint64>('`')};
+            constexpr auto upper_alpha{static_cast<bsl::uint64>('g')};
+
+            bsl::uint64 mut_upper_num{lower_zero + base};
+            bsl::uint64 mut_alpha{};
+
+            if (base16 == base) {
+                mut_upper_num = lower_zero + base10;
+                mut_alpha = from_chars_block_between(
+                    chars | FROM_CHARS_LOWER, lower_alpha, upper_alpha);
+            }
+            else {
+                bsl::touch();
             }
 
-            if (unlikely(mut_val.is_poisoned())) {
-                return safe_integral<T>::failure();
+            bsl::uint64 const num{from_chars_block_between(chars, lower_num, mut_upper_num)};
+            if (unlikely(FROM_CHARS_HIGHS != (num | mut_alpha))) {
+                return FROM_CHARS_HIGHS;
             }
 
+            /// NOTE:
+            /// - The low nibble of '0'-'9' is the digit itself, and the
+            ///   low nibble of 'a'-'f' and 'A'-'F' is 1-6, so hex letters
+            ///   only need 9 added to them. mut_alpha has the high bit
+            ///   set for each hex letter, which shifted down is a 1 in
+            ///   each of their chars.
+            ///
+
+            constexpr bsl::uint64 alpha_shift{static_cast<bsl::uint64>(7)};
+            bsl::uint64 const letters{(mut_alpha >> alpha_shift) * FROM_CHARS_HEX_LETTER};
+
+            return (chars & FROM_CHARS_NIBBLES) + letters;
+        }
+
+        /// <!-- description -->
+        ///   @brief Combines a block of FROM_CHARS_BLOCK_SIZE digits into
+        ///     the value they represent in the provided base. The first
+        ///     digit (the lowest byte) is the most significant. Each step
+        ///     combines neighbouring pairs of digits into lanes twice as
+        ///     wide, so all eight digits take three steps.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param digits the block of digits to combine
+        ///   @param base the base of the digits (2, 8, 10 or 16)
+        ///   @return Returns the value of the block of digits
+        ///
+        [[nodiscard]] constexpr auto
+        from_chars_block_combine(bsl::uint64 const digits, bsl::uint64 const base) noexcept
+            -> bsl::uint64
+        {
+            bsl::uint64 const base2{base * base};
+            bsl::uint64 const base4{base2 * base2};
+
+            bsl::uint64 mut_val{digits};
+            mut_val = ((mut_val * base) + (mut_val >> FROM_CHARS_CHAR_BITS)) & FROM_CHARS_MASK8;
+            mut_val = ((mut_val * base2) + (mut_val >> FROM_CHARS_SHIFT16)) & FROM_CHARS_MASK16;
+            mut_val = ((mut_val * base4) + (mut_val >> FROM_CHARS_SHIFT32)) & FROM_CHARS_MASK32;
+
             return mut_val;
         }
 
         /// <!-- description -->
-        ///   @brief Implements bsl::from_chars for base 16 numbers.
+        ///   @brief Parses num (at most FROM_CHARS_BLOCK_SIZE) digits from
+        ///     the provided string, starting at idx, and accumulates them
+        ///     into mut_mag (i.e., mut_mag = mut_mag * scale + digits).
         ///
         /// <!-- inputs/outputs -->
-        ///   @tparam T The type of integral being parsed
         ///   @param str the string to parse
-        ///   @param idx the starting position in the string of the base 16
-        ///     number to parse (i.e., the string with whitespace removed)
-        ///   @return Returns the resulting base 16 number.
+        ///   @param idx the index of the first digit to parse
+        ///   @param num the total number of digits to parse
+        ///   @param base the base of the digits (2, 8, 10 or 16)
+        ///   @param scale base raised to the power of num
+        ///   @param mut_mag the magnitude to accumulate the digits into
+        ///   @return Returns false if a char is not a digit, or if the
+        ///     magnitude overflows, true otherwise.
         ///
-        template<typename T>
         [[nodiscard]] constexpr auto
-        from_chars_parse_hex(string_view const &str, safe_idx const &idx) noexcept
-            -> safe_integral<T>
+        from_chars_block_parse(
+            string_view const &str,
+            bsl::uintmx const idx,
+            bsl::uintmx const num,
+            bsl::uint64 const base,
+            bsl::uint64 const scale,
+            bsl::uint64 &mut_mag) noexcept -> bool
         {
-            if constexpr (is_signed<T>::value) {
-                return safe_integral<T>::failure();
+            auto const digits{from_chars_block_digits(from_chars_block_load(str, idx, num), base)};
+            if (unlikely(FROM_CHARS_HIGHS == digits)) {
+                return false;
             }
 
-            constexpr safe_integral<T> base10{static_cast<T>(10)};
-            constexpr safe_integral<T> base16{static_cast<T>(16)};
+            // This is how Clang presents the builtins, which we are required
+            // to use.
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+            if (unlikely(__builtin_mul_overflow(mut_mag, scale, &mut_mag))) {
+                return false;
+            }
 
-            safe_integral<T> mut_val{};
+            auto const val{from_chars_block_combine(digits, base)};
 
-            for (safe_idx mut_i{idx}; mut_i < str.length(); ++mut_i) {
-                safe_integral<T> const digit{static_cast<T>(*str.at_if(mut_i))};
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+            return !__builtin_add_overflow(mut_mag, val, &mut_mag);
+        }
 
-                constexpr safe_integral<T> lower_num{static_cast<T>('/')};
-                constexpr safe_integral<T> upper_num{static_cast<T>(':')};
+        /// <!-- description -->
+        ///   @brief Parses the digits in the provided string, starting at
+        ///     idx, and returns the magnitude of the number they represent.
+        ///     The digits are validated and converted FROM_CHARS_BLOCK_SIZE
+        ///     chars at a time, and overflow is detected once per block.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to parse
+        ///   @param idx the index of the first digit to parse
+        ///   @param base the base of the digits (2, 8, 10 or 16)
+        ///   @return Returns the resulting magnitude, or
+        ///     bsl::safe_u64::failure() if the string contains no digits,
+        ///     contains a char that is not a digit, or the magnitude does
+        ///     not fit in a bsl::uint64.
+        ///
+        [[nodiscard]] constexpr auto
+        from_chars_parse_magnitude(
+            string_view const &str, safe_idx const &idx, bsl::uint64 const base) noexcept
+            -> safe_u64
+        {
+            bsl::uintmx mut_idx{idx.get()};
+            bsl::uintmx const len{str.length().get()};
 
-                if (digit > lower_num) {
-                    if (digit < upper_num) {
-                        constexpr safe_integral<T> offset{static_cast<T>('0')};
-                        mut_val *= base16;
-                        mut_val += (digit - offset);
-                        continue;
-                    }
+            if (unlikely(mut_idx >= len)) {
+                return safe_u64::failure();
+            }
 
-                    bsl::touch();
-                }
-                else {
-                    bsl::touch();
+            bsl::uint64 const base2{base * base};
+            bsl::uint64 const base4{base2 * base2};
+            bsl::uint64 const base8{base4 * base4};
+
+            bsl::uint64 mut_mag{};
+            while ((len - mut_idx) >= FROM_CHARS_BLOCK_SIZE) {
+                if (unlikely(!from_chars_block_parse(
+                        str, mut_idx, FROM_CHARS_BLOCK_SIZE, base, base8, mut_mag))) {
+                    return safe_u64::failure();
                 }
 
-                constexpr safe_integral<T> lower_alpha1{static_cast<T>('@')};
-                constexpr safe_integral<T> upper_alpha1{static_cast<T>('G')};
+                mut_idx += FROM_CHARS_BLOCK_SIZE;
+            }
 
-                if (digit > lower_alpha1) {
-                    if (digit < upper_alpha1) {
-                        constexpr safe_integral<T> offset{static_cast<T>('A')};
-                        mut_val *= base16;
-                        mut_val += base10;
-                        mut_val += (digit - offset);
-                        continue;
-                    }
+            if (mut_idx < len) {
+                bsl::uintmx const num{len - mut_idx};
 
-                    bsl::touch();
+                bsl::uint64 mut_scale{base};
+                for (bsl::uintmx mut_i{static_cast<bsl::uintmx>(1)}; mut_i < num; ++mut_i) {
+                    mut_scale *= base;
                 }
-                else {
-                    bsl::touch();
+
+                if (unlikely(!from_chars_block_parse(
+                        str, mut_idx, num, base, mut_scale, mut_mag))) {
+                    return safe_u64::failure();
                 }
+            }
+            else {
+                bsl::touch();
+            }
 
-                constexpr safe_integral<T> lower_alpha2{static_cast<T>('`')};
-                constexpr safe_integral<T> upper_alpha2{static_cast<T>('g')};
+            return safe_u64{mut_mag};
+        }
 
-                if (digit > lower_alpha2) {
-                    if (digit < upper_alpha2) {
-                        constexpr safe_integral<T> offset{static_cast<T>('a')};
-                        mut_val *= base16;
-                        mut_val += base10;
-                        mut_val += (digit - offset);
-                        continue;
-                    }
+        /// <!-- description -->
+        ///   @brief Implements bsl::from_chars for all supported bases.
+        ///     Only base 10 numbers may be negative, and only when T is
+        ///     signed. The number is parsed as a bsl::uint64 magnitude
+        ///     and checked against the limits of T once at the end.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T The type of integral being parsed
+        ///   @param str the string to parse
+        ///   @param idx the starting position in the string of the number
+        ///     to parse (i.e., the string with whitespace removed)
+        ///   @param base the base of the number (2, 8, 10 or 16)
+        ///   @return Returns the resulting number.
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        from_chars_parse(
+            string_view const &str, safe_idx const &idx, bsl::uint64 const base) noexcept
+            -> safe_integral<T>
+        {
+            constexpr bsl::uint64 base10{static_cast<bsl::uint64>(10)};
+            constexpr auto max{static_cast<bsl::uint64>(safe_integral<T>::max_value().get())};
 
-                    bsl::touch();
+            bool mut_negate{};
+            auto mut_idx{idx};
+
+            if constexpr (is_signed<T>::value) {
+                if (unlikely(base10 != base)) {
+                    return safe_integral<T>::failure();
+                }
+
+                if ('-' == *str.at_if(mut_idx)) {
+                    mut_negate = true;
+                    ++mut_idx;
                 }
                 else {
                     bsl::touch();
                 }
+            }
 
+            auto const mag{from_chars_parse_magnitude(str, mut_idx, base)};
+            if (unlikely(mag.is_invalid())) {
                 return safe_integral<T>::failure();
             }
 
-            if (unlikely(mut_val.is_poisoned())) {
+            /// NOTE:
+            /// - A negative number can be one larger in magnitude than a
+            ///   positive one. The negation is done on the unsigned
+            ///   magnitude, which wraps to the two's complement bit
+            ///   pattern of the result.
+            ///
+
+            if (mut_negate) {
+                if (unlikely(mag.get() > (max + static_cast<bsl::uint64>(1)))) {
+                    return safe_integral<T>::failure();
+                }
+
+                return safe_integral<T>{static_cast<T>(static_cast<bsl::uint64>(0) - mag.get())};
+            }
+
+            if (unlikely(mag.get() > max)) {
                 return safe_integral<T>::failure();
             }
 
-            return mut_val;
+            return safe_integral<T>{static_cast<T>(mag.get())};
         }
     }
 
@@ -269,9 +440,9 @@ namespace bsl
     ///       need for the result structure that std::from_chars has, and
     ///       instead, this function returns the index at which parsing
     ///       stopped (or 0 on failure).
-    ///     - We only support base 10 and base 16. Any other base will return
-    ///       an invalid bsl::save_integral, and an index of 0.
-    ///     - Base 16 can only be an unsigned type.
+    ///     - We only support base 2, 8, 10 and 16. Any other base will
+    ///       return an invalid bsl::save_integral, and an index of 0.
+    ///     - Base 2, 8 and 16 can only be an unsigned type.
     ///     - If the bsl::safe_integral that is provided has already seen an
     ///       error, this function will return a bsl::safe_integral that
     ///       has its error flag set and an index of 0.
@@ -298,7 +469,7 @@ namespace bsl
     /// <!-- inputs/outputs -->
     ///   @tparam T The type of integral to parse
     ///   @param str the string to convert into an integral
-    ///   @param base either 10 or 16
+    ///   @param base either 2, 8, 10 or 16
     ///   @return Returns the index that the parser stopped parsing after
     ///     at when converting the number, or 0 in the event of an error.
     ///
@@ -306,6 +477,8 @@ namespace bsl
     [[maybe_unused]] constexpr auto
     from_chars(string_view const &str, safe_i32 const &base) noexcept -> safe_integral<T>
     {
+        constexpr safe_i32 base2{2};
+        constexpr safe_i32 base8{8};
         constexpr safe_i32 base10{10};
         constexpr safe_i32 base16{16};
 
@@ -320,36 +493,30 @@ namespace bsl
             return safe_integral<T>::failure();
         }
 
-        safe_integral<T> mut_val{};
-        switch (base.get()) {
-            case base10.get(): {
-                mut_val = details::from_chars_parse_dec<T>(str, idx);
-                break;
-            }
-
-            case base16.get(): {
-                mut_val = details::from_chars_parse_hex<T>(str, idx);
-                break;
-            }
+        bool mut_supported{base10 == base};
+        mut_supported = mut_supported || (base16 == base);
+        mut_supported = mut_supported || (base8 == base);
+        mut_supported = mut_supported || (base2 == base);
 
-            default: {
-                mut_val = safe_integral<T>::failure();
-                break;
-            }
+        if (unlikely(!mut_supported)) {
+            return safe_integral<T>::failure();
         }
 
+        auto const raw_base{static_cast<bsl::uint64>(base.get())};
+        auto const val{details::from_chars_parse<T>(str, idx, raw_base)};
+
         /// NOTE:
         /// - If the result is invalid because a conversion encountered an
         ///   error, we simply return an error. If however no error has
         ///   occurred, we ensure that the result is both valid and checked.
         ///
 
-        if (unlikely(mut_val.is_invalid())) {
+        if (unlikely(val.is_invalid())) {
             return safe_integral<T>::failure();
         }
 
-        ensures(mut_val.is_valid_and_checked());
-        return mut_val;
+        ensures(val.is_valid_and_checked());
+        return val;
     }
 }
 
@@ -0,0 +1,183 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file hash.hpp
+///
+
+#ifndef BSL_HASH_HPP
+#define BSL_HASH_HPP
+
+#include "bsl/always_false.hpp"
+#include "bsl/char_type.hpp"
+#include "bsl/cstdint.hpp"
+#include "bsl/is_enum.hpp"
+#include "bsl/is_integral.hpp"
+#include "bsl/is_same.hpp"
+#include "bsl/safe_idx.hpp"
+#include "bsl/safe_integral.hpp"
+#include "bsl/underlying_type.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Mixes the bits of the provided value so that keys that
+        ///     only differ in a few bits (which is common with things like
+        ///     IDs, indexes and page aligned addresses) are spread across
+        ///     the entire 64bit range. This is the SplitMix64 finalizer.
+        ///     Note that the math below is supposed to wrap, which is why
+        ///     raw integers are used instead of a safe_integral.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to mix
+        ///   @return Returns the mixed version of val
+        ///
+        [[nodiscard]] constexpr auto
+        hash_mix(bsl::uint64 const val) noexcept -> bsl::uint64
+        {
+            constexpr bsl::uint64 mul1{static_cast<bsl::uint64>(0xBF58476D1CE4E5B9U)};
+            constexpr bsl::uint64 mul2{static_cast<bsl::uint64>(0x94D049BB133111EBU)};
+            constexpr bsl::uint64 shift1{static_cast<bsl::uint64>(30)};
+            constexpr bsl::uint64 shift2{static_cast<bsl::uint64>(27)};
+            constexpr bsl::uint64 shift3{static_cast<bsl::uint64>(31)};
+
+            bsl::uint64 mut_val{val};
+
+            // NOLINTNEXTLINE(bsl-types-fixed-width-ints-arithmetic-check)
+            mut_val = (mut_val ^ (mut_val >> shift1)) * mul1;
+            // NOLINTNEXTLINE(bsl-types-fixed-width-ints-arithmetic-check)
+            mut_val = (mut_val ^ (mut_val >> shift2)) * mul2;
+
+            return mut_val ^ (mut_val >> shift3);
+        }
+    }
+
+    /// @class bsl::hash
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the hash function used by the BSL's hashed
+    ///     containers like bsl::unordered_map. Like std::hash, this is a
+    ///     customization point. The default implementation supports
+    ///     integral types, bsl::char_type and enums. Specializations are
+    ///     also provided for bsl::safe_integral and bsl::safe_idx. If you
+    ///     need to use any other type as a key, specialize bsl::hash for
+    ///     that type (the specialization must provide a noexcept, const
+    ///     call operator that returns a bsl::safe_umx).
+    ///   @include example_hash_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of key to hash
+    ///
+    template<typename T>
+    class hash final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Returns the hash of the provided key
+        ///   @include example_hash_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key to hash
+        ///   @return Returns the hash of the provided key
+        ///
+        [[nodiscard]] constexpr auto
+        operator()(T const &key) const noexcept -> safe_umx
+        {
+            if constexpr (is_enum<T>::value) {
+                using underlying_t = underlying_type_t<T>;
+                auto const val{static_cast<bsl::uint64>(static_cast<underlying_t>(key))};
+                return safe_umx{static_cast<bsl::uintmx>(details::hash_mix(val))};
+            }
+            else if constexpr (is_integral<T>::value || is_same<T, char_type>::value) {
+                auto const val{static_cast<bsl::uint64>(key)};
+                return safe_umx{static_cast<bsl::uintmx>(details::hash_mix(val))};
+            }
+            else {
+                static_assert(always_false<T>(), "bsl::hash must be specialized for this type");
+                return {};
+            }
+        }
+    };
+
+    /// @class bsl::hash
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the hash function used by the BSL's hashed
+    ///     containers for the bsl::safe_integral type. Note that the
+    ///     key must be valid and checked (like any other read of a
+    ///     bsl::safe_integral).
+    ///   @include example_hash_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the integral type encapsulated by the bsl::safe_integral
+    ///
+    template<typename T>
+    class hash<safe_integral<T>> final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Returns the hash of the provided key
+        ///   @include example_hash_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key to hash
+        ///   @return Returns the hash of the provided key
+        ///
+        [[nodiscard]] constexpr auto
+        operator()(safe_integral<T> const &key) const noexcept -> safe_umx
+        {
+            return hash<T>{}(key.get());
+        }
+    };
+
+    /// @class bsl::hash
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the hash function used by the BSL's hashed
+    ///     containers for the bsl::safe_idx type. Note that the key
+    ///     must be valid (like any other read of a bsl::safe_idx).
+    ///   @include example_hash_overview.hpp
+    ///
+    template<>
+    class hash<safe_idx> final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Returns the hash of the provided key
+        ///   @include example_hash_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key to hash
+        ///   @return Returns the hash of the provided key
+        ///
+        [[nodiscard]] constexpr auto
+        operator()(safe_idx const &key) const noexcept -> safe_umx
+        {
+            return hash<bsl::uintmx>{}(key.get());
+        }
+    };
+}
+
+#endif
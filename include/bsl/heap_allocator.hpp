@@ -0,0 +1,99 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file heap_allocator.hpp
+///
+
+#ifndef BSL_HEAP_ALLOCATOR_HPP
+#define BSL_HEAP_ALLOCATOR_HPP
+
+#include "bsl/discard.hpp"
+#include "bsl/expects.hpp"
+#include "bsl/safe_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::heap_allocator
+    ///
+    /// <!-- description -->
+    ///   @brief The default allocator used by the BSL's containers. Arrays
+    ///     are allocated using new[] and released using delete[], which
+    ///     means that a bsl::heap_allocator can be used in a constexpr.
+    ///     An allocator is a small, copyable handle that provides the
+    ///     following functions:
+    ///     - allocate<U>(count), which returns a pointer to an array of
+    ///       count value initialized U's, or a nullptr on failure.
+    ///     - deallocate<U>(ptr, count), which destroys (and if supported,
+    ///       releases) an array returned by allocate<U>(count).
+    ///     Any type that provides the same functions (for example, a
+    ///     bsl::arena_allocator) can be given to a container in place
+    ///     of the bsl::heap_allocator.
+    ///   @include example_heap_allocator_overview.hpp
+    ///
+    class heap_allocator final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Returns a pointer to an array of count value
+        ///     initialized U's.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U the type of element to allocate
+        ///   @param count the number of elements to allocate. Cannot be 0
+        ///   @return Returns a pointer to an array of count value
+        ///     initialized U's.
+        ///
+        template<typename U>
+        [[nodiscard]] constexpr auto
+        allocate(safe_umx const &count) const noexcept -> U *
+        {
+            expects(count.is_valid_and_checked());
+            expects(count.is_pos());
+
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+            return new U[count.get()]{};
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroys and releases an array that was returned by
+        ///     allocate<U>(count). Passing a nullptr does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U the type of element to deallocate
+        ///   @param pmut_ptr a pointer to the array to deallocate
+        ///   @param count the number of elements in the array (ignored)
+        ///
+        template<typename U>
+        constexpr void
+        deallocate(U *const pmut_ptr, safe_umx const &count) const noexcept
+        {
+            bsl::discard(count);
+
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+            delete[] pmut_ptr;    // GRCOV_EXCLUDE_BR
+        }
+    };
+}
+
+#endif
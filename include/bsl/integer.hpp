@@ -26,6 +26,7 @@
 #define BSL_INTEGER_HPP
 
 #include "bsl/is_signed.hpp"
+#include "bsl/make_unsigned.hpp"
 #include "bsl/numeric_limits.hpp"
 #include "bsl/touch.hpp"
 #include "bsl/unlikely.hpp"
@@ -195,6 +196,215 @@ namespace bsl
         *pmut_cst_res = lhs % rhs;
         return false;
     }
+
+    /// <!-- description -->
+    ///   @brief Sets *res to lhs + rhs, wrapping on overflow, and returns
+    ///     true if the addition overflowed. Unlike builtin_add_overflow,
+    ///     an overflow is not an error, and the overflow is computed from
+    ///     the operands and the wrapped result without a branch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to add
+    ///   @param lhs the left hand side of the operation
+    ///   @param rhs the right hand side of the operation
+    ///   @param pmut_cst_res the (wrapped) result of the operation
+    ///   @return Returns true if the addition overflowed
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    builtin_add_wrap(T const lhs, T const rhs, T *const pmut_cst_res) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            using unsigned_type = make_unsigned_t<T>;
+            auto const ulhs{static_cast<unsigned_type>(lhs)};
+            auto const res{static_cast<T>(ulhs + static_cast<unsigned_type>(rhs))};
+
+            *pmut_cst_res = res;
+            return ((lhs ^ res) & (rhs ^ res)) < 0;
+        }
+        else {
+            auto const res{static_cast<T>(lhs + rhs)};
+
+            *pmut_cst_res = res;
+            return res < lhs;
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Sets *res to lhs - rhs, wrapping on overflow, and returns
+    ///     true if the subtraction overflowed. Unlike builtin_sub_overflow,
+    ///     an overflow is not an error, and the overflow is computed
+    ///     without a branch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to subtract
+    ///   @param lhs the left hand side of the operation
+    ///   @param rhs the right hand side of the operation
+    ///   @param pmut_cst_res the (wrapped) result of the operation
+    ///   @return Returns true if the subtraction overflowed
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    builtin_sub_wrap(T const lhs, T const rhs, T *const pmut_cst_res) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            using unsigned_type = make_unsigned_t<T>;
+            auto const ulhs{static_cast<unsigned_type>(lhs)};
+            auto const res{static_cast<T>(ulhs - static_cast<unsigned_type>(rhs))};
+
+            *pmut_cst_res = res;
+            return ((lhs ^ rhs) & (lhs ^ res)) < 0;
+        }
+        else {
+            *pmut_cst_res = static_cast<T>(lhs - rhs);
+            return lhs < rhs;
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Sets *res to lhs * rhs, wrapping on overflow, and returns
+    ///     true if the multiplication overflowed. Unlike
+    ///     builtin_mul_overflow, an overflow is not an error. Types
+    ///     smaller than 64 bits are multiplied in 64 bits and range
+    ///     checked without a branch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to multiply
+    ///   @param lhs the left hand side of the operation
+    ///   @param rhs the right hand side of the operation
+    ///   @param pmut_cst_res the (wrapped) result of the operation
+    ///   @return Returns true if the multiplication overflowed
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    builtin_mul_wrap(T const lhs, T const rhs, T *const pmut_cst_res) noexcept -> bool
+    {
+        if constexpr (sizeof(T) < sizeof(bsl::uint64)) {
+            if constexpr (is_signed<T>::value) {
+                auto const res{static_cast<bsl::int64>(lhs) * static_cast<bsl::int64>(rhs)};
+                *pmut_cst_res = static_cast<T>(res);
+
+                constexpr auto min{static_cast<bsl::int64>(numeric_limits<T>::min_value())};
+                constexpr auto max{static_cast<bsl::int64>(numeric_limits<T>::max_value())};
+                return (res < min) || (res > max);
+            }
+            else {
+                auto const res{static_cast<bsl::uint64>(lhs) * static_cast<bsl::uint64>(rhs)};
+                *pmut_cst_res = static_cast<T>(res);
+
+                constexpr auto max{static_cast<bsl::uint64>(numeric_limits<T>::max_value())};
+                return res > max;
+            }
+        }
+        else {
+            // This is how Clang presents the builtins, which we are required
+            // top use.
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+            return __builtin_mul_overflow(lhs, rhs, pmut_cst_res);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs + rhs, saturated to the min/max value of T
+    ///     instead of overflowing. The result is selected without a
+    ///     branch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to add
+    ///   @param lhs the left hand side of the operation
+    ///   @param rhs the right hand side of the operation
+    ///   @return Returns lhs + rhs, saturated to the min/max value of T
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    builtin_add_sat(T const lhs, T const rhs) noexcept -> T
+    {
+        T mut_res{};
+        bool const overflow{builtin_add_wrap(lhs, rhs, &mut_res)};
+
+        if constexpr (is_signed<T>::value) {
+            /// NOTE:
+            /// - A signed add can only overflow if lhs and rhs have the
+            ///   same sign, in which case the sign of lhs tells us which
+            ///   way the result overflowed.
+            ///
+
+            bool const neg{lhs < T{}};
+            auto const sat{neg ? numeric_limits<T>::min_value() : numeric_limits<T>::max_value()};
+            return overflow ? sat : mut_res;
+        }
+        else {
+            return overflow ? numeric_limits<T>::max_value() : mut_res;
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs - rhs, saturated to the min/max value of T
+    ///     instead of overflowing. The result is selected without a
+    ///     branch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to subtract
+    ///   @param lhs the left hand side of the operation
+    ///   @param rhs the right hand side of the operation
+    ///   @return Returns lhs - rhs, saturated to the min/max value of T
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    builtin_sub_sat(T const lhs, T const rhs) noexcept -> T
+    {
+        T mut_res{};
+        bool const overflow{builtin_sub_wrap(lhs, rhs, &mut_res)};
+
+        if constexpr (is_signed<T>::value) {
+            /// NOTE:
+            /// - A signed sub can only overflow if lhs and rhs have
+            ///   different signs, in which case the sign of lhs tells us
+            ///   which way the result overflowed.
+            ///
+
+            bool const neg{lhs < T{}};
+            auto const sat{neg ? numeric_limits<T>::min_value() : numeric_limits<T>::max_value()};
+            return overflow ? sat : mut_res;
+        }
+        else {
+            return overflow ? numeric_limits<T>::min_value() : mut_res;
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs * rhs, saturated to the min/max value of T
+    ///     instead of overflowing. The result is selected without a
+    ///     branch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of values to multiply
+    ///   @param lhs the left hand side of the operation
+    ///   @param rhs the right hand side of the operation
+    ///   @return Returns lhs * rhs, saturated to the min/max value of T
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    builtin_mul_sat(T const lhs, T const rhs) noexcept -> T
+    {
+        T mut_res{};
+        bool const overflow{builtin_mul_wrap(lhs, rhs, &mut_res)};
+
+        if constexpr (is_signed<T>::value) {
+            /// NOTE:
+            /// - The result of a signed mul is positive if lhs and rhs
+            ///   have the same sign, which tells us which way the result
+            ///   overflowed.
+            ///
+
+            bool const pos{(lhs < T{}) == (rhs < T{})};
+            auto const sat{pos ? numeric_limits<T>::max_value() : numeric_limits<T>::min_value()};
+            return overflow ? sat : mut_res;
+        }
+        else {
+            return overflow ? numeric_limits<T>::max_value() : mut_res;
+        }
+    }
 }
 
 #endif
@@ -0,0 +1,109 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file lock_guard.hpp
+///
+
+#ifndef BSL_LOCK_GUARD_HPP
+#define BSL_LOCK_GUARD_HPP
+
+namespace bsl
+{
+    /// @class bsl::lock_guard
+    ///
+    /// <!-- description -->
+    ///   @brief Acquires a lock on construction and releases it on
+    ///     destruction, just like a bsl::finally that calls unlock().
+    ///     Works with any type that provides lock() and unlock(), like
+    ///     a bsl::spinlock or a bsl::ticket_lock. A bsl::mcs_lock has
+    ///     its own guard that also stores the node the lock needs.
+    ///   @include example_lock_guard_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam LOCK_T the type of lock to guard
+    ///
+    template<typename LOCK_T>
+    class lock_guard final
+    {
+        /// @brief stores the lock being guarded
+        LOCK_T *m_lock;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Acquires the provided lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_lock the lock to acquire
+        ///
+        explicit lock_guard(LOCK_T &mut_lock) noexcept    // --
+            : m_lock{&mut_lock}
+        {
+            m_lock->lock();
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases the lock that was acquired on construction
+        ///
+        ~lock_guard() noexcept
+        {
+            m_lock->unlock();
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        lock_guard(lock_guard const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        lock_guard(lock_guard &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(lock_guard const &o) &noexcept -> lock_guard & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(lock_guard &&mut_o) &noexcept -> lock_guard & = delete;
+    };
+}
+
+#endif
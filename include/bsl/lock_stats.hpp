@@ -0,0 +1,231 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file lock_stats.hpp
+///
+
+#ifndef BSL_LOCK_STATS_HPP
+#define BSL_LOCK_STATS_HPP
+
+#include "bsl/atomic.hpp"
+#include "bsl/cstdint.hpp"
+#include "bsl/details/cpu_relax.hpp"
+#include "bsl/details/out.hpp"
+#include "bsl/discard.hpp"
+#include "bsl/is_constant_evaluated.hpp"
+#include "bsl/memory_order.hpp"
+#include "bsl/safe_integral.hpp"
+#include "bsl/touch.hpp"
+
+namespace bsl
+{
+#ifdef BSL_LOCK_STATS
+    /// @brief true if the locks record statistics
+    constexpr bool LOCK_STATS_ENABLED{true};
+#else
+    /// @brief true if the locks record statistics
+    constexpr bool LOCK_STATS_ENABLED{false};
+#endif
+
+    /// @class bsl::lock_stats
+    ///
+    /// <!-- description -->
+    ///   @brief Stores contention statistics for a bsl::spinlock,
+    ///     bsl::ticket_lock or bsl::mcs_lock. A lock records its
+    ///     statistics only if BSL_LOCK_STATS is defined. Otherwise the
+    ///     record functions do nothing, and every statistic reads as 0.
+    ///     The lock's owner records the statistics while it holds the
+    ///     lock, so they never race with each other. They can be read
+    ///     (or output using bsl::print()) from any thread at any time.
+    ///   @include example_lock_stats_overview.hpp
+    ///
+    class lock_stats final
+    {
+        /// @brief stores the total number of times the lock was acquired
+        atomic<bsl::uint64> m_acquisitions{};
+        /// @brief stores the total number of times the lock was already held
+        atomic<bsl::uint64> m_contended{};
+        /// @brief stores the total number of times a thread spun on the lock
+        atomic<bsl::uint64> m_spins{};
+        /// @brief stores the longest the lock was ever held for in cycles
+        atomic<bsl::uint64> m_max_hold_cycles{};
+        /// @brief stores the cycle counter when the lock was last acquired
+        bsl::uint64 m_acquired_at{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Records that the lock was just acquired after
+        ///     spinning spins times. Must only be called by the lock,
+        ///     once it is held. Whether the acquisition was contended is
+        ///     decided by the lock when it first tries to take it (e.g.,
+        ///     someone was already queued), and not from spins, as a
+        ///     thread that found the lock held may still get it without
+        ///     ever spinning.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param contended true if the lock was held (or promised to
+        ///     someone else) when the new owner asked for it
+        ///   @param spins the number of times the new owner spun
+        ///
+        void
+        record_acquire(bool const contended, bsl::uint64 const spins) noexcept
+        {
+            if constexpr (LOCK_STATS_ENABLED) {
+                /// NOTE:
+                /// - Only the owner of the lock writes to the stats, so a
+                ///   relaxed load and store is enough, and it is much
+                ///   cheaper than a locked add.
+                ///
+
+                constexpr auto relaxed{memory_order::memory_order_relaxed};
+                auto const one{safe_u64::magic_1()};
+
+                m_acquisitions.store(m_acquisitions.load(relaxed).wrap_add(one), relaxed);
+                if (contended) {
+                    m_contended.store(m_contended.load(relaxed).wrap_add(one), relaxed);
+                    m_spins.store(m_spins.load(relaxed).wrap_add(safe_u64{spins}), relaxed);
+                }
+                else {
+                    bsl::touch();
+                }
+
+                m_acquired_at = details::cpu_cycles();
+            }
+            else {
+                bsl::discard(contended);
+                bsl::discard(spins);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Records that the lock is about to be released. Must
+        ///     only be called by the lock, while it is still held.
+        ///
+        void
+        record_release() noexcept
+        {
+            if constexpr (LOCK_STATS_ENABLED) {
+                constexpr auto relaxed{memory_order::memory_order_relaxed};
+
+                safe_u64 const held{details::cpu_cycles() - m_acquired_at};
+                if (held > m_max_hold_cycles.load(relaxed)) {
+                    m_max_hold_cycles.store(held, relaxed);
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of times the lock was
+        ///     acquired
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of times the lock was
+        ///     acquired
+        ///
+        [[nodiscard]] auto
+        acquisitions() const noexcept -> safe_u64
+        {
+            return m_acquisitions.load(memory_order::memory_order_relaxed);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of times the lock was
+        ///     already held when a thread tried to acquire it
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of times the lock was
+        ///     already held when a thread tried to acquire it
+        ///
+        [[nodiscard]] auto
+        contended() const noexcept -> safe_u64
+        {
+            return m_contended.load(memory_order::memory_order_relaxed);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of times a thread spun while
+        ///     waiting for the lock
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of times a thread spun
+        ///     while waiting for the lock
+        ///
+        [[nodiscard]] auto
+        spins() const noexcept -> safe_u64
+        {
+            return m_spins.load(memory_order::memory_order_relaxed);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the longest the lock was ever held for, in
+        ///     CPU cycles
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the longest the lock was ever held for, in
+        ///     CPU cycles
+        ///
+        [[nodiscard]] auto
+        max_hold_cycles() const noexcept -> safe_u64
+        {
+            return m_max_hold_cycles.load(memory_order::memory_order_relaxed);
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Outputs the provided bsl::lock_stats to the provided
+    ///     output type.
+    ///   @related bsl::lock_stats
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of outputter provided
+    ///   @param o the instance of the outputter used to output the value.
+    ///   @param val the lock_stats to output
+    ///   @return return o
+    ///
+    template<typename T>
+    [[maybe_unused]] constexpr auto
+    operator<<(out<T> const o, lock_stats const &val) noexcept -> out<T>
+    {
+        if (is_constant_evaluated()) {
+            return o;
+        }
+
+        if constexpr (o.empty()) {
+            return o;
+        }
+
+        o << "acquisitions: " << val.acquisitions();
+        o << ", contended: " << val.contended();
+        o << ", spins: " << val.spins();
+        return o << ", max hold cycles: " << val.max_hold_cycles();
+    }
+}
+
+#endif
@@ -0,0 +1,173 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file log_ring.hpp
+///
+
+#ifndef BSL_LOG_RING_HPP
+#define BSL_LOG_RING_HPP
+
+#include "bsl/carray.hpp"
+#include "bsl/cstdint.hpp"
+#include "bsl/details/log_ring.hpp"
+#include "bsl/safe_integral.hpp"
+#include "bsl/string_view.hpp"
+#include "bsl/touch.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief When BSL_LOG_RING is defined, the output of bsl::print,
+    ///     bsl::debug, bsl::alert and bsl::error is not written to the
+    ///     console. Instead, each thread writes its output, one record
+    ///     per line (including the label and thread id prefix), to its
+    ///     own lock-free single-producer ring buffer. This function
+    ///     removes every record that is currently available from all
+    ///     of these rings and gives it to the provided function, in
+    ///     order of the global sequence number assigned to each record
+    ///     when it was written. It is meant to be polled by a single
+    ///     consumer thread, which can then write the output to the
+    ///     console, a file, a serial device, etc. Only the records that
+    ///     are in the rings when this function is called are drained, so
+    ///     producers that keep writing cannot keep it from returning.
+    ///     Records written after that are left for the next call.
+    ///   @note The order is only guaranteed within a single call. A
+    ///     record's sequence number is taken before the record is
+    ///     pushed to its ring, so a record can show up after one with a
+    ///     larger sequence number was already drained, and a later call
+    ///     can return a record that is older than the ones returned by
+    ///     an earlier call. Sequence numbers are also skipped by records
+    ///     that were dropped (see bsl::log_dropped()). A consumer that
+    ///     needs a total order across calls must re-sort the records
+    ///     using their sequence numbers (e.g., by holding records back
+    ///     for a few calls before writing them out).
+    ///   @include example_log_ring_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam FUNC the type of function to call for each record
+    ///   @param mut_func the function to call for each record. It is
+    ///     called as mut_func(seq, level, msg) with a bsl::safe_u64
+    ///     sequence number, the bsl::safe_umx debug level the record
+    ///     was written with and a bsl::string_view of the record's text.
+    ///   @return Returns the total number of records that were drained
+    ///
+    template<typename FUNC>
+    [[maybe_unused]] auto
+    log_drain(FUNC &&mut_func) noexcept -> bsl::safe_umx
+    {
+        bsl::safe_umx mut_total{};
+        carray<bsl::uintmx, details::LOG_RING_TOTAL> mut_left{};
+
+        for (bsl::uintmx mut_i{}; mut_i < details::LOG_RING_TOTAL; ++mut_i) {
+            *mut_left.at_if(mut_i) = details::g_mut_log_rings.at_if(mut_i)->size();
+        }
+
+        while (true) {
+            bsl::uintmx mut_next_i{};
+            details::log_record const *mut_next{};
+
+            for (bsl::uintmx mut_i{}; mut_i < details::LOG_RING_TOTAL; ++mut_i) {
+                if (static_cast<bsl::uintmx>(0) == *mut_left.at_if(mut_i)) {
+                    continue;
+                }
+
+                auto const *const rec{details::g_mut_log_rings.at_if(mut_i)->front()};
+                if ((nullptr == mut_next) || (rec->m_seq < mut_next->m_seq)) {
+                    mut_next_i = mut_i;
+                    mut_next = rec;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            if (nullptr == mut_next) {
+                break;
+            }
+
+            mut_func(
+                bsl::safe_u64{mut_next->m_seq},
+                bsl::safe_umx{mut_next->m_level},
+                bsl::string_view{mut_next->m_data.data(), bsl::safe_umx{mut_next->m_size}});
+
+            details::g_mut_log_rings.at_if(mut_next_i)->pop();
+            --*mut_left.at_if(mut_next_i);
+            ++mut_total;
+        }
+
+        /// NOTE:
+        /// - A bsl::uintmx cannot overflow from counting records that
+        ///   have to be written one at a time.
+        ///
+
+        return mut_total.checked();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the total number of records that were dropped
+    ///     because a thread's log ring was full when it was written to.
+    ///     Producers never block, so if the consumer does not call
+    ///     bsl::log_drain() often enough, records are dropped instead.
+    ///   @include example_log_ring_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the total number of records that were dropped
+    ///
+    [[nodiscard]] inline auto
+    log_dropped() noexcept -> bsl::safe_umx
+    {
+        bsl::safe_umx mut_total{};
+
+        for (bsl::uintmx mut_i{}; mut_i < details::LOG_RING_TOTAL; ++mut_i) {
+            mut_total += details::g_mut_log_rings.at_if(mut_i)->dropped();
+        }
+
+        /// NOTE:
+        /// - A bsl::uintmx cannot overflow from counting records that
+        ///   have to be written one at a time.
+        ///
+
+        return mut_total.checked();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the total number of times output was written to
+    ///     the console instead of a log ring because every log ring was
+    ///     already owned by another thread. A thread gives its log ring
+    ///     back when it exits, so this only happens if more than
+    ///     LOG_RING_TOTAL threads are writing output at the same time.
+    ///   @include example_log_ring_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the total number of times output was written to
+    ///     the console instead of a log ring
+    ///
+    [[nodiscard]] inline auto
+    log_fallbacks() noexcept -> bsl::safe_umx
+    {
+        return bsl::safe_umx{__atomic_load_n(&details::g_mut_log_fallbacks, __ATOMIC_RELAXED)};
+    }
+}
+
+#endif
@@ -0,0 +1,301 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file mcs_lock.hpp
+///
+
+#ifndef BSL_MCS_LOCK_HPP
+#define BSL_MCS_LOCK_HPP
+
+#include "bsl/cstdint.hpp"
+#include "bsl/details/cache_line_size.hpp"
+#include "bsl/details/cpu_relax.hpp"
+#include "bsl/lock_guard.hpp"
+#include "bsl/lock_stats.hpp"
+#include "bsl/touch.hpp"
+#include "bsl/unlikely.hpp"
+
+namespace bsl
+{
+    /// @class bsl::mcs_node
+    ///
+    /// <!-- description -->
+    ///   @brief Stores one thread's place in the queue of a bsl::mcs_lock.
+    ///     A node is given to lock() and must stay alive (and must not be
+    ///     used for anything else) until the matching unlock() returns.
+    ///     A bsl::lock_guard<bsl::mcs_lock> stores its own node.
+    ///
+    class alignas(details::CACHE_LINE_SIZE) mcs_node final
+    {
+        /// @brief allows the mcs_lock to link and release nodes
+        friend class mcs_lock;
+
+        /// @brief stores the node that is waiting behind this one
+        mcs_node *m_next{};
+        /// @brief stores 1 while the owner of this node must wait
+        bsl::uint32 m_waiting{};
+    };
+
+    /// @class bsl::mcs_lock
+    ///
+    /// <!-- description -->
+    ///   @brief A fair, scalable spinlock (Mellor-Crummey and Scott).
+    ///     Threads that want the lock form a queue of bsl::mcs_nodes,
+    ///     and each one spins on a flag in its own node. A release
+    ///     writes only to the next waiter's node, so no matter how many
+    ///     cores are waiting, a hand-off touches one remote cache line.
+    ///     The price is that every lock() and unlock() must be given the
+    ///     same node. The lock never blocks in the OS. Use a
+    ///     bsl::lock_guard to release the lock when leaving a scope.
+    ///   @include example_mcs_lock_overview.hpp
+    ///
+    class mcs_lock final
+    {
+        /// @brief stores the last node in the queue, or nullptr if unlocked
+        mcs_node *m_tail{};
+        /// @brief stores the lock's statistics (see BSL_LOCK_STATS)
+        lock_stats m_stats{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Acquires the lock, spinning until every thread that
+        ///     asked for it first has released it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_node this thread's place in the queue
+        ///
+        void
+        lock(mcs_node &mut_node) noexcept
+        {
+            mut_node.m_next = nullptr;
+            mut_node.m_waiting = static_cast<bsl::uint32>(1);
+
+            auto *const pmut_prev{__atomic_exchange_n(&m_tail, &mut_node, __ATOMIC_ACQ_REL)};
+
+            bsl::uint64 mut_spins{};
+            if (nullptr != pmut_prev) {
+                __atomic_store_n(&pmut_prev->m_next, &mut_node, __ATOMIC_RELEASE);
+                while (static_cast<bsl::uint32>(0) !=
+                       __atomic_load_n(&mut_node.m_waiting, __ATOMIC_ACQUIRE)) {
+                    ++mut_spins;
+                    details::cpu_relax();
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_stats.record_acquire(nullptr != pmut_prev, mut_spins);
+        }
+
+        /// <!-- description -->
+        ///   @brief Acquires the lock if no one holds it or is waiting
+        ///     for it, without spinning.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_node this thread's place in the queue
+        ///   @return Returns true if the lock was acquired, false if it
+        ///     is held by (or promised to) someone else.
+        ///
+        [[nodiscard]] auto
+        try_lock(mcs_node &mut_node) noexcept -> bool
+        {
+            mut_node.m_next = nullptr;
+            mut_node.m_waiting = {};
+
+            mcs_node *mut_expected{};
+            if (!__atomic_compare_exchange_n(
+                    &m_tail, &mut_expected, &mut_node, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+                return false;
+            }
+
+            m_stats.record_acquire(false, {});
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases the lock, handing it to the next node in the
+        ///     queue. Must only be called by the thread that holds the
+        ///     lock, with the same node that was given to lock().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_node this thread's place in the queue
+        ///
+        void
+        unlock(mcs_node &mut_node) noexcept
+        {
+            m_stats.record_release();
+
+            auto *mut_next{__atomic_load_n(&mut_node.m_next, __ATOMIC_ACQUIRE)};
+            if (nullptr == mut_next) {
+                auto *mut_expected{&mut_node};
+                if (__atomic_compare_exchange_n(
+                        &m_tail,
+                        &mut_expected,
+                        nullptr,
+                        false,
+                        __ATOMIC_RELEASE,
+                        __ATOMIC_RELAXED)) {
+                    return;
+                }
+
+                /// NOTE:
+                /// - Someone swapped themselves into m_tail, but has not
+                ///   linked themselves to our node yet. They are about
+                ///   to, so wait for them to do so.
+                ///
+
+                while (nullptr == mut_next) {
+                    details::cpu_relax();
+                    mut_next = __atomic_load_n(&mut_node.m_next, __ATOMIC_ACQUIRE);
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            __atomic_store_n(&mut_next->m_waiting, static_cast<bsl::uint32>(0), __ATOMIC_RELEASE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the lock is held. If other threads
+        ///     are running, the answer might already be out of date when
+        ///     it is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the lock is held.
+        ///
+        [[nodiscard]] auto
+        is_locked() const noexcept -> bool
+        {
+            return nullptr != __atomic_load_n(&m_tail, __ATOMIC_RELAXED);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if a thread is queued behind the provided
+        ///     node, meaning the owner of the node hands the lock directly
+        ///     to that thread when it calls unlock(). The holder of the
+        ///     lock can use this to see if anyone is waiting for it. The
+        ///     node must still be in the queue (unlock() has not been
+        ///     called with it yet). If other threads are running, the
+        ///     answer might already be out of date when it is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param node the node given to lock() to check
+        ///   @return Returns true if a thread is queued behind the
+        ///     provided node.
+        ///
+        [[nodiscard]] static auto
+        has_waiter(mcs_node const &node) noexcept -> bool
+        {
+            return nullptr != __atomic_load_n(&node.m_next, __ATOMIC_ACQUIRE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the lock's statistics. These are only
+        ///     recorded if BSL_LOCK_STATS is defined.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the lock's statistics
+        ///
+        [[nodiscard]] constexpr auto
+        stats() const noexcept -> lock_stats const &
+        {
+            return m_stats;
+        }
+    };
+
+    /// @class bsl::lock_guard<bsl::mcs_lock>
+    ///
+    /// <!-- description -->
+    ///   @brief A bsl::lock_guard for a bsl::mcs_lock. The guard stores
+    ///     the bsl::mcs_node that the lock needs, so it is used just like
+    ///     the guard of any other lock.
+    ///
+    template<>
+    class lock_guard<mcs_lock> final
+    {
+        /// @brief stores the lock being guarded
+        mcs_lock *m_lock;
+        /// @brief stores this thread's place in the lock's queue
+        mcs_node m_node{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Acquires the provided lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_lock the lock to acquire
+        ///
+        explicit lock_guard(mcs_lock &mut_lock) noexcept    // --
+            : m_lock{&mut_lock}
+        {
+            m_lock->lock(m_node);
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases the lock that was acquired on construction
+        ///
+        ~lock_guard() noexcept
+        {
+            m_lock->unlock(m_node);
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        lock_guard(lock_guard const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        lock_guard(lock_guard &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(lock_guard const &o) &noexcept -> lock_guard & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(lock_guard &&mut_o) &noexcept -> lock_guard & = delete;
+    };
+}
+
+#endif
@@ -21,31 +21,29 @@
 /// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 /// SOFTWARE.
+///
+/// @file memory_order.hpp
+///
+
+#ifndef BSL_MEMORY_ORDER_HPP
+#define BSL_MEMORY_ORDER_HPP
 
-#ifndef BSL_DETAILS_UNORDERED_MAP_NODE_TYPE_HPP
-#define BSL_DETAILS_UNORDERED_MAP_NODE_TYPE_HPP
+#include "bsl/cstdint.hpp"
 
-namespace bsl::details
+namespace bsl
 {
-    /// @class bsl::details::unordered_map_node_type
-    ///
     /// <!-- description -->
-    ///   @brief Used by the bsl::unordered_map to implement it's
-    ///     internal linked list.
-    ///
-    /// <!-- template parameters -->
-    ///   @tparam KEY_TYPE the type of key to use
-    ///   @tparam T the type of value to use
+    ///   @brief Defines how an operation on a bsl::atomic is ordered
+    ///     with respect to the memory operations around it. The values
+    ///     are the ones the compiler's __atomic builtins expect.
     ///
-    template<typename KEY_TYPE, typename T>
-    struct unordered_map_node_type final
+    enum class memory_order : bsl::int32
     {
-        /// @brief stores the key for each node in the map
-        KEY_TYPE key;
-        /// @brief stores the data for each node in the map
-        T val;
-        /// @brief stores the next node in the list
-        unordered_map_node_type *next;
+        memory_order_relaxed = __ATOMIC_RELAXED,
+        memory_order_acquire = __ATOMIC_ACQUIRE,
+        memory_order_release = __ATOMIC_RELEASE,
+        memory_order_acq_rel = __ATOMIC_ACQ_REL,
+        memory_order_seq_cst = __ATOMIC_SEQ_CST
     };
 }
 
@@ -0,0 +1,308 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file mpmc_queue.hpp
+///
+
+#ifndef BSL_MPMC_QUEUE_HPP
+#define BSL_MPMC_QUEUE_HPP
+
+#include "bsl/array.hpp"
+#include "bsl/cstdint.hpp"
+#include "bsl/details/cache_line_size.hpp"
+#include "bsl/errc_type.hpp"
+#include "bsl/move.hpp"
+#include "bsl/safe_idx.hpp"
+#include "bsl/safe_integral.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @class bsl::details::mpmc_queue_cell
+        ///
+        /// <!-- description -->
+        ///   @brief Stores a single element of a bsl::mpmc_queue, along
+        ///     with the sequence number that tells the producers and the
+        ///     consumers whose turn it is to use the cell.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam T the type of element being queued.
+        ///
+        template<typename T>
+        class mpmc_queue_cell final
+        {
+        public:
+            /// @brief stores the position this cell is ready for
+            bsl::uintmx m_seq{};
+            /// @brief stores the element
+            T m_data{};
+        };
+    }
+
+    /// @class bsl::mpmc_queue
+    ///
+    /// <!-- description -->
+    ///   @brief A bounded, lock-free queue that any number of threads can
+    ///     push to and pop from (D. Vyukov's bounded MPMC queue). Each
+    ///     cell stores a sequence number, which is its position when it
+    ///     is ready to be pushed to, and its position + 1 when it is
+    ///     ready to be popped from. Producers (and consumers) claim a
+    ///     position with a compare-and-swap on their own index, which are
+    ///     kept in separate cache lines, and then publish the cell by
+    ///     storing its next sequence number with release semantics. The
+    ///     queue never blocks. If it is full (or empty), bsl::errc_failure
+    ///     is returned instead. If there is only one producer and one
+    ///     consumer, a bsl::spsc_queue is faster.
+    ///   @include example_mpmc_queue_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of element being queued.
+    ///   @tparam N the max number of elements in the queue. Must be a
+    ///     power of 2.
+    ///
+    template<typename T, bsl::uintmx N>
+    class mpmc_queue final
+    {
+        static_assert(static_cast<bsl::uintmx>(0) != N, "queues of size 0 are not supported");
+        static_assert(
+            static_cast<bsl::uintmx>(0) == (N & (N - static_cast<bsl::uintmx>(1))),
+            "the size of a queue must be a power of 2");
+
+        /// @brief the mask used to turn a position into an index
+        static constexpr bsl::uintmx MASK{N - static_cast<bsl::uintmx>(1)};
+
+        /// @brief stores the next position to push to
+        alignas(details::CACHE_LINE_SIZE) bsl::uintmx m_head{};
+        /// @brief stores the next position to pop from
+        alignas(details::CACHE_LINE_SIZE) bsl::uintmx m_tail{};
+        /// @brief stores the cells of the queue
+        alignas(details::CACHE_LINE_SIZE) array<details::mpmc_queue_cell<T>, N> m_cells{};
+
+        /// <!-- description -->
+        ///   @brief Claims the next position to push to and returns its
+        ///     cell, or returns a nullptr if the queue is full.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_pos returns the position that was claimed
+        ///   @return Returns the cell that was claimed, or a nullptr if
+        ///     the queue is full.
+        ///
+        [[nodiscard]] auto
+        claim_push(bsl::uintmx &mut_pos) noexcept -> details::mpmc_queue_cell<T> *
+        {
+            mut_pos = __atomic_load_n(&m_head, __ATOMIC_RELAXED);
+            while (true) {
+                auto *const pmut_cell{m_cells.at_if(safe_idx{mut_pos & MASK})};
+                auto const seq{__atomic_load_n(&pmut_cell->m_seq, __ATOMIC_ACQUIRE)};
+
+                if (seq == mut_pos) {
+                    auto const next{mut_pos + static_cast<bsl::uintmx>(1)};
+                    if (__atomic_compare_exchange_n(
+                            &m_head, &mut_pos, next, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                        return pmut_cell;
+                    }
+                }
+                else if (seq < mut_pos) {
+                    return nullptr;
+                }
+                else {
+                    mut_pos = __atomic_load_n(&m_head, __ATOMIC_RELAXED);
+                }
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Claims the next position to pop from and returns its
+        ///     cell, or returns a nullptr if the queue is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_pos returns the position that was claimed
+        ///   @return Returns the cell that was claimed, or a nullptr if
+        ///     the queue is empty.
+        ///
+        [[nodiscard]] auto
+        claim_pop(bsl::uintmx &mut_pos) noexcept -> details::mpmc_queue_cell<T> *
+        {
+            mut_pos = __atomic_load_n(&m_tail, __ATOMIC_RELAXED);
+            while (true) {
+                auto *const pmut_cell{m_cells.at_if(safe_idx{mut_pos & MASK})};
+                auto const seq{__atomic_load_n(&pmut_cell->m_seq, __ATOMIC_ACQUIRE)};
+                auto const ready{mut_pos + static_cast<bsl::uintmx>(1)};
+
+                if (seq == ready) {
+                    if (__atomic_compare_exchange_n(
+                            &m_tail, &mut_pos, ready, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                        return pmut_cell;
+                    }
+                }
+                else if (seq < ready) {
+                    return nullptr;
+                }
+                else {
+                    mut_pos = __atomic_load_n(&m_tail, __ATOMIC_RELAXED);
+                }
+            }
+        }
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+        /// @brief alias for: safe_umx
+        using size_type = safe_umx;
+
+        /// <!-- description -->
+        ///   @brief Creates an empty bsl::mpmc_queue
+        ///
+        constexpr mpmc_queue() noexcept
+        {
+            for (safe_idx mut_i{}; mut_i < N; ++mut_i) {
+                m_cells.at_if(mut_i)->m_seq = mut_i.get();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Copies val to the back of the queue.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the element to push
+        ///   @return Returns bsl::errc_success on success, or
+        ///     bsl::errc_failure if the queue is full.
+        ///
+        [[nodiscard]] auto
+        try_push(T const &val) noexcept -> errc_type
+        {
+            bsl::uintmx mut_pos{};
+            auto *const pmut_cell{this->claim_push(mut_pos)};
+            if (nullptr == pmut_cell) {
+                return errc_failure;
+            }
+
+            pmut_cell->m_data = val;
+            auto const seq{mut_pos + static_cast<bsl::uintmx>(1)};
+            __atomic_store_n(&pmut_cell->m_seq, seq, __ATOMIC_RELEASE);
+
+            return errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves mut_val to the back of the queue. If the queue
+        ///     is full, mut_val is not moved from.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_val the element to push
+        ///   @return Returns bsl::errc_success on success, or
+        ///     bsl::errc_failure if the queue is full.
+        ///
+        [[nodiscard]] auto
+        try_push(T &&mut_val) noexcept -> errc_type
+        {
+            bsl::uintmx mut_pos{};
+            auto *const pmut_cell{this->claim_push(mut_pos)};
+            if (nullptr == pmut_cell) {
+                return errc_failure;
+            }
+
+            pmut_cell->m_data = bsl::move(mut_val);
+            auto const seq{mut_pos + static_cast<bsl::uintmx>(1)};
+            __atomic_store_n(&pmut_cell->m_seq, seq, __ATOMIC_RELEASE);
+
+            return errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves the element at the front of the queue into
+        ///     mut_val and removes it from the queue. If the queue is
+        ///     empty, mut_val is not changed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_val where to move the popped element to
+        ///   @return Returns bsl::errc_success on success, or
+        ///     bsl::errc_failure if the queue is empty.
+        ///
+        [[nodiscard]] auto
+        try_pop(T &mut_val) noexcept -> errc_type
+        {
+            bsl::uintmx mut_pos{};
+            auto *const pmut_cell{this->claim_pop(mut_pos)};
+            if (nullptr == pmut_cell) {
+                return errc_failure;
+            }
+
+            mut_val = bsl::move(pmut_cell->m_data);
+            auto const seq{mut_pos + N};
+            __atomic_store_n(&pmut_cell->m_seq, seq, __ATOMIC_RELEASE);
+
+            return errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the queue has no elements. If other
+        ///     threads are using the queue, the answer might already be
+        ///     out of date when it is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the queue has no elements.
+        ///
+        [[nodiscard]] auto
+        empty() const noexcept -> bool
+        {
+            return this->size().is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of elements that have been claimed
+        ///     by producers but not yet by consumers. If other threads are
+        ///     using the queue, the answer might already be out of date
+        ///     when it is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of elements in the queue.
+        ///
+        [[nodiscard]] auto
+        size() const noexcept -> size_type
+        {
+            auto const tail{__atomic_load_n(&m_tail, __ATOMIC_ACQUIRE)};
+            auto const head{__atomic_load_n(&m_head, __ATOMIC_ACQUIRE)};
+
+            return size_type{head - tail};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max number of elements the queue can
+        ///     store (i.e., N)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max number of elements the queue can
+        ///     store (i.e., N)
+        ///
+        [[nodiscard]] static constexpr auto
+        max_size() noexcept -> size_type
+        {
+            return size_type{N};
+        }
+    };
+}
+
+#endif
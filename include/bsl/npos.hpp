@@ -32,7 +32,8 @@
 
 namespace bsl
 {
-    /// @brief defines npos
+    /// @brief defines npos. npos is safe_idx::max_value(), which is a
+    ///   valid index that never compares equal to a poisoned safe_idx.
     constexpr auto npos{safe_idx::max_value()};
 }
 
@@ -0,0 +1,343 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file object_pool.hpp
+///
+
+#ifndef BSL_OBJECT_POOL_HPP
+#define BSL_OBJECT_POOL_HPP
+
+#include "bsl/construct_at.hpp"
+#include "bsl/cstdint.hpp"
+#include "bsl/destroy_at.hpp"
+#include "bsl/ensures.hpp"
+#include "bsl/expects.hpp"
+#include "bsl/forward.hpp"
+#include "bsl/is_nothrow_destructible.hpp"
+#include "bsl/is_trivially_destructible.hpp"
+#include "bsl/numeric_limits.hpp"
+#include "bsl/safe_idx.hpp"
+#include "bsl/safe_integral.hpp"
+#include "bsl/touch.hpp"
+#include "bsl/unlikely.hpp"
+
+namespace bsl
+{
+    /// @class bsl::object_pool
+    ///
+    /// <!-- description -->
+    ///   @brief Implements a fixed-size slab of N slots, each of which can
+    ///     hold a single T. create() constructs a T in a free slot and
+    ///     destroy() destroys it and gives its slot back. Both are O(1)
+    ///     and never touch the global heap. Free slots are kept on an
+    ///     intrusive free list (by index), and slots that have never been
+    ///     used are handed out in order, so creating a pool costs nothing
+    ///     no matter how large N is. If the pool is full, create()
+    ///     returns a nullptr. The storage is raw memory, so a
+    ///     bsl::object_pool cannot be used in a constant expression.
+    ///   @include example_object_pool_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of object being stored.
+    ///   @tparam N the max number of objects that can be stored. Cannot be 0
+    ///
+    template<typename T, bsl::uintmx N>
+    class object_pool final
+    {
+        static_assert(static_cast<bsl::uintmx>(0) != N, "pools of size 0 are not supported");
+        static_assert(is_nothrow_destructible<T>::value);
+
+        /// @brief marks a slot as holding a live object in m_next
+        static constexpr bsl::uintmx LIVE{numeric_limits<bsl::uintmx>::max_value()};
+        /// @brief marks the end of the free list
+        static constexpr bsl::uintmx NONE{N};
+
+        /// @brief stores the (possibly unconstructed) objects
+        alignas(T) bsl::uint8 m_storage[sizeof(T) * N];    // NOLINT
+        /// @brief stores the next free slot of each free slot, or LIVE
+        bsl::uintmx m_next[N];    // NOLINT
+        /// @brief stores the first slot on the free list
+        bsl::uintmx m_head{NONE};
+        /// @brief stores the number of slots that have ever been used
+        safe_umx m_high{};
+        /// @brief stores the number of live objects
+        safe_umx m_size{};
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the storage of the slot at
+        ///     index "index", which may not hold a live object.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the slot to return
+        ///   @return Returns a pointer to the storage of the slot at
+        ///     index "index".
+        ///
+        [[nodiscard]] auto
+        storage(bsl::uintmx const index) noexcept -> T *
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto *const pmut_base{reinterpret_cast<T *>(m_storage)};
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return pmut_base + index;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the slot that holds the object
+        ///     pointed to by ptr. ptr must point to a live object that was
+        ///     returned by create() from this pool.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr a pointer to the object to get the slot of
+        ///   @return Returns the index of the slot that holds ptr
+        ///
+        [[nodiscard]] auto
+        slot_of(T const *const ptr) noexcept -> bsl::uintmx
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto const base{reinterpret_cast<bsl::uintmx>(m_storage)};
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto const addr{reinterpret_cast<bsl::uintmx>(ptr)};
+
+            expects(addr >= base);
+            auto const offset{addr - base};
+
+            expects(static_cast<bsl::uintmx>(0) == (offset % sizeof(T)));
+            auto const index{offset / sizeof(T)};
+
+            expects(index < m_high.get());
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            expects(LIVE == m_next[index]);
+
+            return index;
+        }
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+        /// @brief alias for: safe_umx
+        using size_type = safe_umx;
+        /// @brief alias for: T *
+        using pointer_type = T *;
+
+        /// <!-- description -->
+        ///   @brief Creates an empty bsl::object_pool. No objects are
+        ///     constructed, and no slots are touched.
+        ///
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init, hicpp-member-init)
+        object_pool() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::object_pool,
+        ///     destroying any objects that are still live.
+        ///
+        ~object_pool() noexcept
+        {
+            this->clear();
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        object_pool(object_pool const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        object_pool(object_pool &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(object_pool const &o) &noexcept -> object_pool & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(object_pool &&mut_o) &noexcept -> object_pool & = delete;
+
+        /// <!-- description -->
+        ///   @brief Constructs a T in a free slot using the provided
+        ///     arguments, and returns a pointer to it. If the pool is
+        ///     full, a nullptr is returned and nothing is constructed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam ARGS the types of args to construct the T with
+        ///   @param pudm_udm_args the args to construct the T with
+        ///   @return Returns a pointer to the newly constructed T, or a
+        ///     nullptr if the pool is full.
+        ///
+        template<typename... ARGS>
+        [[nodiscard]] auto
+        create(ARGS &&...pudm_udm_args) noexcept -> pointer_type
+        {
+            /// NOTE:
+            /// - The m_high and m_size math below is really acting as an
+            ///   index so it is marked as checked. Neither can exceed N.
+            ///
+
+            bsl::uintmx mut_index{};
+            if (NONE != m_head) {
+                mut_index = m_head;
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                m_head = m_next[mut_index];
+            }
+            else {
+                if (unlikely(capacity() == m_high)) {
+                    return nullptr;
+                }
+
+                mut_index = m_high.get();
+                m_high = (m_high + safe_umx::magic_1()).checked();
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            m_next[mut_index] = LIVE;
+            m_size = (m_size + safe_umx::magic_1()).checked();
+
+            return bsl::construct_at<T>(
+                this->storage(mut_index), bsl::forward<ARGS>(pudm_udm_args)...);
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroys the object pointed to by pmut_ptr and gives
+        ///     its slot back to the pool. pmut_ptr must have been returned
+        ///     by create() from this pool, and must not have already been
+        ///     destroyed. Passing a nullptr does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_ptr a pointer to the object to destroy
+        ///
+        void
+        destroy(pointer_type const pmut_ptr) noexcept
+        {
+            if (nullptr == pmut_ptr) {
+                return;
+            }
+
+            auto const index{this->slot_of(pmut_ptr)};
+            bsl::destroy_at(pmut_ptr);
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            m_next[index] = m_head;
+            m_head = index;
+
+            /// NOTE:
+            /// - The m_size math below is really acting as an index
+            ///   so it is marked as checked. It cannot underflow.
+            ///
+
+            m_size = (m_size - safe_umx::magic_1()).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroys every live object and gives every slot back
+        ///     to the pool. If T is trivially destructible, this is O(1).
+        ///     Otherwise, every slot that has ever been used is visited.
+        ///
+        void
+        clear() noexcept
+        {
+            if constexpr (!is_trivially_destructible<T>::value) {
+                for (safe_idx mut_i{}; mut_i < m_high; ++mut_i) {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                    if (LIVE == m_next[mut_i.get()]) {
+                        bsl::destroy_at(this->storage(mut_i.get()));
+                    }
+                    else {
+                        bsl::touch();
+                    }
+                }
+            }
+
+            m_head = NONE;
+            m_high = {};
+            m_size = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of live objects in the pool
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of live objects in the pool
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> size_type const &
+        {
+            ensures(m_size.is_valid_and_checked());
+            return m_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max number of objects the pool can hold
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max number of objects the pool can hold
+        ///
+        [[nodiscard]] static constexpr auto
+        capacity() noexcept -> size_type
+        {
+            return size_type{N};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns size() == 0
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns size() == 0
+        ///
+        [[nodiscard]] constexpr auto
+        empty() const noexcept -> bool
+        {
+            return m_size.is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns size() == capacity()
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns size() == capacity()
+        ///
+        [[nodiscard]] constexpr auto
+        full() const noexcept -> bool
+        {
+            return capacity() == m_size;
+        }
+    };
+}
+
+#endif
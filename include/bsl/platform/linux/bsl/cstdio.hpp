@@ -50,7 +50,8 @@ namespace bsl
     }
 
     /// <!-- description -->
-    ///   @brief Output a string to stdout
+    ///   @brief Output a string to stdout. All len bytes are output,
+    ///     including any NUL chars.
     ///
     /// <!-- inputs/outputs -->
     ///   @param str the string to output
@@ -59,7 +60,7 @@ namespace bsl
     constexpr void
     stdio_out_cstr(bsl::cstr_type const str, bsl::uintmx const len) noexcept
     {
-        return ::fprintf(stdout, "%*.*s", len, len, str);
+        return ::fwrite(str, sizeof(bsl::char_type), len, stdout);
     }
 }
 
@@ -0,0 +1,110 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#ifndef BSL_DETAILS_ATOMIC_WAIT_HPP
+#define BSL_DETAILS_ATOMIC_WAIT_HPP
+
+#include <linux/futex.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/numeric_limits.hpp>
+#include <bsl/touch.hpp>
+
+namespace bsl::details
+{
+    /// <!-- description -->
+    ///   @brief Blocks the calling thread until it is woken up by
+    ///     atomic_notify(), as long as *pudm_addr still equals old when
+    ///     the kernel looks at it. 32bit values use a futex. Anything
+    ///     else cannot be waited on by the kernel, so the thread yields
+    ///     instead. Like a futex, this can return early, so the caller
+    ///     must check the value again.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of value being waited on
+    ///   @param pudm_addr the address of the value being waited on
+    ///   @param old the value to wait on to change
+    ///
+    template<typename T>
+    inline void
+    atomic_wait(T const *const pudm_addr, T const old) noexcept
+    {
+        if constexpr (sizeof(T) == sizeof(bsl::int32)) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+            bsl::discard(::syscall(
+                SYS_futex,
+                pudm_addr,
+                FUTEX_WAIT_PRIVATE,
+                static_cast<bsl::int32>(old),
+                nullptr,
+                nullptr,
+                0));
+        }
+        else {
+            bsl::discard(pudm_addr);
+            bsl::discard(old);
+            bsl::discard(::sched_yield());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Wakes up one (or all) threads that are blocked in
+    ///     atomic_wait() on pudm_addr. Values that are not 32bit are
+    ///     never blocked on, so there is nothing to wake up.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of value being waited on
+    ///   @param pudm_addr the address of the value being waited on
+    ///   @param all if true, all threads are woken up, otherwise one
+    ///
+    template<typename T>
+    inline void
+    atomic_notify(T const *const pudm_addr, bool const all) noexcept
+    {
+        if constexpr (sizeof(T) == sizeof(bsl::int32)) {
+            bsl::int32 mut_count{1};
+            if (all) {
+                mut_count = numeric_limits<bsl::int32>::max_value();
+            }
+            else {
+                bsl::touch();
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+            bsl::discard(::syscall(
+                SYS_futex, pudm_addr, FUTEX_WAKE_PRIVATE, mut_count, nullptr, nullptr, 0));
+        }
+        else {
+            bsl::discard(pudm_addr);
+            bsl::discard(all);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,69 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file bench_clock.hpp
+///
+
+#ifndef BSL_BENCH_CLOCK_HPP
+#define BSL_BENCH_CLOCK_HPP
+
+#include <windows.h>
+
+#include <bsl/cstdint.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Returns the current value of the system's monotonic
+    ///     clock in nanoseconds. Only the difference between two calls
+    ///     has any meaning.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the current value of the monotonic clock in
+    ///     nanoseconds
+    ///
+    [[nodiscard]] inline auto
+    bench_clock_ns() noexcept -> bsl::uint64
+    {
+        constexpr bsl::uint64 ns_per_sec{static_cast<bsl::uint64>(1000000000)};
+
+        LARGE_INTEGER mut_freq{};
+        LARGE_INTEGER mut_count{};
+        if ((0 == QueryPerformanceFrequency(&mut_freq)) ||
+            (0 == QueryPerformanceCounter(&mut_count))) {
+            return {};
+        }
+
+        /// NOTE:
+        /// - The whole seconds and the remainder are converted on their
+        ///   own so that the multiply cannot overflow.
+        ///
+
+        auto const freq{static_cast<bsl::uint64>(mut_freq.QuadPart)};
+        auto const count{static_cast<bsl::uint64>(mut_count.QuadPart)};
+        return ((count / freq) * ns_per_sec) + (((count % freq) * ns_per_sec) / freq);
+    }
+}
+
+#endif
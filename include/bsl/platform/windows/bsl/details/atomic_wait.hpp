@@ -0,0 +1,83 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#ifndef BSL_DETAILS_ATOMIC_WAIT_HPP
+#define BSL_DETAILS_ATOMIC_WAIT_HPP
+
+#include <windows.h>
+
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+
+#pragma comment(lib, "Synchronization.lib")
+
+namespace bsl::details
+{
+    /// <!-- description -->
+    ///   @brief Blocks the calling thread until it is woken up by
+    ///     atomic_notify(), as long as *pudm_addr still equals old when
+    ///     the OS looks at it. This can return early, so the caller
+    ///     must check the value again.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of value being waited on
+    ///   @param pudm_addr the address of the value being waited on
+    ///   @param old the value to wait on to change
+    ///
+    template<typename T>
+    inline void
+    atomic_wait(T const *const pudm_addr, T const old) noexcept
+    {
+        T mut_old{old};
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        bsl::discard(WaitOnAddress(const_cast<T *>(pudm_addr), &mut_old, sizeof(T), INFINITE));
+    }
+
+    /// <!-- description -->
+    ///   @brief Wakes up one (or all) threads that are blocked in
+    ///     atomic_wait() on pudm_addr.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of value being waited on
+    ///   @param pudm_addr the address of the value being waited on
+    ///   @param all if true, all threads are woken up, otherwise one
+    ///
+    template<typename T>
+    inline void
+    atomic_notify(T const *const pudm_addr, bool const all) noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        auto *const pmut_addr{const_cast<T *>(pudm_addr)};
+        if (all) {
+            WakeByAddressAll(pmut_addr);
+        }
+        else {
+            WakeByAddressSingle(pmut_addr);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,301 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file safe_array.hpp
+///
+
+#ifndef BSL_SAFE_ARRAY_HPP
+#define BSL_SAFE_ARRAY_HPP
+
+#include "bsl/cstdint.hpp"
+#include "bsl/details/poison_bitmap.hpp"
+#include "bsl/ensures.hpp"
+#include "bsl/expects.hpp"
+#include "bsl/is_integral.hpp"
+#include "bsl/safe_idx.hpp"
+#include "bsl/safe_integral.hpp"
+#include "bsl/unlikely.hpp"
+
+namespace bsl
+{
+    /// @class bsl::safe_array
+    ///
+    /// <!-- description -->
+    ///   @brief Provides an array of bsl::safe_integral<T> that stores
+    ///     the raw T values contiguously and keeps the poisoned state of
+    ///     each element in a side bitmap (one bit per element). A
+    ///     bsl::array<bsl::safe_u64, N> needs 16 bytes per element because
+    ///     of the flags (and their padding) that each safe_integral
+    ///     carries, while a bsl::safe_array<bsl::uint64, N> needs 8 bytes
+    ///     plus 1 bit per element, so tables of counters and addresses
+    ///     use half the cache.
+    ///     - Elements are written using set(), which records whether the
+    ///       provided safe_integral was poisoned, and read using get(),
+    ///       which returns a safe_integral that is either valid and
+    ///       checked, or poisoned and unchecked (meaning the result must
+    ///       be checked, just like the result of any other math that
+    ///       failed).
+    ///     - Like bsl::array, a bsl::safe_array is an aggregate and does
+    ///       not support N == 0. An aggregate initialized safe_array has
+    ///       no poisoned elements.
+    ///     - data() provides the raw values for loops that do not need
+    ///       the safe_integral wrapper. Writing through data() does not
+    ///       change the poisoned state of an element.
+    ///   @include example_safe_array_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the integral type of the elements being stored.
+    ///   @tparam N the total number of elements in the array. Cannot be 0
+    ///
+    template<typename T, bsl::uintmx N>
+    class safe_array final
+    {
+        static_assert(static_cast<bsl::uintmx>(0) != N, "arrays of size 0 are not supported");
+        static_assert(is_integral<T>::value, "only integral types are supported");
+
+    public:
+        /// @brief stores the raw values of the array
+        T m_data[N];    // NOLINT
+        /// @brief stores one poisoned bit for each element in m_data
+        bsl::uint64 m_poisoned[details::poison_bitmap_words(N)];    // NOLINT
+
+        /// @brief alias for: T
+        using value_type = T;
+        /// @brief alias for: safe_umx
+        using size_type = safe_umx;
+        /// @brief alias for: safe_idx
+        using index_type = safe_idx;
+        /// @brief alias for: T *
+        using pointer_type = T *;
+        /// @brief alias for: T const *
+        using const_pointer_type = T const *;
+
+        /// <!-- description -->
+        ///   @brief Returns the element stored at index "index" as a
+        ///     bsl::safe_integral<T>. If the element was poisoned when it
+        ///     was set, the result is poisoned and unchecked. If the index
+        ///     is out of bounds, bsl::safe_integral<T>::failure() is
+        ///     returned.
+        ///   @include safe_array/example_safe_array_get.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the element to return
+        ///   @return Returns the element stored at index "index" as a
+        ///     bsl::safe_integral<T>. If the element was poisoned when it
+        ///     was set, the result is poisoned and unchecked. If the index
+        ///     is out of bounds, bsl::safe_integral<T>::failure() is
+        ///     returned.
+        ///
+        [[nodiscard]] constexpr auto
+        get(index_type const &index) const noexcept -> safe_integral<T>
+        {
+            expects(index.is_valid());
+
+            if (unlikely(index >= N)) {
+                return safe_integral<T>::failure();
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            auto const val{m_data[index.get()]};
+            if (unlikely(details::poison_bitmap_test(this->poisoned_data(), index.get()))) {
+                return safe_integral<T>{val, safe_integral<T>::failure()};
+            }
+
+            return safe_integral<T>{val};
+        }
+
+        /// <!-- description -->
+        ///   @brief Stores "val" at index "index". The raw value of "val"
+        ///     is stored even if "val" is poisoned, and whether or not
+        ///     "val" is poisoned is recorded in the side bitmap. If the
+        ///     index is out of bounds, nothing is stored.
+        ///   @include safe_array/example_safe_array_set.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the element to set
+        ///   @param val the value to set the element to
+        ///
+        constexpr void
+        set(index_type const &index, safe_integral<T> const &val) noexcept
+        {
+            expects(index.is_valid());
+
+            if (unlikely(index >= N)) {
+                unlikely_invalid_argument_failure();
+                return;
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            m_data[index.get()] = val.cdata_as_ref();
+            details::poison_bitmap_assign(this->poisoned_data(), index.get(), val.is_invalid());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the element stored at index "index" is
+        ///     poisoned, or if the index is out of bounds. Returns false
+        ///     otherwise.
+        ///   @include safe_array/example_safe_array_is_poisoned.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the element to query
+        ///   @return Returns true if the element stored at index "index"
+        ///     is poisoned, or if the index is out of bounds. Returns false
+        ///     otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        is_poisoned(index_type const &index) const noexcept -> bool
+        {
+            expects(index.is_valid());
+
+            if (unlikely(index >= N)) {
+                return true;
+            }
+
+            return details::poison_bitmap_test(this->poisoned_data(), index.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if any element in the array is poisoned.
+        ///     This only reads the side bitmap, one word per 64 elements.
+        ///   @include safe_array/example_safe_array_is_any_poisoned.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if any element in the array is poisoned.
+        ///
+        [[nodiscard]] constexpr auto
+        is_any_poisoned() const noexcept -> bool
+        {
+            return details::poison_bitmap_any(this->poisoned_data(), {}, N);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the raw values of the array.
+        ///   @include safe_array/example_safe_array_data.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the raw values of the array.
+        ///
+        [[nodiscard]] constexpr auto
+        data() noexcept -> pointer_type
+        {
+            return static_cast<pointer_type>(m_data);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the raw values of the array.
+        ///   @include safe_array/example_safe_array_data.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the raw values of the array.
+        ///
+        [[nodiscard]] constexpr auto
+        data() const noexcept -> const_pointer_type
+        {
+            return static_cast<const_pointer_type>(m_data);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the side bitmap that stores the
+        ///     poisoned state of each element (bit i of the bitmap is the
+        ///     poisoned state of element i).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the side bitmap that stores the
+        ///     poisoned state of each element.
+        ///
+        [[nodiscard]] constexpr auto
+        poisoned_data() noexcept -> bsl::uint64 *
+        {
+            return static_cast<bsl::uint64 *>(m_poisoned);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the side bitmap that stores the
+        ///     poisoned state of each element (bit i of the bitmap is the
+        ///     poisoned state of element i).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the side bitmap that stores the
+        ///     poisoned state of each element.
+        ///
+        [[nodiscard]] constexpr auto
+        poisoned_data() const noexcept -> bsl::uint64 const *
+        {
+            return static_cast<bsl::uint64 const *>(m_poisoned);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns false as a bsl::safe_array cannot be empty.
+        ///   @include safe_array/example_safe_array_empty.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns false as a bsl::safe_array cannot be empty.
+        ///
+        [[nodiscard]] static constexpr auto
+        empty() noexcept -> bool
+        {
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of elements in the array.
+        ///   @include safe_array/example_safe_array_size.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of elements in the array.
+        ///
+        [[nodiscard]] static constexpr auto
+        size() noexcept -> size_type
+        {
+            return size_type{N};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns size() * sizeof(T), which is the number of
+        ///     bytes used by the raw values (the side bitmap is not
+        ///     included).
+        ///   @include safe_array/example_safe_array_size_bytes.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns size() * sizeof(T)
+        ///
+        [[nodiscard]] static constexpr auto
+        size_bytes() noexcept -> size_type
+        {
+            constexpr auto val{(size_type{N} * sizeof(T)).checked()};
+
+            /// NOTE:
+            /// - An error is not possible because N * sizeof(T) is the
+            ///   size of m_data, which the compiler already had to
+            ///   compute, so the result of size_bytes() is marked as
+            ///   checked.
+            ///
+
+            ensures(val.is_valid_and_checked());
+            return val;
+        }
+    };
+}
+
+#endif
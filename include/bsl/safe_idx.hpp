@@ -64,17 +64,32 @@ namespace bsl
     ///   @brief Provides a safe implementation of an integral type that
     ///     adheres to AUTOSAR's requirement that an integral shall not
     ///     overflow, wrap, divide by zero, etc.
+    ///     numeric_limits<bsl::uintmx>::max_value() is reserved as the
+    ///     poison value and can never be a valid index (no object can span
+    ///     the entire address space), which is why max_value() (and
+    ///     bsl::npos) is one less. A safe_idx that holds the poison value
+    ///     is invalid in both debug and release mode, no matter how it got
+    ///     there. In release mode, the poisoned bit is not stored at all,
+    ///     and poisoning a safe_idx sets it to the poison value instead.
+    ///     This allows a safe_idx to be the same size as a bsl::uintmx so
+    ///     that it can be passed in a register.
     ///   @include example_safe_idx_overview.hpp
     ///
     class safe_idx final
     {
+        /// @brief the reserved value that marks a safe_idx as poisoned
+        static constexpr bsl::uintmx POISON{numeric_limits<bsl::uintmx>::max_value()};
+
         /// @brief stores the value of the integral
         bsl::uintmx m_val;
+#if !BSL_RELEASE_MODE
         /// @brief stores whether or not the integral has been poisoned
-        bool m_poisoned;
+        bool m_poisoned{};
+#endif
 
         /// <!-- description -->
-        ///   @brief Sets the poisoned bit if poisoned is true.
+        ///   @brief Sets the poisoned bit if poisoned is true. In release
+        ///     mode, the value is replaced with the poison sentinel.
         ///
         /// <!-- inputs/outputs -->
         ///   @param poisoned Sets the poisoned bit if equal to true
@@ -82,7 +97,16 @@ namespace bsl
         constexpr void
         update_poisoned(bool const poisoned) noexcept
         {
+#if BSL_RELEASE_MODE
+            if (unlikely(poisoned)) {
+                m_val = POISON;
+            }
+            else {
+                bsl::touch();
+            }
+#else
             m_poisoned |= poisoned;
+#endif
         }
 
         /// <!-- description -->
@@ -96,8 +120,31 @@ namespace bsl
         constexpr void
         update_poisoned(bool const poisoned1, bool const poisoned2) noexcept
         {
-            m_poisoned |= poisoned1;
-            m_poisoned |= poisoned2;
+            this->update_poisoned(poisoned1 || poisoned2);
+        }
+
+        /// <!-- description -->
+        ///   @brief Verifies that the safe_idx is not poisoned. If it is,
+        ///     we throw an error during compile-time, and we assert during
+        ///     runtime. In release mode, this function does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sloc the location of the call site
+        ///
+        constexpr void
+        verify_not_poisoned(source_location const &sloc) const noexcept
+        {
+            if constexpr (BSL_RELEASE_MODE) {
+                return;
+            }
+
+            if (unlikely(this->is_invalid())) {
+                a_poisoned_safe_idx_was_read();
+                assert("a poisoned safe_idx was read", sloc);
+            }
+            else {
+                bsl::touch();
+            }
         }
 
     public:
@@ -107,7 +154,7 @@ namespace bsl
         ///   @include safe_idx/example_safe_idx_default_constructor.hpp
         ///
         constexpr safe_idx() noexcept    // --
-            : m_val{}, m_poisoned{}
+            : m_val{}
         {}
 
         /// <!-- description -->
@@ -122,7 +169,7 @@ namespace bsl
         ///
         template<typename U, enable_if_t<is_same<bsl::uintmx, U>::value, bool> = true>
         explicit constexpr safe_idx(U const val) noexcept    // --
-            : m_val{val}, m_poisoned{}
+            : m_val{val}
         {}
 
         /// <!-- description -->
@@ -136,9 +183,12 @@ namespace bsl
         explicit constexpr safe_idx(
             safe_umx const &val,
             source_location const &sloc) noexcept    // --
-            : m_val{val.cdata_as_ref()}, m_poisoned{val.is_invalid()}
+            : m_val{val.cdata_as_ref()}
         {
-            if (unlikely(val.is_invalid())) {
+            bool const poisoned{val.is_invalid() || (POISON == m_val)};
+            this->update_poisoned(poisoned);
+
+            if (unlikely(poisoned)) {
                 a_safe_idx_was_poisoned();
                 assert("a safe_idx was poisoned", sloc);
             }
@@ -211,6 +261,8 @@ namespace bsl
 
         /// <!-- description -->
         ///   @brief Returns the max value the bsl::safe_idx can store.
+        ///     This is one less than numeric_limits<bsl::uintmx>::max_value()
+        ///     as that value is reserved as the poison value.
         ///   @include safe_idx/example_safe_idx_max_value.hpp
         ///
         /// <!-- inputs/outputs -->
@@ -219,7 +271,7 @@ namespace bsl
         [[nodiscard]] static constexpr auto
         max_value() noexcept -> safe_idx
         {
-            return safe_idx{numeric_limits<bsl::uintmx>::max_value()};
+            return safe_idx{POISON - static_cast<bsl::uintmx>(1)};
         }
 
         /// <!-- description -->
@@ -400,14 +452,7 @@ namespace bsl
         [[nodiscard]] constexpr auto
         get(source_location const &sloc = here()) const noexcept -> bsl::uintmx
         {
-            if (unlikely(m_poisoned)) {
-                a_poisoned_safe_idx_was_read();
-                assert("a poisoned safe_idx was read", sloc);
-            }
-            else {
-                bsl::touch();
-            }
-
+            this->verify_not_poisoned(sloc);
             return m_val;
         }
 
@@ -424,14 +469,7 @@ namespace bsl
         [[nodiscard]] constexpr auto
         is_pos(source_location const &sloc = here()) const noexcept -> bool
         {
-            if (unlikely(m_poisoned)) {
-                a_poisoned_safe_idx_was_read();
-                assert("a poisoned safe_idx was read", sloc);
-            }
-            else {
-                bsl::touch();
-            }
-
+            this->verify_not_poisoned(sloc);
             return m_val > 0;
         }
 
@@ -448,14 +486,7 @@ namespace bsl
         [[nodiscard]] constexpr auto
         is_zero(source_location const &sloc = here()) const noexcept -> bool
         {
-            if (unlikely(m_poisoned)) {
-                a_poisoned_safe_idx_was_read();
-                assert("a poisoned safe_idx was read", sloc);
-            }
-            else {
-                bsl::touch();
-            }
-
+            this->verify_not_poisoned(sloc);
             return 0 == m_val;
         }
 
@@ -473,7 +504,11 @@ namespace bsl
         [[nodiscard]] constexpr auto
         is_invalid() const noexcept -> bool
         {
-            return m_poisoned;
+#if BSL_RELEASE_MODE
+            return POISON == m_val;
+#else
+            return m_poisoned || (POISON == m_val);
+#endif
         }
 
         /// <!-- description -->
@@ -548,8 +583,9 @@ namespace bsl
         [[maybe_unused]] constexpr auto
         operator-=(safe_idx const &rhs) &noexcept -> safe_idx &
         {
+            bool const was_poisoned{this->is_invalid()};
             bool const poisoned{builtin_sub_overflow(m_val, rhs.m_val, &m_val)};
-            this->update_poisoned(poisoned, rhs.is_invalid());
+            this->update_poisoned(was_poisoned || poisoned, rhs.is_invalid());
 
             return *this;
         }
@@ -573,7 +609,9 @@ namespace bsl
         [[maybe_unused]] constexpr auto
         operator-=(U const rhs) &noexcept -> safe_idx &
         {
-            this->update_poisoned(builtin_sub_overflow(m_val, rhs, &m_val));
+            bool const was_poisoned{this->is_invalid()};
+            bool const poisoned{builtin_sub_overflow(m_val, rhs, &m_val)};
+            this->update_poisoned(was_poisoned, poisoned);
             return *this;
         }
 
@@ -30,6 +30,7 @@
 
 #include "bsl/always_false.hpp"
 #include "bsl/cstdint.hpp"    // IWYU pragma: export
+#include "bsl/discard.hpp"
 #include "bsl/enable_if.hpp"
 #include "bsl/integer.hpp"
 #include "bsl/is_integral.hpp"
@@ -373,8 +374,27 @@ namespace bsl
         T m_val;
         /// @brief stores whether or not the integral has been poisoned
         bool m_poisoned;
+#if !BSL_RELEASE_MODE
         /// @brief stores whether or not the integral has been checked
-        bool m_unchecked;
+        bool m_unchecked{};
+#endif
+
+        /// <!-- description -->
+        ///   @brief Sets the unchecked bit if unchecked is true. In release
+        ///     mode, the unchecked bit is not stored and this does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param unchecked Sets the unchecked bit if equal to true
+        ///
+        constexpr void
+        update_unchecked(bool const unchecked) noexcept
+        {
+#if BSL_RELEASE_MODE
+            bsl::discard(unchecked);
+#else
+            m_unchecked |= unchecked;
+#endif
+        }
 
         /// <!-- description -->
         ///   @brief Sets the poisoned bit if poisoned is true.
@@ -386,12 +406,7 @@ namespace bsl
         update_poisoned(bool const poisoned) noexcept
         {
             m_poisoned |= poisoned;
-
-            if constexpr (BSL_RELEASE_MODE) {
-                return;
-            }
-
-            m_unchecked = true;
+            this->update_unchecked(true);
         }
 
         /// <!-- description -->
@@ -407,12 +422,7 @@ namespace bsl
         {
             m_poisoned |= poisoned1;
             m_poisoned |= poisoned2;
-
-            if constexpr (BSL_RELEASE_MODE) {
-                return;
-            }
-
-            m_unchecked = true;
+            this->update_unchecked(true);
         }
 
         /// <!-- description -->
@@ -430,7 +440,7 @@ namespace bsl
                 return;
             }
 
-            if (unlikely(m_unchecked)) {
+            if (unlikely(this->is_unchecked())) {
                 safe_integrals_must_be_checked_before_use();
                 assert("safe_integrals must be checked before use", sloc);
             }
@@ -446,11 +456,9 @@ namespace bsl
         constexpr void
         mark_as_checked_if_valid() noexcept
         {
-            if constexpr (BSL_RELEASE_MODE) {
-                return;
-            }
-
+#if !BSL_RELEASE_MODE
             m_unchecked = m_poisoned;
+#endif
         }
 
         /// <!-- description -->
@@ -464,8 +472,10 @@ namespace bsl
         ///
         constexpr safe_integral(
             T const val, bool const poisoned, bool const unchecked) noexcept    // --
-            : m_val{val}, m_poisoned{poisoned}, m_unchecked{unchecked}
-        {}
+            : m_val{val}, m_poisoned{poisoned}
+        {
+            this->update_unchecked(unchecked);
+        }
 
     public:
         /// @brief alias for: T
@@ -485,7 +495,7 @@ namespace bsl
         ///   @include safe_integral/example_safe_integral_default_constructor.hpp
         ///
         constexpr safe_integral() noexcept    // --
-            : m_val{}, m_poisoned{}, m_unchecked{}
+            : m_val{}, m_poisoned{}
         {}
 
         /// <!-- description -->
@@ -500,7 +510,7 @@ namespace bsl
         ///
         template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
         explicit constexpr safe_integral(U const val) noexcept    // --
-            : m_val{val}, m_poisoned{}, m_unchecked{}
+            : m_val{val}, m_poisoned{}
         {}
 
         /// <!-- description -->
@@ -518,8 +528,10 @@ namespace bsl
         template<typename U, typename O, enable_if_t<is_same<T, U>::value, bool> = true>
         explicit constexpr safe_integral(
             U const val, safe_integral<O> const &flags) noexcept    // --
-            : m_val{val}, m_poisoned{flags.is_invalid()}, m_unchecked{flags.is_unchecked()}
-        {}
+            : m_val{val}, m_poisoned{flags.is_invalid()}
+        {
+            this->update_unchecked(flags.is_unchecked());
+        }
 
         /// <!-- description -->
         ///   @brief Creates a bsl::safe_integral given a fixed width type
@@ -534,9 +546,10 @@ namespace bsl
         explicit constexpr safe_integral(
             safe_integral<T> const &val, safe_integral<O> const &flags) noexcept    // --
             : m_val{val.m_val}
-            , m_poisoned{(val.m_poisoned) || (flags.is_invalid())}        // NOLINT
-            , m_unchecked{(val.m_unchecked) || (flags.is_unchecked())}    // NOLINT
-        {}
+            , m_poisoned{(val.m_poisoned) || (flags.is_invalid())}    // NOLINT
+        {
+            this->update_unchecked(val.is_unchecked() || flags.is_unchecked());
+        }
 
         /// <!-- description -->
         ///   @brief Destroyes a previously created bsl::safe_integral
@@ -1065,11 +1078,11 @@ namespace bsl
         [[nodiscard]] constexpr auto
         is_unchecked() const noexcept -> bool
         {
-            if constexpr (BSL_RELEASE_MODE) {
-                return false;
-            }
-
+#if BSL_RELEASE_MODE
+            return false;
+#else
             return m_unchecked;
+#endif
         }
 
         /// <!-- description -->
@@ -1178,6 +1191,141 @@ namespace bsl
             return rhs;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns *this + rhs, saturated to max_value() or
+        ///     min_value() instead of poisoning the result when the
+        ///     operation overflows. The result is only poisoned (and only
+        ///     unchecked) if *this or rhs is, which means there is no
+        ///     poison bookkeeping for the operation itself and the result
+        ///     is selected without a branch.
+        ///   @include safe_integral/example_safe_integral_sat_add.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns *this + rhs, saturated to max_value() or
+        ///     min_value() on overflow.
+        ///
+        [[nodiscard]] constexpr auto
+        sat_add(safe_integral const &rhs) const noexcept -> safe_integral
+        {
+            return safe_integral{
+                builtin_add_sat(m_val, rhs.m_val),
+                m_poisoned || rhs.m_poisoned,
+                this->is_unchecked() || rhs.is_unchecked()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns *this - rhs, saturated to max_value() or
+        ///     min_value() instead of poisoning the result when the
+        ///     operation overflows. The result is only poisoned (and only
+        ///     unchecked) if *this or rhs is, which means there is no
+        ///     poison bookkeeping for the operation itself and the result
+        ///     is selected without a branch.
+        ///   @include safe_integral/example_safe_integral_sat_sub.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns *this - rhs, saturated to max_value() or
+        ///     min_value() on overflow.
+        ///
+        [[nodiscard]] constexpr auto
+        sat_sub(safe_integral const &rhs) const noexcept -> safe_integral
+        {
+            return safe_integral{
+                builtin_sub_sat(m_val, rhs.m_val),
+                m_poisoned || rhs.m_poisoned,
+                this->is_unchecked() || rhs.is_unchecked()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns *this * rhs, saturated to max_value() or
+        ///     min_value() instead of poisoning the result when the
+        ///     operation overflows. The result is only poisoned (and only
+        ///     unchecked) if *this or rhs is, which means there is no
+        ///     poison bookkeeping for the operation itself and the result
+        ///     is selected without a branch.
+        ///   @include safe_integral/example_safe_integral_sat_mul.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns *this * rhs, saturated to max_value() or
+        ///     min_value() on overflow.
+        ///
+        [[nodiscard]] constexpr auto
+        sat_mul(safe_integral const &rhs) const noexcept -> safe_integral
+        {
+            return safe_integral{
+                builtin_mul_sat(m_val, rhs.m_val),
+                m_poisoned || rhs.m_poisoned,
+                this->is_unchecked() || rhs.is_unchecked()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns *this + rhs, wrapping (modulo 2^N) instead of
+        ///     poisoning the result when the operation overflows. The
+        ///     result is only poisoned (and only unchecked) if *this or
+        ///     rhs is, which means there is no poison bookkeeping for the
+        ///     operation itself.
+        ///   @include safe_integral/example_safe_integral_wrap_add.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns *this + rhs, wrapping on overflow.
+        ///
+        [[nodiscard]] constexpr auto
+        wrap_add(safe_integral const &rhs) const noexcept -> safe_integral
+        {
+            T mut_res{};
+            bsl::discard(builtin_add_wrap(m_val, rhs.m_val, &mut_res));
+
+            return safe_integral{
+                mut_res, m_poisoned || rhs.m_poisoned, this->is_unchecked() || rhs.is_unchecked()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns *this - rhs, wrapping (modulo 2^N) instead of
+        ///     poisoning the result when the operation overflows. The
+        ///     result is only poisoned (and only unchecked) if *this or
+        ///     rhs is, which means there is no poison bookkeeping for the
+        ///     operation itself.
+        ///   @include safe_integral/example_safe_integral_wrap_sub.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns *this - rhs, wrapping on overflow.
+        ///
+        [[nodiscard]] constexpr auto
+        wrap_sub(safe_integral const &rhs) const noexcept -> safe_integral
+        {
+            T mut_res{};
+            bsl::discard(builtin_sub_wrap(m_val, rhs.m_val, &mut_res));
+
+            return safe_integral{
+                mut_res, m_poisoned || rhs.m_poisoned, this->is_unchecked() || rhs.is_unchecked()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns *this * rhs, wrapping (modulo 2^N) instead of
+        ///     poisoning the result when the operation overflows. The
+        ///     result is only poisoned (and only unchecked) if *this or
+        ///     rhs is, which means there is no poison bookkeeping for the
+        ///     operation itself.
+        ///   @include safe_integral/example_safe_integral_wrap_mul.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns *this * rhs, wrapping on overflow.
+        ///
+        [[nodiscard]] constexpr auto
+        wrap_mul(safe_integral const &rhs) const noexcept -> safe_integral
+        {
+            T mut_res{};
+            bsl::discard(builtin_mul_wrap(m_val, rhs.m_val, &mut_res));
+
+            return safe_integral{
+                mut_res, m_poisoned || rhs.m_poisoned, this->is_unchecked() || rhs.is_unchecked()};
+        }
+
         /// <!-- description -->
         ///   @brief Returns *this += rhs. If this operation results in
         ///     an error (e.g., overflow, wrapping, etc.), the result of
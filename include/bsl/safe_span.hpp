@@ -0,0 +1,355 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file safe_span.hpp
+///
+
+#ifndef BSL_SAFE_SPAN_HPP
+#define BSL_SAFE_SPAN_HPP
+
+#include "bsl/conditional.hpp"
+#include "bsl/cstdint.hpp"
+#include "bsl/details/poison_bitmap.hpp"
+#include "bsl/expects.hpp"
+#include "bsl/is_const.hpp"
+#include "bsl/remove_const.hpp"
+#include "bsl/safe_array.hpp"
+#include "bsl/safe_idx.hpp"
+#include "bsl/safe_integral.hpp"
+#include "bsl/unlikely.hpp"
+
+namespace bsl
+{
+    /// @class bsl::safe_span
+    ///
+    /// <!-- description -->
+    ///   @brief A bsl::safe_span is a non-owning view of a bsl::safe_array.
+    ///     Like the bsl::safe_array, the raw values are viewed contiguously
+    ///     and the poisoned state of each element is read from (and
+    ///     written to) the safe_array's side bitmap, so a subspan that
+    ///     does not start on a multiple of 64 elements simply remembers
+    ///     which bit its first element maps to. A bsl::safe_span<T const>
+    ///     can be used to view a bsl::safe_array that is const, in which
+    ///     case set() is not available.
+    ///   @include example_safe_span_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the integral type of the elements being viewed.
+    ///
+    template<typename T>
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init, hicpp-member-init)
+    class safe_span final
+    {
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+        /// @brief alias for: safe_umx
+        using size_type = safe_umx;
+        /// @brief alias for: safe_idx
+        using index_type = safe_idx;
+        /// @brief alias for: T *
+        using pointer_type = T *;
+        /// @brief alias for: T const *
+        using const_pointer_type = T const *;
+        /// @brief alias for: the type of the side bitmap's words
+        using bitmap_pointer_type =
+            conditional_t<is_const<T>::value, bsl::uint64 const *, bsl::uint64 *>;
+
+        /// <!-- description -->
+        ///   @brief Default constructor. Creates an empty safe_span.
+        ///
+        constexpr safe_span() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a safe_span given a bsl::safe_array
+        ///   @include safe_span/example_safe_span_array_constructor.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U the array's value type
+        ///   @tparam N the size of the array
+        ///   @param mut_arr the array being viewed.
+        ///
+        template<typename U, bsl::uintmx N>
+        explicit constexpr safe_span(bsl::safe_array<U, N> &mut_arr) noexcept    // --
+            : m_ptr{mut_arr.data()}, m_poisoned{mut_arr.poisoned_data()}, m_offset{}, m_count{N}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a safe_span given a bsl::safe_array
+        ///   @include safe_span/example_safe_span_array_constructor.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U the array's value type
+        ///   @tparam N the size of the array
+        ///   @param arr the array being viewed.
+        ///
+        template<typename U, bsl::uintmx N>
+        explicit constexpr safe_span(bsl::safe_array<U, N> const &arr) noexcept    // --
+            : m_ptr{arr.data()}, m_poisoned{arr.poisoned_data()}, m_offset{}, m_count{N}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns the element at index "index" as a
+        ///     bsl::safe_integral. If the element is poisoned, the result
+        ///     is poisoned and unchecked. If the index is out of bounds,
+        ///     bsl::safe_integral::failure() is returned.
+        ///   @include safe_span/example_safe_span_get.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the element to return
+        ///   @return Returns the element at index "index" as a
+        ///     bsl::safe_integral. If the element is poisoned, the result
+        ///     is poisoned and unchecked. If the index is out of bounds,
+        ///     bsl::safe_integral::failure() is returned.
+        ///
+        [[nodiscard]] constexpr auto
+        get(index_type const &index) const noexcept -> safe_integral<remove_const_t<T>>
+        {
+            expects(index.is_valid());
+
+            if (unlikely(index >= m_count)) {
+                return safe_integral<remove_const_t<T>>::failure();
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            auto const val{m_ptr[index.get()]};
+            if (unlikely(details::poison_bitmap_test(m_poisoned, m_offset + index.get()))) {
+                return safe_integral<remove_const_t<T>>{
+                    val, safe_integral<remove_const_t<T>>::failure()};
+            }
+
+            return safe_integral<remove_const_t<T>>{val};
+        }
+
+        /// <!-- description -->
+        ///   @brief Stores "val" at index "index", recording whether or not
+        ///     "val" is poisoned in the viewed array's side bitmap. If the
+        ///     index is out of bounds, nothing is stored.
+        ///   @include safe_span/example_safe_span_set.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the element to set
+        ///   @param val the value to set the element to
+        ///
+        constexpr void
+        set(index_type const &index, safe_integral<remove_const_t<T>> const &val) noexcept
+        {
+            static_assert(!is_const<T>::value, "cannot set() the elements of a const view");
+            expects(index.is_valid());
+
+            if (unlikely(index >= m_count)) {
+                unlikely_invalid_argument_failure();
+                return;
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            m_ptr[index.get()] = val.cdata_as_ref();
+            details::poison_bitmap_assign(m_poisoned, m_offset + index.get(), val.is_invalid());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the element at index "index" is
+        ///     poisoned, or if the index is out of bounds. Returns false
+        ///     otherwise.
+        ///   @include safe_span/example_safe_span_is_poisoned.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the element to query
+        ///   @return Returns true if the element at index "index" is
+        ///     poisoned, or if the index is out of bounds. Returns false
+        ///     otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        is_poisoned(index_type const &index) const noexcept -> bool
+        {
+            expects(index.is_valid());
+
+            if (unlikely(index >= m_count)) {
+                return true;
+            }
+
+            return details::poison_bitmap_test(m_poisoned, m_offset + index.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if any element in the view is poisoned.
+        ///     This only reads the side bitmap, one word per 64 elements.
+        ///   @include safe_span/example_safe_span_is_any_poisoned.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if any element in the view is poisoned.
+        ///
+        [[nodiscard]] constexpr auto
+        is_any_poisoned() const noexcept -> bool
+        {
+            if (unlikely(static_cast<bsl::uint64>(0) == m_count)) {
+                return false;
+            }
+
+            return details::poison_bitmap_any(m_poisoned, m_offset, m_count);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the raw values being viewed.
+        ///   @include safe_span/example_safe_span_data.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the raw values being viewed.
+        ///
+        [[nodiscard]] constexpr auto
+        data() const noexcept -> pointer_type
+        {
+            return m_ptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns size() == 0
+        ///   @include safe_span/example_safe_span_empty.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns size() == 0
+        ///
+        [[nodiscard]] constexpr auto
+        empty() const noexcept -> bool
+        {
+            return this->size().is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of elements being viewed.
+        ///   @include safe_span/example_safe_span_size.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of elements being viewed.
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> size_type
+        {
+            return size_type{m_count};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns size() * sizeof(T), which is the number of
+        ///     bytes used by the raw values being viewed.
+        ///   @include safe_span/example_safe_span_size_bytes.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns size() * sizeof(T)
+        ///
+        [[nodiscard]] constexpr auto
+        size_bytes() const noexcept -> size_type
+        {
+            /// NOTE:
+            /// - A safe_span can only be created from a safe_array (or
+            ///   another safe_span), whose size in bytes the compiler
+            ///   already had to compute, so this cannot overflow.
+            ///
+
+            return (this->size() * sizeof(T)).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a view of [pos, pos + count.min(size() - pos)).
+        ///     If the provided "pos" is greater than or equal to the size
+        ///     of the current view, an empty safe_span is returned.
+        ///   @include safe_span/example_safe_span_subspan.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pos the starting position of the new view
+        ///   @param count the number of elements of the new view
+        ///   @return Returns a view of [pos, pos + count.min(size() - pos)).
+        ///     If the provided "pos" is greater than or equal to the size
+        ///     of the current view, an empty safe_span is returned.
+        ///
+        [[nodiscard]] constexpr auto
+        subspan(index_type const &pos, size_type const &count = size_type::max_value())
+            const noexcept -> safe_span
+        {
+            expects(pos.is_valid());
+            expects(count.is_valid_and_checked());
+
+            if (unlikely(pos >= m_count)) {
+                return {};
+            }
+
+            /// NOTE:
+            /// - This function's contract allows for pos to be large. As a
+            ///   result we check for overflow above and return early, which
+            ///   means that the math below cannot overflow so we mark it
+            ///   as checked.
+            ///
+
+            auto const adjusted_count{(size_type{m_count} - pos.get()).checked()};
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return safe_span{
+                &m_ptr[pos.get()],
+                m_poisoned,
+                m_offset + pos.get(),
+                count.min(adjusted_count).get()};
+        }
+
+    private:
+        /// <!-- description -->
+        ///   @brief Creates a safe_span given its raw members. Used by
+        ///     subspan().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pudm_ptr a pointer to the first raw value being viewed
+        ///   @param pudm_poisoned a pointer to the viewed side bitmap
+        ///   @param offset the bit in the side bitmap of the first element
+        ///   @param count the number of elements being viewed
+        ///
+        constexpr safe_span(
+            pointer_type const pudm_ptr,
+            bitmap_pointer_type const pudm_poisoned,
+            bsl::uint64 const offset,
+            bsl::uint64 const count) noexcept    // --
+            : m_ptr{pudm_ptr}, m_poisoned{pudm_poisoned}, m_offset{offset}, m_count{count}
+        {}
+
+        /// @brief stores a pointer to the raw values being viewed
+        pointer_type m_ptr;
+        /// @brief stores a pointer to the side bitmap being viewed
+        bitmap_pointer_type m_poisoned;
+        /// @brief stores the bit in the side bitmap of the first element
+        bsl::uint64 m_offset;
+        /// @brief stores the number of elements being viewed
+        bsl::uint64 m_count;
+    };
+
+    /// <!-- description -->
+    ///   @brief Creates user-defined deduction guide for safe_array<U, N> &
+    ///
+    template<typename U, bsl::uintmx N>
+    safe_span(bsl::safe_array<U, N> &) -> safe_span<U>;
+
+    /// <!-- description -->
+    ///   @brief Creates user-defined deduction guide for safe_array<U, N> const &
+    ///
+    template<typename U, bsl::uintmx N>
+    safe_span(bsl::safe_array<U, N> const &) -> safe_span<U const>;
+}
+
+#endif
@@ -22,14 +22,19 @@
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 /// SOFTWARE.
 ///
-/// @file addressof.hpp
+/// @file sort.hpp
 ///
 
 #ifndef BSL_SORT_HPP
 #define BSL_SORT_HPP
 
+#include "bsl/convert.hpp"
+#include "bsl/details/sort_impl.hpp"
+#include "bsl/expects.hpp"
 #include "bsl/safe_idx.hpp"
+#include "bsl/safe_integral.hpp"
 #include "bsl/swap.hpp"
+#include "bsl/touch.hpp"
 
 namespace bsl
 {
@@ -56,15 +61,20 @@ namespace bsl
     ///   @brief Sorts the elements in a container in non-descending
     ///     order. This is similar to std::sort, with the following
     ///     exceptions:
-    ///     - The time-complexity is O(x^2) for the worst case and O(n) for
-    ///       the best case as the insertion sort algorithm is used
-    ///       specifically to keep the space-complexity to O(1). Faster
-    ///       algorithms have space-complexity algorithms that might consume
-    ///       too much stack space for applications with limited resources
-    ///       like a hypervisor, or embedded system.
+    ///     - The sort is implemented using pattern-defeating quicksort.
+    ///       Small ranges are sorted using insertion sort, and heapsort
+    ///       is used as a fallback when too many bad pivots are chosen,
+    ///       which means the time-complexity is O(n log n) for the worst
+    ///       case and O(n) for the best case (already sorted, reverse
+    ///       sorted or all equal elements). Only the smaller side of each
+    ///       partition is sorted recursively, so the stack usage is
+    ///       bounded by O(log n), which keeps this safe to use in
+    ///       applications with limited stack space like a hypervisor, or
+    ///       embedded system.
     ///     - The sort algorithm also doesn't take an iterator, but instead
     ///       take the container itself. So long as the container implements
-    ///       at_if() and size(), this function will work.
+    ///       data() and size(), and its elements are stored contiguously,
+    ///       this function will work.
     ///   @include example_sort_overview.hpp
     ///
     /// <!-- inputs/outputs -->
@@ -77,33 +87,38 @@ namespace bsl
     constexpr void
     sort(T &udm_container, COMPARE &&pudm_udm_cmp) noexcept
     {
-        for (safe_idx mut_i{safe_idx::magic_1()}; mut_i < udm_container.size(); ++mut_i) {
-            for (safe_idx mut_j{mut_i}; mut_j > safe_idx::magic_0(); --mut_j) {
-                auto &mut_elem1{*udm_container.at_if(mut_j)};
-                auto &mut_elem2{*udm_container.at_if(mut_j - safe_idx::magic_1())};
-
-                if (!pudm_udm_cmp(mut_elem1, mut_elem2)) {
-                    break;
-                }
-
-                swap(mut_elem1, mut_elem2);
-            }
+        auto const size{udm_container.size()};
+        if (size <= safe_umx::magic_1()) {
+            return;
         }
+
+        details::sort_pdq(
+            udm_container.data(),
+            safe_idx::magic_0(),
+            to_idx(size),
+            pudm_udm_cmp,
+            details::sort_log2(size),
+            true);
     }
 
     /// <!-- description -->
     ///   @brief Sorts the elements in a container in non-descending
     ///     order. This is similar to std::sort, with the following
     ///     exceptions:
-    ///     - The time-complexity is O(x^2) for the worst case and O(n) for
-    ///       the best case as the insertion sort algorithm is used
-    ///       specifically to keep the space-complexity to O(1). Faster
-    ///       algorithms have space-complexity algorithms that might consume
-    ///       too much stack space for applications with limited resources
-    ///       like a hypervisor, or embedded system.
+    ///     - The sort is implemented using pattern-defeating quicksort.
+    ///       Small ranges are sorted using insertion sort, and heapsort
+    ///       is used as a fallback when too many bad pivots are chosen,
+    ///       which means the time-complexity is O(n log n) for the worst
+    ///       case and O(n) for the best case (already sorted, reverse
+    ///       sorted or all equal elements). Only the smaller side of each
+    ///       partition is sorted recursively, so the stack usage is
+    ///       bounded by O(log n), which keeps this safe to use in
+    ///       applications with limited stack space like a hypervisor, or
+    ///       embedded system.
     ///     - The sort algorithm also doesn't take an iterator, but instead
     ///       take the container itself. So long as the container implements
-    ///       at_if() and size(), this function will work.
+    ///       data() and size(), and its elements are stored contiguously,
+    ///       this function will work.
     ///   @include example_sort_overview.hpp
     ///
     /// <!-- inputs/outputs -->
@@ -116,6 +131,144 @@ namespace bsl
     {
         return sort(udm_container, &details::sort_cmp<typename T::value_type>);
     }
+
+    /// <!-- description -->
+    ///   @brief Sorts the elements in a container in non-descending
+    ///     order, preserving the order of equal elements. This is similar
+    ///     to std::stable_sort, with the following exceptions:
+    ///     - No memory is allocated. Runs of elements are sorted using
+    ///       insertion sort, and are then merged in place using the
+    ///       SymMerge algorithm. The time-complexity is O(n log^2 n) for
+    ///       the worst case and O(n) for the best case, and the stack
+    ///       usage is bounded by O(log n).
+    ///     - Like bsl::sort, the container is passed instead of an
+    ///       iterator, and must implement data() and size().
+    ///   @include example_sort_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of container to sort
+    ///   @tparam COMPARE the type of comparison function to use
+    ///   @param udm_container the container to sort
+    ///   @param pudm_udm_cmp the comparison function to use
+    ///
+    template<typename T, typename COMPARE>
+    constexpr void
+    stable_sort(T &udm_container, COMPARE &&pudm_udm_cmp) noexcept
+    {
+        auto const size{udm_container.size()};
+        if (size <= safe_umx::magic_1()) {
+            return;
+        }
+
+        details::sort_stable(udm_container.data(), to_idx(size), pudm_udm_cmp);
+    }
+
+    /// <!-- description -->
+    ///   @brief Sorts the elements in a container in non-descending
+    ///     order, preserving the order of equal elements. This is similar
+    ///     to std::stable_sort, with the following exceptions:
+    ///     - No memory is allocated. Runs of elements are sorted using
+    ///       insertion sort, and are then merged in place using the
+    ///       SymMerge algorithm. The time-complexity is O(n log^2 n) for
+    ///       the worst case and O(n) for the best case, and the stack
+    ///       usage is bounded by O(log n).
+    ///     - Like bsl::sort, the container is passed instead of an
+    ///       iterator, and must implement data() and size().
+    ///   @include example_sort_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of container to sort
+    ///   @param udm_container the container to sort
+    ///
+    template<typename T>
+    constexpr void
+    stable_sort(T &udm_container) noexcept
+    {
+        return stable_sort(udm_container, &details::sort_cmp<typename T::value_type>);
+    }
+
+    /// <!-- description -->
+    ///   @brief Rearranges the elements in a container so that the first
+    ///     "count" elements are the smallest elements in the container,
+    ///     sorted in non-descending order. The order of the remaining
+    ///     elements is unspecified. This is similar to std::partial_sort,
+    ///     with the following exceptions:
+    ///     - Instead of a middle iterator, the number of elements to sort
+    ///       is provided. If count is larger than the size of the
+    ///       container, the entire container is sorted.
+    ///     - Like bsl::sort, the container is passed instead of an
+    ///       iterator, and must implement data() and size().
+    ///     The time-complexity is O(n log count) and no memory is
+    ///     allocated.
+    ///   @include example_sort_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of container to sort
+    ///   @tparam COMPARE the type of comparison function to use
+    ///   @param udm_container the container to sort
+    ///   @param count the number of elements to sort
+    ///   @param pudm_udm_cmp the comparison function to use
+    ///
+    template<typename T, typename COMPARE>
+    constexpr void
+    partial_sort(T &udm_container, safe_umx const &count, COMPARE &&pudm_udm_cmp) noexcept
+    {
+        expects(count.is_valid_and_checked());
+
+        auto const size{udm_container.size()};
+        if (count >= size) {
+            return sort(udm_container, pudm_udm_cmp);
+        }
+
+        if (count.is_zero()) {
+            return;
+        }
+
+        auto *const pmut_data{udm_container.data()};
+        auto const len{to_idx(count)};
+
+        details::sort_make_heap(pmut_data, safe_idx::magic_0(), len, pudm_udm_cmp);
+        for (safe_idx mut_i{len}; mut_i < size; ++mut_i) {
+            auto &mut_elem{details::sort_elem(pmut_data, mut_i)};
+            if (pudm_udm_cmp(mut_elem, *pmut_data)) {
+                bsl::swap(mut_elem, *pmut_data);
+                details::sort_sift_down(
+                    pmut_data, safe_idx::magic_0(), safe_idx::magic_0(), len, pudm_udm_cmp);
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        details::sort_heap(pmut_data, safe_idx::magic_0(), len, pudm_udm_cmp);
+    }
+
+    /// <!-- description -->
+    ///   @brief Rearranges the elements in a container so that the first
+    ///     "count" elements are the smallest elements in the container,
+    ///     sorted in non-descending order. The order of the remaining
+    ///     elements is unspecified. This is similar to std::partial_sort,
+    ///     with the following exceptions:
+    ///     - Instead of a middle iterator, the number of elements to sort
+    ///       is provided. If count is larger than the size of the
+    ///       container, the entire container is sorted.
+    ///     - Like bsl::sort, the container is passed instead of an
+    ///       iterator, and must implement data() and size().
+    ///     The time-complexity is O(n log count) and no memory is
+    ///     allocated.
+    ///   @include example_sort_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of container to sort
+    ///   @param udm_container the container to sort
+    ///   @param count the number of elements to sort
+    ///
+    template<typename T>
+    constexpr void
+    partial_sort(T &udm_container, safe_umx const &count) noexcept
+    {
+        return partial_sort(udm_container, count, &details::sort_cmp<typename T::value_type>);
+    }
 }
 
 #endif
@@ -31,6 +31,7 @@
 #include "bsl/array.hpp"
 #include "bsl/carray.hpp"
 #include "bsl/char_type.hpp"
+#include "bsl/checked_range.hpp"    // IWYU pragma: export
 #include "bsl/contiguous_iterator.hpp"    // IWYU pragma: export
 #include "bsl/details/out.hpp"
 #include "bsl/ensures.hpp"
@@ -809,6 +810,48 @@ namespace bsl
             return span{&m_ptr[pos.get()], count.min(adjusted_count)};
         }
 
+        /// <!-- description -->
+        ///   @brief Returns a bsl::checked_range of subspan(pos, count).
+        ///     The bounds are checked once, here, and indexing into the
+        ///     resulting range is not checked in release mode. Use this
+        ///     for hot loops that iterate up to the size of the range.
+        ///   @include span/example_span_unchecked_view.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pos the starting position of the range
+        ///   @param count the number of elements in the range
+        ///   @return Returns a bsl::checked_range of subspan(pos, count).
+        ///     If subspan(pos, count) is invalid, the range is empty.
+        ///
+        [[nodiscard]] constexpr auto
+        unchecked_view(index_type const &pos = {}, size_type const &count = size_type::max_value())
+            noexcept -> checked_range<T>
+        {
+            auto const spn{this->subspan(pos, count)};
+            return checked_range<T>{spn.m_ptr, spn.size()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a bsl::checked_range of subspan(pos, count).
+        ///     The bounds are checked once, here, and indexing into the
+        ///     resulting range is not checked in release mode. Use this
+        ///     for hot loops that iterate up to the size of the range.
+        ///   @include span/example_span_unchecked_view.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pos the starting position of the range
+        ///   @param count the number of elements in the range
+        ///   @return Returns a bsl::checked_range of subspan(pos, count).
+        ///     If subspan(pos, count) is invalid, the range is empty.
+        ///
+        [[nodiscard]] constexpr auto
+        unchecked_view(index_type const &pos = {}, size_type const &count = size_type::max_value())
+            const noexcept -> checked_range<T const>
+        {
+            auto const spn{this->subspan(pos, count)};
+            return checked_range<T const>{spn.m_ptr, spn.size()};
+        }
+
     private:
         /// @brief stores a pointer to the array being viewed
         pointer_type m_ptr;
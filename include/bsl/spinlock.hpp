@@ -0,0 +1,151 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file spinlock.hpp
+///
+
+#ifndef BSL_SPINLOCK_HPP
+#define BSL_SPINLOCK_HPP
+
+#include "bsl/atomic.hpp"
+#include "bsl/cstdint.hpp"
+#include "bsl/details/cpu_relax.hpp"
+#include "bsl/lock_stats.hpp"
+#include "bsl/memory_order.hpp"
+#include "bsl/safe_integral.hpp"
+#include "bsl/unlikely.hpp"
+
+namespace bsl
+{
+    /// @class bsl::spinlock
+    ///
+    /// <!-- description -->
+    ///   @brief A test-and-test-and-set spinlock. A thread that finds the
+    ///     lock held spins on a plain load, which keeps the cache line
+    ///     shared, and only retries the exchange once the lock looks
+    ///     free. This is the fastest lock when there is little
+    ///     contention, but it is not fair. If many cores fight over the
+    ///     same lock, use a bsl::ticket_lock (fair) or a bsl::mcs_lock
+    ///     (fair, and each waiter spins on its own cache line) instead.
+    ///     The lock never blocks in the OS. Use a bsl::lock_guard to
+    ///     release the lock when leaving a scope.
+    ///   @include example_spinlock_overview.hpp
+    ///
+    class spinlock final
+    {
+        /// @brief stores 1 if the lock is held, 0 otherwise
+        atomic<bsl::uint32> m_locked{};
+        /// @brief stores the lock's statistics (see BSL_LOCK_STATS)
+        lock_stats m_stats{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Acquires the lock, spinning until it is available.
+        ///
+        void
+        lock() noexcept
+        {
+            constexpr auto acquire{memory_order::memory_order_acquire};
+            constexpr auto relaxed{memory_order::memory_order_relaxed};
+
+            bool mut_contended{};
+            bsl::uint64 mut_spins{};
+            while (unlikely(!m_locked.exchange(safe_u32::magic_1(), acquire).is_zero())) {
+                mut_contended = true;
+                while (!m_locked.load(relaxed).is_zero()) {
+                    ++mut_spins;
+                    details::cpu_relax();
+                }
+            }
+
+            m_stats.record_acquire(mut_contended, mut_spins);
+        }
+
+        /// <!-- description -->
+        ///   @brief Acquires the lock if it is available, without
+        ///     spinning.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the lock was acquired, false if it
+        ///     is held by someone else.
+        ///
+        [[nodiscard]] auto
+        try_lock() noexcept -> bool
+        {
+            constexpr auto acquire{memory_order::memory_order_acquire};
+            constexpr auto relaxed{memory_order::memory_order_relaxed};
+
+            if (!m_locked.load(relaxed).is_zero()) {
+                return false;
+            }
+
+            if (!m_locked.exchange(safe_u32::magic_1(), acquire).is_zero()) {
+                return false;
+            }
+
+            m_stats.record_acquire(false, {});
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases the lock. Must only be called by the thread
+        ///     that holds the lock.
+        ///
+        void
+        unlock() noexcept
+        {
+            m_stats.record_release();
+            m_locked.store(safe_u32::magic_0(), memory_order::memory_order_release);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the lock is held. If other threads
+        ///     are running, the answer might already be out of date when
+        ///     it is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the lock is held.
+        ///
+        [[nodiscard]] auto
+        is_locked() const noexcept -> bool
+        {
+            return !m_locked.load(memory_order::memory_order_relaxed).is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the lock's statistics. These are only
+        ///     recorded if BSL_LOCK_STATS is defined.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the lock's statistics
+        ///
+        [[nodiscard]] constexpr auto
+        stats() const noexcept -> lock_stats const &
+        {
+            return m_stats;
+        }
+    };
+}
+
+#endif
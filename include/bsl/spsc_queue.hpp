@@ -0,0 +1,237 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file spsc_queue.hpp
+///
+
+#ifndef BSL_SPSC_QUEUE_HPP
+#define BSL_SPSC_QUEUE_HPP
+
+#include "bsl/array.hpp"
+#include "bsl/cstdint.hpp"
+#include "bsl/details/cache_line_size.hpp"
+#include "bsl/errc_type.hpp"
+#include "bsl/move.hpp"
+#include "bsl/safe_idx.hpp"
+#include "bsl/safe_integral.hpp"
+#include "bsl/unlikely.hpp"
+
+namespace bsl
+{
+    /// @class bsl::spsc_queue
+    ///
+    /// <!-- description -->
+    ///   @brief A bounded, lock-free queue for passing elements from
+    ///     exactly one producer thread to exactly one consumer thread.
+    ///     The producer and the consumer each own one index, which are
+    ///     kept in separate cache lines and published using
+    ///     acquire/release atomics. Each side also keeps a private copy
+    ///     of the other side's index, and only reloads it when the queue
+    ///     looks full (or empty), so in the common case neither side
+    ///     reads a cache line the other side is writing. The queue never
+    ///     blocks. If it is full (or empty), bsl::errc_failure is
+    ///     returned instead. If more than one thread pushes (or pops),
+    ///     use a bsl::mpmc_queue instead.
+    ///   @include example_spsc_queue_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of element being queued.
+    ///   @tparam N the max number of elements in the queue. Must be a
+    ///     power of 2.
+    ///
+    template<typename T, bsl::uintmx N>
+    class spsc_queue final
+    {
+        static_assert(static_cast<bsl::uintmx>(0) != N, "queues of size 0 are not supported");
+        static_assert(
+            static_cast<bsl::uintmx>(0) == (N & (N - static_cast<bsl::uintmx>(1))),
+            "the size of a queue must be a power of 2");
+
+        /// @brief the mask used to turn a position into an index
+        static constexpr bsl::uintmx MASK{N - static_cast<bsl::uintmx>(1)};
+
+        /// @brief stores the total number of elements ever pushed (producer owned)
+        alignas(details::CACHE_LINE_SIZE) bsl::uintmx m_head{};
+        /// @brief stores the last value of m_tail seen by the producer
+        bsl::uintmx m_tail_cache{};
+
+        /// @brief stores the total number of elements ever popped (consumer owned)
+        alignas(details::CACHE_LINE_SIZE) bsl::uintmx m_tail{};
+        /// @brief stores the last value of m_head seen by the consumer
+        bsl::uintmx m_head_cache{};
+
+        /// @brief stores the elements in the queue
+        alignas(details::CACHE_LINE_SIZE) array<T, N> m_slots{};
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the slot the next element should
+        ///     be pushed to, or a nullptr if the queue is full. Must only
+        ///     be called by the producer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param head the current value of m_head
+        ///   @return Returns a pointer to the slot the next element should
+        ///     be pushed to, or a nullptr if the queue is full.
+        ///
+        [[nodiscard]] auto
+        push_slot(bsl::uintmx const head) noexcept -> T *
+        {
+            if (N == (head - m_tail_cache)) {
+                m_tail_cache = __atomic_load_n(&m_tail, __ATOMIC_ACQUIRE);
+                if (N == (head - m_tail_cache)) {
+                    return nullptr;
+                }
+            }
+
+            return m_slots.at_if(safe_idx{head & MASK});
+        }
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+        /// @brief alias for: safe_umx
+        using size_type = safe_umx;
+
+        /// <!-- description -->
+        ///   @brief Copies val to the back of the queue. Must only be
+        ///     called by the producer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the element to push
+        ///   @return Returns bsl::errc_success on success, or
+        ///     bsl::errc_failure if the queue is full.
+        ///
+        [[nodiscard]] auto
+        try_push(T const &val) noexcept -> errc_type
+        {
+            auto const head{__atomic_load_n(&m_head, __ATOMIC_RELAXED)};
+            auto *const pmut_slot{this->push_slot(head)};
+            if (unlikely(nullptr == pmut_slot)) {
+                return errc_failure;
+            }
+
+            *pmut_slot = val;
+            __atomic_store_n(&m_head, head + static_cast<bsl::uintmx>(1), __ATOMIC_RELEASE);
+            return errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves mut_val to the back of the queue. If the queue
+        ///     is full, mut_val is not moved from. Must only be called by
+        ///     the producer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_val the element to push
+        ///   @return Returns bsl::errc_success on success, or
+        ///     bsl::errc_failure if the queue is full.
+        ///
+        [[nodiscard]] auto
+        try_push(T &&mut_val) noexcept -> errc_type
+        {
+            auto const head{__atomic_load_n(&m_head, __ATOMIC_RELAXED)};
+            auto *const pmut_slot{this->push_slot(head)};
+            if (unlikely(nullptr == pmut_slot)) {
+                return errc_failure;
+            }
+
+            *pmut_slot = bsl::move(mut_val);
+            __atomic_store_n(&m_head, head + static_cast<bsl::uintmx>(1), __ATOMIC_RELEASE);
+            return errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves the element at the front of the queue into
+        ///     mut_val and removes it from the queue. If the queue is
+        ///     empty, mut_val is not changed. Must only be called by the
+        ///     consumer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_val where to move the popped element to
+        ///   @return Returns bsl::errc_success on success, or
+        ///     bsl::errc_failure if the queue is empty.
+        ///
+        [[nodiscard]] auto
+        try_pop(T &mut_val) noexcept -> errc_type
+        {
+            auto const tail{__atomic_load_n(&m_tail, __ATOMIC_RELAXED)};
+            if (m_head_cache == tail) {
+                m_head_cache = __atomic_load_n(&m_head, __ATOMIC_ACQUIRE);
+                if (m_head_cache == tail) {
+                    return errc_failure;
+                }
+            }
+
+            mut_val = bsl::move(*m_slots.at_if(safe_idx{tail & MASK}));
+            __atomic_store_n(&m_tail, tail + static_cast<bsl::uintmx>(1), __ATOMIC_RELEASE);
+            return errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the queue has no elements. If the
+        ///     other side is running, the answer might already be out of
+        ///     date when it is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the queue has no elements.
+        ///
+        [[nodiscard]] auto
+        empty() const noexcept -> bool
+        {
+            return this->size().is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of elements in the queue. If the
+        ///     other side is running, the answer might already be out of
+        ///     date when it is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of elements in the queue.
+        ///
+        [[nodiscard]] auto
+        size() const noexcept -> size_type
+        {
+            auto const tail{__atomic_load_n(&m_tail, __ATOMIC_ACQUIRE)};
+            auto const head{__atomic_load_n(&m_head, __ATOMIC_ACQUIRE)};
+
+            return size_type{head - tail};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max number of elements the queue can
+        ///     store (i.e., N)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max number of elements the queue can
+        ///     store (i.e., N)
+        ///
+        [[nodiscard]] static constexpr auto
+        max_size() noexcept -> size_type
+        {
+            return size_type{N};
+        }
+    };
+}
+
+#endif
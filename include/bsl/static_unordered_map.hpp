@@ -0,0 +1,455 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BSL_STATIC_UNORDERED_MAP_HPP
+#define BSL_STATIC_UNORDERED_MAP_HPP
+
+#include "bsl/array.hpp"
+#include "bsl/assert.hpp"
+#include "bsl/cstdint.hpp"
+#include "bsl/ensures.hpp"
+#include "bsl/errc_type.hpp"
+#include "bsl/expects.hpp"
+#include "bsl/hash.hpp"
+#include "bsl/is_copy_constructible.hpp"
+#include "bsl/is_default_constructible.hpp"
+#include "bsl/move.hpp"
+#include "bsl/safe_idx.hpp"
+#include "bsl/safe_integral.hpp"
+#include "bsl/source_location.hpp"
+#include "bsl/touch.hpp"
+#include "bsl/unlikely.hpp"
+#include "bsl/unordered_map.hpp"
+
+namespace bsl
+{
+    /// @class bsl::static_unordered_map
+    ///
+    /// <!-- description -->
+    ///   @brief Implements the same subset of the std::unordered_map APIs
+    ///     as bsl::unordered_map, but with a fixed capacity and without
+    ///     ever allocating memory. The table is stored inline (just like
+    ///     a bsl::array), which makes this map safe to use in contexts
+    ///     where the heap is not available (e.g., a VM exit handler).
+    ///     Some key differences with bsl::unordered_map:
+    ///     - The map can hold at most N elements. The table itself has
+    ///       more than N slots so that the load factor never exceeds 3/4
+    ///       and a lookup always terminates on an empty slot.
+    ///     - Adding an element fails if the map is full. at_if() returns
+    ///       a nullptr and insert() returns bsl::errc_failure when that
+    ///       happens. The non-const at() (which adds the key just like
+    ///       bsl::unordered_map::at()) treats it as a contract
+    ///       violation, calling bsl::assert() and returning a reference
+    ///       to a default value, just like bsl::unordered_map::at() does
+    ///       when its allocator fails.
+    ///     - Like bsl::unordered_map, the const version of at() returns
+    ///       a reference to a default value if the key does not exist,
+    ///       and erase() uses backward shift deletion so that lookups
+    ///       never degrade after a long series of inserts and erases.
+    ///     - Adding or removing an element might move other elements, so
+    ///       a pointer (or reference) returned by at_if() (or at()) is
+    ///       only valid until the next call to at_if(), at(), insert(),
+    ///       erase() or clear().
+    ///   @include example_static_unordered_map_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam KEY_TYPE the type of key to use
+    ///   @tparam T the type of value to use
+    ///   @tparam N the max number of elements the map can hold. Cannot be 0
+    ///   @tparam HASH the type of hash function to use
+    ///
+    template<typename KEY_TYPE, typename T, bsl::uintmx N, typename HASH = hash<KEY_TYPE>>
+    class static_unordered_map final
+    {
+        static_assert(static_cast<bsl::uintmx>(0) != N, "maps of size 0 are not supported");
+        static_assert(is_copy_constructible<KEY_TYPE>::value);
+        static_assert(is_default_constructible<KEY_TYPE>::value);
+        static_assert(is_default_constructible<T>::value);
+
+        /// @brief stores the total number of slots in the table
+        static constexpr safe_umx SLOTS{details::unordered_map_capacity_for(safe_umx{N})};
+
+        /// @brief stores a default T when we have nothing else to return
+        T m_default{};
+        /// @brief stores the value at() hands out when the map is full
+        T m_dummy{};
+        /// @brief stores the keys of each slot in the table
+        array<KEY_TYPE, SLOTS.get()> m_keys{};
+        /// @brief stores the values of each slot in the table
+        array<T, SLOTS.get()> m_vals{};
+        /// @brief stores whether or not each slot in the table is in use
+        array<bool, SLOTS.get()> m_used{};
+        /// @brief stores the size of the map
+        safe_umx m_size{};
+
+        /// <!-- description -->
+        ///   @brief Returns the provided slot number as an index into
+        ///     the arrays that make up the table.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the slot number to convert. Must be less than
+        ///     SLOTS.
+        ///   @return Returns the provided slot number as a safe_idx
+        ///
+        [[nodiscard]] static constexpr auto
+        slot_of(safe_umx const &idx) noexcept -> safe_idx
+        {
+            return safe_idx{idx.get()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the slot that the provided key
+        ///     hashes to.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key to get the home slot for
+        ///   @return Returns the index of the slot that the provided key
+        ///     hashes to.
+        ///
+        [[nodiscard]] static constexpr auto
+        home_of(KEY_TYPE const &key) noexcept -> safe_umx
+        {
+            constexpr auto mask{(SLOTS - safe_umx::magic_1()).checked()};
+            return (HASH{}(key) & mask).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the slot that follows the
+        ///     provided slot, wrapping around to the start of the table.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the slot to get the next slot of
+        ///   @return Returns the index of the slot that follows idx
+        ///
+        [[nodiscard]] static constexpr auto
+        next_of(safe_umx const &idx) noexcept -> safe_umx
+        {
+            /// NOTE:
+            /// - idx is always less than SLOTS, so the math below cannot
+            ///   overflow.
+            ///
+
+            constexpr auto mask{(SLOTS - safe_umx::magic_1()).checked()};
+            return ((idx + safe_umx::magic_1()) & mask).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the slot that contains the
+        ///     provided key. If the key is not in the table, the index of
+        ///     the empty slot that ended the search is returned, which is
+        ///     also the slot the key should be inserted into.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key to search for
+        ///   @return Returns the index of the slot that contains the
+        ///     provided key, or the index of the empty slot that ended
+        ///     the search.
+        ///
+        [[nodiscard]] constexpr auto
+        find_slot(KEY_TYPE const &key) const noexcept -> safe_umx
+        {
+            auto mut_idx{home_of(key)};
+
+            while (*m_used.at_if(slot_of(mut_idx))) {
+                if (key == *m_keys.at_if(slot_of(mut_idx))) {
+                    break;
+                }
+
+                mut_idx = next_of(mut_idx);
+            }
+
+            return mut_idx;
+        }
+
+    public:
+        /// @brief alias for: KEY_TYPE
+        using key_type = KEY_TYPE;
+        /// @brief alias for: T
+        using mapped_type = T;
+        /// @brief alias for: safe_umx
+        using size_type = safe_umx;
+
+        /// <!-- description -->
+        ///   @brief Returns size() == 0
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns size() == 0
+        ///
+        [[nodiscard]] constexpr auto
+        empty() const noexcept -> bool
+        {
+            return m_size.is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns size() == max_size()
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns size() == max_size()
+        ///
+        [[nodiscard]] constexpr auto
+        full() const noexcept -> bool
+        {
+            return m_size == max_size();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the size of the map
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the size of the map
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> safe_umx const &
+        {
+            ensures(m_size.is_valid_and_checked());
+            return m_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max number of elements the map can hold,
+        ///     which is always N.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max number of elements the map can hold
+        ///
+        [[nodiscard]] static constexpr auto
+        max_size() noexcept -> safe_umx
+        {
+            return safe_umx{N};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of slots in the map's table.
+        ///     This is always a power of 2 that is larger than N.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of slots in the map's table.
+        ///
+        [[nodiscard]] static constexpr auto
+        bucket_count() noexcept -> safe_umx
+        {
+            return SLOTS;
+        }
+
+        /// <!-- description -->
+        ///   @brief Clear all entires in the map
+        ///
+        constexpr void
+        clear() noexcept
+        {
+            for (safe_idx mut_i{}; mut_i < SLOTS; ++mut_i) {
+                if (*m_used.at_if(mut_i)) {
+                    *m_keys.at_if(mut_i) = {};
+                    *m_vals.at_if(mut_i) = {};
+                    *m_used.at_if(mut_i) = false;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            m_size = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Set/get an entry in the map. If the key does not
+        ///     exist, it is added to the map with a default value. If the
+        ///     key does not exist and the map is full, a nullptr is
+        ///     returned instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key associated with the value to get/set in the
+        ///     map
+        ///   @return Returns a pointer to the requested value in the map,
+        ///     or a nullptr if the key is not in the map and the map is
+        ///     full.
+        ///
+        [[nodiscard]] constexpr auto
+        at_if(KEY_TYPE const &key) noexcept -> T *
+        {
+            auto const slot{slot_of(this->find_slot(key))};
+            if (*m_used.at_if(slot)) {
+                return m_vals.at_if(slot);
+            }
+
+            if (unlikely(this->full())) {
+                return nullptr;
+            }
+
+            /// NOTE:
+            /// - The m_size math below is really acting as an index
+            ///   so it is marked as checked. It cannot exceed N.
+            ///
+
+            *m_keys.at_if(slot) = key;
+            *m_used.at_if(slot) = true;
+            m_size = (m_size + safe_umx::magic_1()).checked();
+
+            return m_vals.at_if(slot);
+        }
+
+        /// <!-- description -->
+        ///   @brief Set/get an entry in the map. If the key does not
+        ///     exist, it is added to the map with a default value. If the
+        ///     key does not exist and the map is full, bsl::assert() is
+        ///     called and a reference to a (freshly reset) dummy value
+        ///     is returned, so anything written to it is lost. If the map
+        ///     might be full, use at_if() or insert() instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key associated with the value to get/set in the
+        ///     map
+        ///   @return Returns a reference to the requested value in the map
+        ///
+        [[nodiscard]] constexpr auto
+        at(KEY_TYPE const &key) noexcept -> T &
+        {
+            auto *const pmut_val{this->at_if(key)};
+            if (unlikely(nullptr == pmut_val)) {
+                bsl::assert("static_unordered_map is full", bsl::here());
+                m_dummy = {};
+                return m_dummy;
+            }
+
+            return *pmut_val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Get an entry in the map. If the key does not exist,
+        ///     a reference to a default value is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key associated with the value to get
+        ///   @return Returns a reference to the requested value in the map
+        ///
+        [[nodiscard]] constexpr auto
+        at(KEY_TYPE const &key) const noexcept -> T const &
+        {
+            auto const slot{slot_of(this->find_slot(key))};
+            if (!*m_used.at_if(slot)) {
+                return m_default;
+            }
+
+            return *m_vals.at_if(slot);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of the provided key, adding the key to
+        ///     the map if it does not already exist.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key associated with the value to set
+        ///   @param val the value to set
+        ///   @return Returns bsl::errc_success on success, and
+        ///     bsl::errc_failure if the key does not exist and the map
+        ///     is full.
+        ///
+        [[nodiscard]] constexpr auto
+        insert(KEY_TYPE const &key, T const &val) noexcept -> bsl::errc_type
+        {
+            auto *const pmut_val{this->at_if(key)};
+            if (unlikely(nullptr == pmut_val)) {
+                return bsl::errc_failure;
+            }
+
+            *pmut_val = val;
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes the requested element from the map.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the element to remove from the map
+        ///   @return Returns true if the element was removed, false if the
+        ///     element was not (meaning it did not exist in the first place).
+        ///
+        [[nodiscard]] constexpr auto
+        erase(KEY_TYPE const &key) noexcept -> bool
+        {
+            auto mut_hole{this->find_slot(key)};
+
+            if (!*m_used.at_if(slot_of(mut_hole))) {
+                return false;
+            }
+
+            /// NOTE:
+            /// - This is the same backward shift deletion that is used
+            ///   by bsl::unordered_map. All of the distance math is done
+            ///   modulo SLOTS, and adding SLOTS first ensures that the
+            ///   subtraction cannot underflow, so it is marked as checked.
+            ///
+
+            constexpr auto mask{(SLOTS - safe_umx::magic_1()).checked()};
+            auto mut_idx{next_of(mut_hole)};
+
+            while (*m_used.at_if(slot_of(mut_idx))) {
+                auto const home{home_of(*m_keys.at_if(slot_of(mut_idx)))};
+                auto const dist_home{(((mut_idx + SLOTS) - home) & mask).checked()};
+                auto const dist_hole{(((mut_idx + SLOTS) - mut_hole) & mask).checked()};
+
+                if (dist_home >= dist_hole) {
+                    *m_keys.at_if(slot_of(mut_hole)) = bsl::move(*m_keys.at_if(slot_of(mut_idx)));
+                    *m_vals.at_if(slot_of(mut_hole)) = bsl::move(*m_vals.at_if(slot_of(mut_idx)));
+                    mut_hole = mut_idx;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                mut_idx = next_of(mut_idx);
+            }
+
+            *m_keys.at_if(slot_of(mut_hole)) = {};
+            *m_vals.at_if(slot_of(mut_hole)) = {};
+            *m_used.at_if(slot_of(mut_hole)) = false;
+
+            /// NOTE:
+            /// - The m_size math below is really acting as an index
+            ///   so it is marked as checked. It cannot underflow.
+            ///
+
+            m_size = (m_size - safe_umx::magic_1()).checked();
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the map contains the provided key,
+        ///     returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key associated with the value to query
+        ///   @return Returns true if the map contains the provided key,
+        ///     returns false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        contains(KEY_TYPE const &key) const noexcept -> bool
+        {
+            return *m_used.at_if(slot_of(this->find_slot(key)));
+        }
+    };
+}
+
+#endif
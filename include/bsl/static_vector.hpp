@@ -0,0 +1,879 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file static_vector.hpp
+///
+
+#ifndef BSL_STATIC_VECTOR_HPP
+#define BSL_STATIC_VECTOR_HPP
+
+#include "bsl/array.hpp"
+#include "bsl/conditional.hpp"
+#include "bsl/construct_at.hpp"
+#include "bsl/contiguous_iterator.hpp"    // IWYU pragma: export
+#include "bsl/cstdint.hpp"
+#include "bsl/destroy_at.hpp"
+#include "bsl/details/out.hpp"
+#include "bsl/details/static_vector_storage.hpp"
+#include "bsl/discard.hpp"
+#include "bsl/ensures.hpp"
+#include "bsl/errc_type.hpp"
+#include "bsl/expects.hpp"
+#include "bsl/forward.hpp"
+#include "bsl/is_constant_evaluated.hpp"
+#include "bsl/is_copy_assignable.hpp"
+#include "bsl/is_default_constructible.hpp"
+#include "bsl/is_nothrow_destructible.hpp"
+#include "bsl/is_trivially_copyable.hpp"
+#include "bsl/is_trivially_destructible.hpp"
+#include "bsl/move.hpp"
+#include "bsl/safe_idx.hpp"
+#include "bsl/safe_integral.hpp"
+#include "bsl/touch.hpp"
+#include "bsl/unlikely.hpp"
+
+namespace bsl
+{
+    /// @class bsl::static_vector
+    ///
+    /// <!-- description -->
+    ///   @brief Provides a container with a variable size and a fixed
+    ///     capacity of N elements. Unlike a bsl::array, an element of a
+    ///     non-trivial type is only constructed (using bsl::construct_at)
+    ///     when it is added, and destroyed (using bsl::destroy_at) when it
+    ///     is removed, so a non-trivial element type costs nothing until
+    ///     it is used. Trivially copyable elements are simply stored in a
+    ///     bsl::array, which is what allows a bsl::static_vector of them
+    ///     to be used in a constant expression. Unlike a
+    ///     bsl::unordered_map, a bsl::static_vector never allocates, so
+    ///     running out of capacity is reported as an error instead.
+    ///   @include example_static_vector_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of element being stored.
+    ///   @tparam N the max number of elements that can be stored. Cannot be 0
+    ///
+    template<typename T, bsl::uintmx N>
+    class static_vector final
+    {
+        static_assert(static_cast<bsl::uintmx>(0) != N, "vectors of size 0 are not supported");
+        static_assert(is_nothrow_destructible<T>::value);
+
+        /// @brief true if the elements are stored in a bsl::array
+        static constexpr bool IN_ARRAY{
+            is_trivially_copyable<T>::value && is_default_constructible<T>::value &&
+            is_copy_assignable<T>::value};
+
+        /// @brief stores the type used to store the elements
+        using storage_type =
+            conditional_t<IN_ARRAY, array<T, N>, details::static_vector_storage<T, N>>;
+
+        /// @brief stores the (possibly unconstructed) elements
+        storage_type m_storage{};
+        /// @brief stores the number of constructed elements
+        safe_umx m_size{};
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the storage of the element at
+        ///     index "index", which may not have been constructed yet.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the storage to return
+        ///   @return Returns a pointer to the storage of the element at
+        ///     index "index".
+        ///
+        [[nodiscard]] constexpr auto
+        storage(bsl::uintmx const index) noexcept -> T *
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return m_storage.data() + index;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the storage of the element at
+        ///     index "index", which may not have been constructed yet.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the storage to return
+        ///   @return Returns a pointer to the storage of the element at
+        ///     index "index".
+        ///
+        [[nodiscard]] constexpr auto
+        storage(bsl::uintmx const index) const noexcept -> T const *
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return m_storage.data() + index;
+        }
+
+        /// <!-- description -->
+        ///   @brief Constructs the element at index "index" using the
+        ///     provided arguments. If the elements are stored in a
+        ///     bsl::array, the element is already alive, so it is assigned
+        ///     instead, which (unlike a placement new) can be done in a
+        ///     constant expression.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam ARGS the types of the arguments used to construct T
+        ///   @param index the index of the element to construct
+        ///   @param pudm_udm_args the arguments used to construct T
+        ///   @return Returns a pointer to the newly constructed T
+        ///
+        template<typename... ARGS>
+        [[maybe_unused]] constexpr auto
+        construct(bsl::uintmx const index, ARGS &&...pudm_udm_args) noexcept -> T *
+        {
+            auto *const pmut_elem{this->storage(index)};
+            if constexpr (IN_ARRAY) {
+                *pmut_elem = T{bsl::forward<ARGS>(pudm_udm_args)...};
+            }
+            else {
+                bsl::discard(bsl::construct_at<T>(pmut_elem, bsl::forward<ARGS>(pudm_udm_args)...));
+            }
+
+            return pmut_elem;
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroys the elements in [count, size()) and sets the
+        ///     size to count.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param count the number of elements to keep
+        ///
+        constexpr void
+        shrink_to(safe_umx const &count) noexcept
+        {
+            if constexpr (!is_trivially_destructible<T>::value) {
+                for (safe_idx mut_i{count.get()}; mut_i < m_size; ++mut_i) {
+                    bsl::destroy_at(this->storage(mut_i.get()));
+                }
+            }
+
+            m_size = count;
+        }
+
+        /// <!-- description -->
+        ///   @brief Copy constructs each element of o into this (empty)
+        ///     vector.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the vector to copy the elements from
+        ///
+        constexpr void
+        copy_from(static_vector const &o) noexcept
+        {
+            for (safe_idx mut_i{}; mut_i < o.m_size; ++mut_i) {
+                bsl::discard(this->construct(mut_i.get(), *o.storage(mut_i.get())));
+            }
+
+            m_size = o.m_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Move constructs each element of mut_o into this (empty)
+        ///     vector. The elements of mut_o are moved from, but are not
+        ///     removed from mut_o.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the vector to move the elements from
+        ///
+        constexpr void
+        move_from(static_vector &&mut_o) noexcept
+        {
+            for (safe_idx mut_i{}; mut_i < mut_o.m_size; ++mut_i) {
+                auto &mut_elem{*mut_o.storage(mut_i.get())};
+                bsl::discard(this->construct(mut_i.get(), bsl::move(mut_elem)));
+            }
+
+            m_size = mut_o.m_size;
+        }
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+        /// @brief alias for: safe_umx
+        using size_type = safe_umx;
+        /// @brief alias for: safe_idx
+        using index_type = safe_idx;
+        /// @brief alias for: safe_umx
+        using difference_type = safe_umx;
+        /// @brief alias for: T &
+        using reference_type = T &;
+        /// @brief alias for: T const &
+        using const_reference_type = T const &;
+        /// @brief alias for: T *
+        using pointer_type = T *;
+        /// @brief alias for: T const *
+        using const_pointer_type = T const *;
+        /// @brief alias for: contiguous_iterator<T>
+        using iterator_type = contiguous_iterator<T>;
+        /// @brief alias for: contiguous_iterator<T const>
+        using const_iterator_type = contiguous_iterator<T const>;
+
+        /// <!-- description -->
+        ///   @brief Creates an empty bsl::static_vector. No elements are
+        ///     constructed.
+        ///
+        constexpr static_vector() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Destroys every element in the bsl::static_vector.
+        ///
+        constexpr ~static_vector() noexcept
+        {
+            this->clear();
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr static_vector(static_vector const &o) noexcept
+        {
+            this->copy_from(o);
+        }
+
+        /// <!-- description -->
+        ///   @brief move constructor. The elements of mut_o are moved
+        ///     from, but are not removed from mut_o.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr static_vector(static_vector &&mut_o) noexcept
+        {
+            this->move_from(bsl::move(mut_o));
+        }
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto
+        operator=(static_vector const &o) &noexcept -> static_vector &
+        {
+            if (this == &o) {
+                return *this;
+            }
+
+            this->clear();
+            this->copy_from(o);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief move assignment. The elements of mut_o are moved
+        ///     from, but are not removed from mut_o.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto
+        operator=(static_vector &&mut_o) &noexcept -> static_vector &
+        {
+            if (this == &mut_o) {
+                return *this;
+            }
+
+            this->clear();
+            this->move_from(bsl::move(mut_o));
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the instance of T stored at index
+        ///     "index". If the index is out of bounds, this function
+        ///     returns a nullptr.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the instance to return
+        ///   @return Returns a pointer to the instance of T stored at index
+        ///     "index". If the index is out of bounds, this function
+        ///     returns a nullptr.
+        ///
+        [[nodiscard]] constexpr auto
+        at_if(index_type const &index) &noexcept -> pointer_type
+        {
+            expects(index.is_valid());
+
+            if (unlikely(index >= m_size)) {
+                return nullptr;
+            }
+
+            return this->storage(index.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the instance of T stored at index
+        ///     "index". If the index is out of bounds, this function
+        ///     returns a nullptr.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the instance to return
+        ///   @return Returns a pointer to the instance of T stored at index
+        ///     "index". If the index is out of bounds, this function
+        ///     returns a nullptr.
+        ///
+        [[nodiscard]] constexpr auto
+        at_if(index_type const &index) const &noexcept -> const_pointer_type
+        {
+            expects(index.is_valid());
+
+            if (unlikely(index >= m_size)) {
+                return nullptr;
+            }
+
+            return this->storage(index.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the first element in the vector,
+        ///     or a nullptr if the vector is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the first element in the vector,
+        ///     or a nullptr if the vector is empty.
+        ///
+        [[nodiscard]] constexpr auto
+        front_if() &noexcept -> pointer_type
+        {
+            return this->at_if({});
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the first element in the vector,
+        ///     or a nullptr if the vector is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the first element in the vector,
+        ///     or a nullptr if the vector is empty.
+        ///
+        [[nodiscard]] constexpr auto
+        front_if() const &noexcept -> const_pointer_type
+        {
+            return this->at_if({});
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the last element in the vector,
+        ///     or a nullptr if the vector is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the last element in the vector,
+        ///     or a nullptr if the vector is empty.
+        ///
+        [[nodiscard]] constexpr auto
+        back_if() &noexcept -> pointer_type
+        {
+            if (unlikely(this->empty())) {
+                return nullptr;
+            }
+
+            return this->storage((m_size - safe_umx::magic_1()).checked().get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the last element in the vector,
+        ///     or a nullptr if the vector is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the last element in the vector,
+        ///     or a nullptr if the vector is empty.
+        ///
+        [[nodiscard]] constexpr auto
+        back_if() const &noexcept -> const_pointer_type
+        {
+            if (unlikely(this->empty())) {
+                return nullptr;
+            }
+
+            return this->storage((m_size - safe_umx::magic_1()).checked().get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the first element in the vector,
+        ///     or a nullptr if the vector is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the first element in the vector,
+        ///     or a nullptr if the vector is empty.
+        ///
+        [[nodiscard]] constexpr auto
+        data() &noexcept -> pointer_type
+        {
+            return this->front_if();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the first element in the vector,
+        ///     or a nullptr if the vector is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the first element in the vector,
+        ///     or a nullptr if the vector is empty.
+        ///
+        [[nodiscard]] constexpr auto
+        data() const &noexcept -> const_pointer_type
+        {
+            return this->front_if();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to the first element of the vector.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to the first element of the vector.
+        ///
+        [[nodiscard]] constexpr auto
+        begin() &noexcept -> iterator_type
+        {
+            return iterator_type{this->front_if(), m_size, {}};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to the first element of the vector.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to the first element of the vector.
+        ///
+        [[nodiscard]] constexpr auto
+        begin() const &noexcept -> const_iterator_type
+        {
+            return const_iterator_type{this->front_if(), m_size, {}};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to the first element of the vector.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to the first element of the vector.
+        ///
+        [[nodiscard]] constexpr auto
+        cbegin() const &noexcept -> const_iterator_type
+        {
+            return const_iterator_type{this->front_if(), m_size, {}};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to one past the last element of the
+        ///     vector. If you attempt to access this iterator, a nullptr will
+        ///     always be returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to one past the last element of the
+        ///     vector. If you attempt to access this iterator, a nullptr will
+        ///     always be returned.
+        ///
+        [[nodiscard]] constexpr auto
+        end() &noexcept -> iterator_type
+        {
+            return iterator_type{this->front_if(), m_size, index_type{m_size.get()}};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to one past the last element of the
+        ///     vector. If you attempt to access this iterator, a nullptr will
+        ///     always be returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to one past the last element of the
+        ///     vector. If you attempt to access this iterator, a nullptr will
+        ///     always be returned.
+        ///
+        [[nodiscard]] constexpr auto
+        end() const &noexcept -> const_iterator_type
+        {
+            return const_iterator_type{this->front_if(), m_size, index_type{m_size.get()}};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an iterator to one past the last element of the
+        ///     vector. If you attempt to access this iterator, a nullptr will
+        ///     always be returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns an iterator to one past the last element of the
+        ///     vector. If you attempt to access this iterator, a nullptr will
+        ///     always be returned.
+        ///
+        [[nodiscard]] constexpr auto
+        cend() const &noexcept -> const_iterator_type
+        {
+            return const_iterator_type{this->front_if(), m_size, index_type{m_size.get()}};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the vector has no elements
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the vector has no elements
+        ///
+        [[nodiscard]] constexpr auto
+        empty() const noexcept -> bool
+        {
+            return m_size.is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the vector has N elements
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the vector has N elements
+        ///
+        [[nodiscard]] constexpr auto
+        full() const noexcept -> bool
+        {
+            return m_size == max_size();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of elements in the vector
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of elements in the vector
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> size_type const &
+        {
+            ensures(m_size.is_valid_and_checked());
+            return m_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max number of elements the vector can
+        ///     store (i.e., N)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max number of elements the vector can
+        ///     store (i.e., N)
+        ///
+        [[nodiscard]] static constexpr auto
+        max_size() noexcept -> size_type
+        {
+            return size_type{N};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns size() * sizeof(T)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns size() * sizeof(T)
+        ///
+        [[nodiscard]] constexpr auto
+        size_bytes() const noexcept -> size_type
+        {
+            /// NOTE:
+            /// - size() cannot be larger than N, and N * sizeof(T) is the
+            ///   size of the storage, so this cannot overflow, which is why
+            ///   it is marked as checked().
+            ///
+
+            return (m_size * sizeof(T)).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Constructs a T at the end of the vector using the
+        ///     provided arguments, and returns a pointer to it. If the
+        ///     vector is full, nothing is constructed and a nullptr is
+        ///     returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam ARGS the types of the arguments used to construct T
+        ///   @param pudm_udm_args the arguments used to construct T
+        ///   @return Returns a pointer to the newly constructed T, or a
+        ///     nullptr if the vector is full.
+        ///
+        template<typename... ARGS>
+        [[maybe_unused]] constexpr auto
+        emplace_back(ARGS &&...pudm_udm_args) noexcept -> pointer_type
+        {
+            if (unlikely(this->full())) {
+                return nullptr;
+            }
+
+            auto *const pmut_elem{
+                this->construct(m_size.get(), bsl::forward<ARGS>(pudm_udm_args)...)};
+
+            m_size = (m_size + safe_umx::magic_1()).checked();
+            return pmut_elem;
+        }
+
+        /// <!-- description -->
+        ///   @brief Copies val to the end of the vector. If the vector is
+        ///     full, bsl::errc_failure is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to add to the vector
+        ///   @return Returns bsl::errc_success on success, or
+        ///     bsl::errc_failure if the vector is full.
+        ///
+        [[nodiscard]] constexpr auto
+        try_push_back(T const &val) noexcept -> errc_type
+        {
+            if (unlikely(nullptr == this->emplace_back(val))) {
+                return errc_failure;
+            }
+
+            return errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves mut_val to the end of the vector. If the vector
+        ///     is full, bsl::errc_failure is returned and mut_val is not
+        ///     moved from.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_val the value to add to the vector
+        ///   @return Returns bsl::errc_success on success, or
+        ///     bsl::errc_failure if the vector is full.
+        ///
+        [[nodiscard]] constexpr auto
+        try_push_back(T &&mut_val) noexcept -> errc_type
+        {
+            if (unlikely(nullptr == this->emplace_back(bsl::move(mut_val)))) {
+                return errc_failure;
+            }
+
+            return errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroys the last element in the vector. If the vector
+        ///     is empty, this function does nothing.
+        ///
+        constexpr void
+        pop_back() noexcept
+        {
+            if (unlikely(this->empty())) {
+                return;
+            }
+
+            this->shrink_to((m_size - safe_umx::magic_1()).checked());
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes the element at index "index", moving every
+        ///     element after it down by one so that the order of the
+        ///     remaining elements is kept. This is O(size()). If the order
+        ///     does not matter, use swap_erase() instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the element to remove
+        ///   @return Returns bsl::errc_success on success, or
+        ///     bsl::errc_index_out_of_bounds if index >= size().
+        ///
+        [[nodiscard]] constexpr auto
+        erase(index_type const &index) noexcept -> errc_type
+        {
+            expects(index.is_valid());
+
+            if (unlikely(index >= m_size)) {
+                return errc_index_out_of_bounds;
+            }
+
+            auto mut_i{index};
+            for (auto mut_j{index + safe_idx::magic_1()}; mut_j < m_size; ++mut_j) {
+                *this->storage(mut_i.get()) = bsl::move(*this->storage(mut_j.get()));
+                mut_i = mut_j;
+            }
+
+            this->pop_back();
+            return errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes the element at index "index" by moving the last
+        ///     element into its place. This is O(1), but does not keep the
+        ///     order of the remaining elements.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the element to remove
+        ///   @return Returns bsl::errc_success on success, or
+        ///     bsl::errc_index_out_of_bounds if index >= size().
+        ///
+        [[nodiscard]] constexpr auto
+        swap_erase(index_type const &index) noexcept -> errc_type
+        {
+            expects(index.is_valid());
+
+            if (unlikely(index >= m_size)) {
+                return errc_index_out_of_bounds;
+            }
+
+            auto *const pmut_last{this->back_if()};
+            if (pmut_last != this->storage(index.get())) {
+                *this->storage(index.get()) = bsl::move(*pmut_last);
+            }
+            else {
+                bsl::touch();
+            }
+
+            this->pop_back();
+            return errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Changes the number of elements in the vector to count.
+        ///     If count is smaller than size(), the extra elements are
+        ///     destroyed. If count is larger than size(), the new elements
+        ///     are value-initialized. If count is larger than N, nothing
+        ///     is changed and bsl::errc_failure is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param count the number of elements the vector should have
+        ///   @return Returns bsl::errc_success on success, or
+        ///     bsl::errc_failure if count is larger than N.
+        ///
+        [[nodiscard]] constexpr auto
+        resize(size_type const &count) noexcept -> errc_type
+        {
+            expects(count.is_valid_and_checked());
+
+            if (unlikely(count > max_size())) {
+                return errc_failure;
+            }
+
+            if (count < m_size) {
+                this->shrink_to(count);
+                return errc_success;
+            }
+
+            while (m_size < count) {
+                bsl::discard(this->emplace_back());
+            }
+
+            return errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroys every element in the vector.
+        ///
+        constexpr void
+        clear() noexcept
+        {
+            this->shrink_to({});
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns true if two vectors have the same size and
+    ///     contain the same contents. Returns false otherwise.
+    ///   @related bsl::static_vector
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element being stored.
+    ///   @tparam N the max number of elements that can be stored.
+    ///   @param lhs the left hand side of the operation
+    ///   @param rhs the right hand side of the operation
+    ///   @return Returns true if two vectors have the same size and
+    ///     contain the same contents. Returns false otherwise.
+    ///
+    template<typename T, bsl::uintmx N>
+    [[nodiscard]] constexpr auto
+    operator==(static_vector<T, N> const &lhs, static_vector<T, N> const &rhs) noexcept -> bool
+    {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+
+        for (safe_idx mut_i{}; mut_i < lhs.size(); ++mut_i) {
+            if (*lhs.at_if(mut_i) != *rhs.at_if(mut_i)) {
+                return false;
+            }
+
+            bsl::touch();
+        }
+
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns false if two vectors have the same size and
+    ///     contain the same contents. Returns true otherwise.
+    ///   @related bsl::static_vector
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of element being stored.
+    ///   @tparam N the max number of elements that can be stored.
+    ///   @param lhs the left hand side of the operation
+    ///   @param rhs the right hand side of the operation
+    ///   @return Returns false if two vectors have the same size and
+    ///     contain the same contents. Returns true otherwise.
+    ///
+    template<typename T, bsl::uintmx N>
+    [[nodiscard]] constexpr auto
+    operator!=(static_vector<T, N> const &lhs, static_vector<T, N> const &rhs) noexcept -> bool
+    {
+        return !(lhs == rhs);
+    }
+
+    /// <!-- description -->
+    ///   @brief Outputs the provided bsl::static_vector to the provided
+    ///     output type.
+    ///   @related bsl::static_vector
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T1 the type of outputter provided
+    ///   @tparam T2 the type of element being stored.
+    ///   @tparam N the max number of elements that can be stored.
+    ///   @param o the instance of the outputter used to output the value.
+    ///   @param val the vector to output
+    ///   @return return o
+    ///
+    template<typename T1, typename T2, bsl::uintmx N>
+    [[maybe_unused]] constexpr auto
+    operator<<(out<T1> const o, static_vector<T2, N> const &val) noexcept -> out<T1>
+    {
+        if (is_constant_evaluated()) {
+            return o;
+        }
+
+        if constexpr (o.empty()) {
+            return o;
+        }
+
+        if (val.empty()) {
+            return o << "[]";
+        }
+
+        for (safe_idx mut_i{}; mut_i < val.size(); ++mut_i) {
+            if (mut_i.is_zero()) {
+                o << "[" << *val.at_if(mut_i);
+            }
+            else {
+                o << ", " << *val.at_if(mut_i);
+            }
+        }
+
+        return o << ']';
+    }
+}
+
+#endif
@@ -0,0 +1,246 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file ticket_lock.hpp
+///
+
+#ifndef BSL_TICKET_LOCK_HPP
+#define BSL_TICKET_LOCK_HPP
+
+#include "bsl/atomic.hpp"
+#include "bsl/cstdint.hpp"
+#include "bsl/details/cpu_relax.hpp"
+#include "bsl/discard.hpp"
+#include "bsl/lock_stats.hpp"
+#include "bsl/memory_order.hpp"
+#include "bsl/safe_integral.hpp"
+#include "bsl/touch.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief defines the shift of the next ticket in a ticket_lock
+        constexpr bsl::uint64 TICKET_LOCK_NEXT_SHIFT{static_cast<bsl::uint64>(32)};
+        /// @brief defines the amount added to a ticket_lock to take a ticket
+        constexpr bsl::uint64 TICKET_LOCK_NEXT_ONE{static_cast<bsl::uint64>(0x100000000U)};
+        /// @brief defines the mask of the ticket being served in a ticket_lock
+        constexpr bsl::uint64 TICKET_LOCK_SERVING_MASK{static_cast<bsl::uint64>(0xFFFFFFFFU)};
+        /// @brief defines the amount added to serve the next ticket when it wraps
+        constexpr bsl::uint64 TICKET_LOCK_SERVING_WRAP{
+            static_cast<bsl::uint64>(0xFFFFFFFF00000001U)};
+    }
+
+    /// @class bsl::ticket_lock
+    ///
+    /// <!-- description -->
+    ///   @brief A fair spinlock. Each thread that wants the lock takes a
+    ///     ticket, and the lock is handed out in ticket order, so no
+    ///     thread can starve. All waiters spin on the same "now serving"
+    ///     counter, so each release still invalidates the cache line of
+    ///     every waiter. If that becomes the bottleneck, use a
+    ///     bsl::mcs_lock instead. The lock never blocks in the OS. Use a
+    ///     bsl::lock_guard to release the lock when leaving a scope.
+    ///   @include example_ticket_lock_overview.hpp
+    ///
+    class ticket_lock final
+    {
+        /// NOTE:
+        /// - The next ticket to hand out and the ticket being served are
+        ///   stored in the same word, so that taking a ticket also tells
+        ///   the thread whether anyone was ahead of it at that moment.
+        ///
+
+        /// @brief stores the next ticket to hand out (upper 32 bits) and
+        ///   the ticket that currently holds the lock (lower 32 bits)
+        atomic<bsl::uint64> m_tickets{};
+        /// @brief stores the lock's statistics (see BSL_LOCK_STATS)
+        lock_stats m_stats{};
+
+        /// <!-- description -->
+        ///   @brief Returns the next ticket to hand out
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tickets the value of m_tickets to decode
+        ///   @return Returns the next ticket to hand out
+        ///
+        [[nodiscard]] static constexpr auto
+        next_of(bsl::uint64 const tickets) noexcept -> bsl::uint64
+        {
+            return tickets >> details::TICKET_LOCK_NEXT_SHIFT;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the ticket that currently holds the lock
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tickets the value of m_tickets to decode
+        ///   @return Returns the ticket that currently holds the lock
+        ///
+        [[nodiscard]] static constexpr auto
+        serving_of(bsl::uint64 const tickets) noexcept -> bsl::uint64
+        {
+            return tickets & details::TICKET_LOCK_SERVING_MASK;
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Acquires the lock, spinning until every thread that
+        ///     asked for it first has released it.
+        ///
+        void
+        lock() noexcept
+        {
+            constexpr auto acquire{memory_order::memory_order_acquire};
+            constexpr auto one{safe_u64{details::TICKET_LOCK_NEXT_ONE}};
+
+            auto const tickets{m_tickets.fetch_wrap_add(one, acquire).get()};
+            auto const ticket{next_of(tickets)};
+            bool const contended{serving_of(tickets) != ticket};
+
+            bsl::uint64 mut_spins{};
+            if (contended) {
+                while (serving_of(m_tickets.load(acquire).get()) != ticket) {
+                    ++mut_spins;
+                    details::cpu_relax();
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_stats.record_acquire(contended, mut_spins);
+        }
+
+        /// <!-- description -->
+        ///   @brief Acquires the lock if no one holds it or is waiting
+        ///     for it, without spinning.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the lock was acquired, false if it
+        ///     is held by (or promised to) someone else.
+        ///
+        [[nodiscard]] auto
+        try_lock() noexcept -> bool
+        {
+            constexpr auto acquire{memory_order::memory_order_acquire};
+            constexpr auto relaxed{memory_order::memory_order_relaxed};
+            constexpr auto one{safe_u64{details::TICKET_LOCK_NEXT_ONE}};
+
+            auto mut_tickets{m_tickets.load(relaxed)};
+            if (next_of(mut_tickets.get()) != serving_of(mut_tickets.get())) {
+                return false;
+            }
+
+            if (!m_tickets.compare_exchange(mut_tickets, mut_tickets.wrap_add(one), acquire)) {
+                return false;
+            }
+
+            m_stats.record_acquire(false, {});
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases the lock, handing it to the next ticket.
+        ///     Must only be called by the thread that holds the lock.
+        ///
+        void
+        unlock() noexcept
+        {
+            constexpr auto release{memory_order::memory_order_release};
+            constexpr auto relaxed{memory_order::memory_order_relaxed};
+
+            m_stats.record_release();
+
+            /// NOTE:
+            /// - Only the owner changes the ticket being served, so it
+            ///   knows whether adding one will wrap it. If it does, the
+            ///   carry that would land in the next ticket is taken back
+            ///   out by the same add.
+            ///
+
+            safe_u64 mut_inc{safe_u64::magic_1()};
+            if (details::TICKET_LOCK_SERVING_MASK == serving_of(m_tickets.load(relaxed).get())) {
+                mut_inc = safe_u64{details::TICKET_LOCK_SERVING_WRAP};
+            }
+            else {
+                bsl::touch();
+            }
+
+            bsl::discard(m_tickets.fetch_wrap_add(mut_inc, release));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the lock is held. If other threads
+        ///     are running, the answer might already be out of date when
+        ///     it is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the lock is held.
+        ///
+        [[nodiscard]] auto
+        is_locked() const noexcept -> bool
+        {
+            auto const tickets{m_tickets.load(memory_order::memory_order_relaxed).get()};
+            return next_of(tickets) != serving_of(tickets);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of threads that have taken a
+        ///     ticket and are waiting for the lock, not counting the
+        ///     thread that holds it. If other threads are running, the
+        ///     answer might already be out of date when it is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of threads that are waiting
+        ///     for the lock.
+        ///
+        [[nodiscard]] auto
+        waiters() const noexcept -> safe_u32
+        {
+            auto const tickets{m_tickets.load(memory_order::memory_order_relaxed).get()};
+            auto const queued{static_cast<bsl::uint32>(next_of(tickets) - serving_of(tickets))};
+            if (static_cast<bsl::uint32>(0) == queued) {
+                return safe_u32{queued};
+            }
+
+            return safe_u32{static_cast<bsl::uint32>(queued - static_cast<bsl::uint32>(1))};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the lock's statistics. These are only
+        ///     recorded if BSL_LOCK_STATS is defined.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the lock's statistics
+        ///
+        [[nodiscard]] constexpr auto
+        stats() const noexcept -> lock_stats const &
+        {
+            return m_stats;
+        }
+    };
+}
+
+#endif
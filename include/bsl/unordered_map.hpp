@@ -25,32 +25,87 @@
 #ifndef BSL_UNORDERED_MAP_HPP
 #define BSL_UNORDERED_MAP_HPP
 
-#include "bsl/details/unordered_map_node_type.hpp"
+#include "bsl/discard.hpp"
 #include "bsl/ensures.hpp"
+#include "bsl/errc_type.hpp"
+#include "bsl/expects.hpp"
+#include "bsl/hash.hpp"
+#include "bsl/heap_allocator.hpp"
 #include "bsl/is_copy_constructible.hpp"
 #include "bsl/is_default_constructible.hpp"
+#include "bsl/move.hpp"
+#include "bsl/safe_idx.hpp"
 #include "bsl/safe_integral.hpp"
 #include "bsl/touch.hpp"
+#include "bsl/unlikely.hpp"
 
 namespace bsl
 {
+    namespace details
+    {
+        /// @brief defines the smallest number of slots a map will allocate
+        constexpr bsl::safe_umx UNORDERED_MAP_MIN_CAPACITY{static_cast<bsl::uintmx>(8)};
+        /// @brief defines the numerator of the map's max load factor (3/4)
+        constexpr bsl::safe_umx UNORDERED_MAP_LOAD_NUM{static_cast<bsl::uintmx>(3)};
+        /// @brief defines the denominator of the map's max load factor (3/4)
+        constexpr bsl::safe_umx UNORDERED_MAP_LOAD_DEN{static_cast<bsl::uintmx>(4)};
+
+        /// <!-- description -->
+        ///   @brief Returns the smallest capacity that is a power of 2
+        ///     that can hold count elements without exceeding the map's
+        ///     max load factor. This is shared by bsl::unordered_map and
+        ///     bsl::static_unordered_map. Since the load factor is below
+        ///     1, the result always leaves at least one slot empty, which
+        ///     is what bounds a lookup.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param count the number of elements the table must hold
+        ///   @return Returns the smallest capacity that is a power of 2
+        ///     that can hold count elements without exceeding the map's
+        ///     max load factor.
+        ///
+        [[nodiscard]] constexpr auto
+        unordered_map_capacity_for(safe_umx const &count) noexcept -> safe_umx
+        {
+            auto mut_capacity{UNORDERED_MAP_MIN_CAPACITY};
+            auto const needed{(count * UNORDERED_MAP_LOAD_DEN).checked()};
+
+            while ((mut_capacity * UNORDERED_MAP_LOAD_NUM).checked() < needed) {
+                mut_capacity = (mut_capacity << safe_umx::magic_1()).checked();
+            }
+
+            return mut_capacity;
+        }
+    }
+
     /// @class bsl::unordered_map
     ///
     /// <!-- description -->
     ///   @brief Implements a small subset of the std::unordered_map APIs,
-    ///     specifically to support unit testing with a couple key differences:
-    ///     - The bsl::unordered_map is really just a linked list.
-    ///       The std::unordered_map is a hash table, which uses linked lists
-    ///       when collisions occur (usually), but in this case, we implement
-    ///       the hash table as if everything hashes to the same entry, and
-    ///       therefore everything must be added to a linked list and searched
-    ///       for. This means that the bsl::unordered_map is slow and should
-    ///       only be used for unit testing
+    ///     with a couple key differences:
+    ///     - The bsl::unordered_map is an open addressing hash table that
+    ///       uses linear probing. The keys, values and the "slot in use"
+    ///       flags are each stored in their own flat array so that a
+    ///       lookup only has to walk a small, contiguous range of keys.
+    ///       Removing an element uses backward shift deletion, which means
+    ///       that there are no tombstones and lookups never degrade after
+    ///       a long series of inserts and erases. When the load factor
+    ///       would exceed 3/4, the table doubles in size and every element
+    ///       is rehashed. Use reserve() to pre-allocate the table and
+    ///       avoid rehashing altogether.
+    ///     - The hash function is provided using the HASH template
+    ///       parameter, which defaults to bsl::hash<KEY_TYPE>. To use a
+    ///       custom key type, specialize bsl::hash.
+    ///     - The table is allocated using the ALLOCATOR template
+    ///       parameter, which defaults to bsl::heap_allocator. To keep
+    ///       the map off of the global heap, use a bsl::arena_allocator
+    ///       and reserve() the table up front. Since an arena_allocator
+    ///       can run out of memory, at_if() and insert() report a failed
+    ///       allocation instead of adding the element, and try_reserve()
+    ///       reports a failed reserve().
     ///     - Unlike std::unordered_map, bsl::unordered_map is a
     ///       "constexpr everything" structure, meaning it can be used in a
     ///       constexpr.
-    ///     - The unordered map is not copyable or movable. Again, this is
-    ///       only intended for use with unit tests and creating mocks.
     ///     - The at function can get/set values which std::unordered_map
     ///       does not support. This is intended to keep the APIs simple, but
     ///       it also means that the bsl::unordered_map is not compatible with
@@ -63,6 +118,10 @@ namespace bsl
     ///       from the map that doesn't exist, the map will return a reference
     ///       to a default value, so taking the address of the reference is
     ///       undefined as the resulting address depends on map's state.
+    ///     - Since elements are stored inline in the table, adding an
+    ///       element to the map might move every other element. A
+    ///       reference returned by at() is only valid until the next
+    ///       call to at(), erase(), reserve() or clear().
     ///     - We also don't support overlapping keys, meaning each key that
     ///       is added must be unique. If you attempt to set the value of a
     ///       key more than once, it will overwrite the existing value.
@@ -70,81 +129,307 @@ namespace bsl
     /// <!-- template parameters -->
     ///   @tparam KEY_TYPE the type of key to use
     ///   @tparam T the type of value to use
+    ///   @tparam HASH the type of hash function to use
+    ///   @tparam ALLOCATOR the type of allocator to allocate the table with
     ///
-    template<typename KEY_TYPE, typename T>
+    template<
+        typename KEY_TYPE,
+        typename T,
+        typename HASH = hash<KEY_TYPE>,
+        typename ALLOCATOR = heap_allocator>
     class unordered_map final
     {
-        /// @brief defines the type of node used for the linked list.
-        using nd_t = details::unordered_map_node_type<KEY_TYPE, T>;
-
         static_assert(is_copy_constructible<KEY_TYPE>::value);
+        static_assert(is_default_constructible<KEY_TYPE>::value);
         static_assert(is_default_constructible<T>::value);
 
+        /// @brief stores the allocator used to allocate the table
+        ALLOCATOR m_alloc{};
         /// @brief stores a default T when we have nothing else to return
         T m_default{};
-        /// @brief stores the head of the linked list.
-        nd_t *m_head{};
+        /// @brief stores the keys of each slot in the table
+        KEY_TYPE *m_keys{};
+        /// @brief stores the values of each slot in the table
+        T *m_vals{};
+        /// @brief stores whether or not each slot in the table is in use
+        bool *m_used{};
         /// @brief stores the size of the map
         safe_umx m_size{};
+        /// @brief stores the total number of slots in the table
+        safe_umx m_capacity{};
 
-    public:
         /// <!-- description -->
-        ///   @brief Creates a default constructed bsl::unordered_map
+        ///   @brief Returns the index of the slot that the provided key
+        ///     hashes to.
         ///
-        constexpr unordered_map() noexcept = default;
+        /// <!-- inputs/outputs -->
+        ///   @param key the key to get the home slot for
+        ///   @return Returns the index of the slot that the provided key
+        ///     hashes to.
+        ///
+        [[nodiscard]] constexpr auto
+        home_of(KEY_TYPE const &key) const noexcept -> safe_umx
+        {
+            /// NOTE:
+            /// - The capacity is always a power of 2 and never 0 when
+            ///   this is called, so the mask cannot underflow.
+            ///
+
+            auto const mask{(m_capacity - safe_umx::magic_1()).checked()};
+            return (HASH{}(key) & mask).checked();
+        }
 
         /// <!-- description -->
-        ///   @brief Destroyes a previously created bsl::unordered_map, calling
-        ///     the provided function if ignore() was never called
+        ///   @brief Returns the index of the slot that follows the
+        ///     provided slot, wrapping around to the start of the table.
         ///
-        constexpr ~unordered_map() noexcept
+        /// <!-- inputs/outputs -->
+        ///   @param idx the slot to get the next slot of
+        ///   @return Returns the index of the slot that follows idx
+        ///
+        [[nodiscard]] constexpr auto
+        next_of(safe_umx const &idx) const noexcept -> safe_umx
         {
-            this->clear();
+            /// NOTE:
+            /// - idx is always less than the capacity which is never
+            ///   larger than half of safe_umx::max_value(), so the math
+            ///   below cannot overflow.
+            ///
+
+            auto const mask{(m_capacity - safe_umx::magic_1()).checked()};
+            return ((idx + safe_umx::magic_1()) & mask).checked();
         }
 
         /// <!-- description -->
-        ///   @brief copy constructor
+        ///   @brief Returns the index of the slot that contains the
+        ///     provided key. If the key is not in the table, the index of
+        ///     the empty slot that ended the search is returned, which is
+        ///     also the slot the key should be inserted into. The table
+        ///     must not be empty, and must contain at least one empty slot.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param o the object being copied
+        ///   @param key the key to search for
+        ///   @return Returns the index of the slot that contains the
+        ///     provided key, or the index of the empty slot that ended
+        ///     the search.
         ///
-        constexpr unordered_map(unordered_map const &o) noexcept
+        [[nodiscard]] constexpr auto
+        find_slot(KEY_TYPE const &key) const noexcept -> safe_umx
         {
-            if (this != &o) {
-                auto *pmut_mut_node{o.m_head};
-                while (nullptr != pmut_mut_node) {
-                    auto *pmut_mut_next{pmut_mut_node->next};
+            auto mut_idx{this->home_of(key)};
+            while (m_used[mut_idx.get()]) {
+                if (key == m_keys[mut_idx.get()]) {
+                    break;
+                }
+
+                mut_idx = this->next_of(mut_idx);
+            }
+
+            return mut_idx;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if adding one more element to the map
+        ///     would exceed the map's max load factor.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if adding one more element to the map
+        ///     would exceed the map's max load factor.
+        ///
+        [[nodiscard]] constexpr auto
+        is_full() const noexcept -> bool
+        {
+            /// NOTE:
+            /// - The size and capacity of the map are bound by the amount
+            ///   of memory that can be allocated, which means that the
+            ///   math below cannot overflow.
+            ///
+
+            auto const lhs{((m_size + safe_umx::magic_1()) * details::UNORDERED_MAP_LOAD_DEN)};
+            auto const rhs{(m_capacity * details::UNORDERED_MAP_LOAD_NUM)};
+
+            return lhs.checked() > rhs.checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Reallocates the table so that it has the provided
+        ///     number of slots, and moves all of the existing elements
+        ///     into the new table. If the allocator fails, the map is
+        ///     left unchanged and false is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param capacity the new number of slots in the table. Must
+        ///     be a power of 2.
+        ///   @return Returns true if the table was reallocated, false if
+        ///     the allocator failed.
+        ///
+        [[nodiscard]] constexpr auto
+        rehash(safe_umx const &capacity) noexcept -> bool
+        {
+            auto *const pmut_new_keys{m_alloc.template allocate<KEY_TYPE>(capacity)};
+            auto *const pmut_new_vals{m_alloc.template allocate<T>(capacity)};
+            auto *const pmut_new_used{m_alloc.template allocate<bool>(capacity)};
+
+            bool const failed{
+                (nullptr == pmut_new_keys) || (nullptr == pmut_new_vals) ||
+                (nullptr == pmut_new_used)};
+
+            if (unlikely(failed)) {
+                m_alloc.deallocate(pmut_new_keys, capacity);
+                m_alloc.deallocate(pmut_new_vals, capacity);
+                m_alloc.deallocate(pmut_new_used, capacity);
+                return false;
+            }
 
-                    this->at(pmut_mut_node->key) = pmut_mut_node->val;
-                    pmut_mut_node = pmut_mut_next;
+            auto *const pmut_old_keys{m_keys};
+            auto *const pmut_old_vals{m_vals};
+            auto *const pmut_old_used{m_used};
+            auto const old_capacity{m_capacity};
+
+            m_keys = pmut_new_keys;
+            m_vals = pmut_new_vals;
+            m_used = pmut_new_used;
+            m_capacity = capacity;
+
+            for (safe_idx mut_i{}; mut_i < old_capacity; ++mut_i) {
+                if (pmut_old_used[mut_i.get()]) {
+                    auto const idx{this->find_slot(pmut_old_keys[mut_i.get()])};
+                    m_keys[idx.get()] = bsl::move(pmut_old_keys[mut_i.get()]);
+                    m_vals[idx.get()] = bsl::move(pmut_old_vals[mut_i.get()]);
+                    m_used[idx.get()] = true;
+                }
+                else {
+                    bsl::touch();
                 }
             }
-            else {
-                bsl::touch();
+
+            m_alloc.deallocate(pmut_old_keys, old_capacity);
+            m_alloc.deallocate(pmut_old_vals, old_capacity);
+            m_alloc.deallocate(pmut_old_used, old_capacity);
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases the table, returning the map to the same
+        ///     state as a default constructed map.
+        ///
+        constexpr void
+        release() noexcept
+        {
+            m_alloc.deallocate(m_keys, m_capacity);
+            m_alloc.deallocate(m_vals, m_capacity);
+            m_alloc.deallocate(m_used, m_capacity);
+
+            m_keys = {};
+            m_vals = {};
+            m_used = {};
+            m_size = {};
+            m_capacity = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds all of the elements from the provided map to
+        ///     this map.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the map to copy the elements from
+        ///
+        constexpr void
+        copy_from(unordered_map const &o) noexcept
+        {
+            this->reserve(o.m_size);
+            for (safe_idx mut_i{}; mut_i < o.m_capacity; ++mut_i) {
+                if (o.m_used[mut_i.get()]) {
+                    bsl::discard(this->insert(o.m_keys[mut_i.get()], o.m_vals[mut_i.get()]));
+                }
+                else {
+                    bsl::touch();
+                }
             }
         }
 
+        /// <!-- description -->
+        ///   @brief Takes ownership of the table (and the allocator that
+        ///     allocated it) owned by the provided map, leaving the
+        ///     provided map empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the map to take the table from
+        ///
+        constexpr void
+        move_from(unordered_map &mut_o) noexcept
+        {
+            m_alloc = mut_o.m_alloc;
+            m_keys = mut_o.m_keys;
+            m_vals = mut_o.m_vals;
+            m_used = mut_o.m_used;
+            m_size = mut_o.m_size;
+            m_capacity = mut_o.m_capacity;
+
+            mut_o.m_keys = {};
+            mut_o.m_vals = {};
+            mut_o.m_used = {};
+            mut_o.m_size = {};
+            mut_o.m_capacity = {};
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a default constructed bsl::unordered_map. No
+        ///     memory is allocated until the first element is added, or
+        ///     reserve() is called.
+        ///
+        constexpr unordered_map() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::unordered_map that allocates its table
+        ///     using the provided allocator. No memory is allocated until
+        ///     the first element is added, or reserve() is called.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param alloc the allocator to allocate the table with
+        ///
+        explicit constexpr unordered_map(ALLOCATOR const &alloc) noexcept    // --
+            : m_alloc{alloc}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::unordered_map,
+        ///     releasing the table.
+        ///
+        constexpr ~unordered_map() noexcept
+        {
+            this->release();
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor. The new map uses the same
+        ///     allocator as o.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr unordered_map(unordered_map const &o) noexcept    // --
+            : m_alloc{o.m_alloc}
+        {
+            this->copy_from(o);
+        }
+
         /// <!-- description -->
         ///   @brief move constructor
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_o the object being moved
         ///
-        constexpr unordered_map(unordered_map &&mut_o) noexcept
+        constexpr unordered_map(unordered_map &&mut_o) noexcept    // --
+            : m_alloc{mut_o.m_alloc}
         {
-            if (this != &mut_o) {
-                m_head = mut_o.m_head;
-                m_size = mut_o.m_size;
-                mut_o.m_head = {};
-                mut_o.m_size = {};
-            }
-            else {
-                bsl::touch();
-            }
+            this->move_from(mut_o);
         }
 
         /// <!-- description -->
-        ///   @brief copy assignment
+        ///   @brief copy assignment. This map keeps its own allocator.
         ///
         /// <!-- inputs/outputs -->
         ///   @param o the object being copied
@@ -154,13 +439,8 @@ namespace bsl
         operator=(unordered_map const &o) &noexcept -> unordered_map &
         {
             if (this != &o) {
-                auto *pmut_mut_node{o.m_head};
-                while (nullptr != pmut_mut_node) {
-                    auto *pmut_mut_next{pmut_mut_node->next};
-
-                    this->at(pmut_mut_node->key) = pmut_mut_node->val;
-                    pmut_mut_node = pmut_mut_next;
-                }
+                this->clear();
+                this->copy_from(o);
             }
             else {
                 bsl::touch();
@@ -180,10 +460,8 @@ namespace bsl
         operator=(unordered_map &&mut_o) &noexcept -> unordered_map &
         {
             if (this != &mut_o) {
-                m_head = mut_o.m_head;
-                m_size = mut_o.m_size;
-                mut_o.m_head = {};
-                mut_o.m_size = {};
+                this->release();
+                this->move_from(mut_o);
             }
             else {
                 bsl::touch();
@@ -218,41 +496,130 @@ namespace bsl
         }
 
         /// <!-- description -->
-        ///   @brief Clear all entires in the map
+        ///   @brief Returns the total number of slots in the map's table.
+        ///     This is always a power of 2, or 0 if the map has not yet
+        ///     allocated a table.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of slots in the map's table.
+        ///
+        [[nodiscard]] constexpr auto
+        bucket_count() const noexcept -> safe_umx const &
+        {
+            ensures(m_capacity.is_valid_and_checked());
+            return m_capacity;
+        }
+
+        /// <!-- description -->
+        ///   @brief Ensures that the map can hold at least count elements
+        ///     without having to rehash. If the map can already hold count
+        ///     elements, this function does nothing. If the allocator
+        ///     fails, the map is left unchanged and bsl::errc_failure is
+        ///     returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param count the number of elements the map should be able
+        ///     to hold without having to rehash.
+        ///   @return Returns bsl::errc_success on success, or
+        ///     bsl::errc_failure if the allocator failed.
+        ///
+        [[nodiscard]] constexpr auto
+        try_reserve(safe_umx const &count) noexcept -> errc_type
+        {
+            expects(count.is_valid_and_checked());
+
+            if (count.is_zero()) {
+                return errc_success;
+            }
+
+            auto const capacity{details::unordered_map_capacity_for(count)};
+            if (capacity > m_capacity) {
+                if (unlikely(!this->rehash(capacity))) {
+                    return errc_failure;
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            return errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Same as try_reserve(), but for allocators that cannot
+        ///     fail (like the default bsl::heap_allocator). With an
+        ///     allocator that can fail, use try_reserve() instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param count the number of elements the map should be able
+        ///     to hold without having to rehash.
         ///
         constexpr void
-        clear() noexcept
+        reserve(safe_umx const &count) noexcept
         {
-            auto *pmut_mut_node{m_head};
-            while (nullptr != pmut_mut_node) {
-                auto *pmut_mut_next{pmut_mut_node->next};
+            bsl::discard(this->try_reserve(count));
+        }
 
-                // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-                delete pmut_mut_node;    // GRCOV_EXCLUDE_BR
-                pmut_mut_node = pmut_mut_next;
+        /// <!-- description -->
+        ///   @brief Clear all entires in the map. Note that the table
+        ///     itself is not released so that the map can be reused
+        ///     without having to allocate again.
+        ///
+        constexpr void
+        clear() noexcept
+        {
+            for (safe_idx mut_i{}; mut_i < m_capacity; ++mut_i) {
+                if (m_used[mut_i.get()]) {
+                    m_keys[mut_i.get()] = {};
+                    m_vals[mut_i.get()] = {};
+                    m_used[mut_i.get()] = false;
+                }
+                else {
+                    bsl::touch();
+                }
             }
 
-            m_head = {};
             m_size = {};
         }
 
         /// <!-- description -->
-        ///   @brief Set/get an entry in the map
+        ///   @brief Get an entry in the map, adding it if it does not
+        ///     already exist. If the key has to be added and the table has
+        ///     to grow, but the allocator fails, a nullptr is returned and
+        ///     the map is left unchanged.
         ///
         /// <!-- inputs/outputs -->
         ///   @param key the key associated with the value to get/set in the
         ///     map
-        ///   @return Returns a reference to the requested value in the map
+        ///   @return Returns a pointer to the requested value in the map,
+        ///     or a nullptr if the allocator failed.
         ///
         [[nodiscard]] constexpr auto
-        at(KEY_TYPE const &key) noexcept -> T &
+        at_if(KEY_TYPE const &key) noexcept -> T *
         {
-            auto *pmut_mut_node{m_head};
-            while (nullptr != pmut_mut_node) {
-                if (key == pmut_mut_node->key) {
-                    break;
+            if (m_capacity.is_zero()) {
+                if (unlikely(!this->rehash(details::UNORDERED_MAP_MIN_CAPACITY))) {
+                    return nullptr;
                 }
-                pmut_mut_node = pmut_mut_node->next;
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto mut_idx{this->find_slot(key)};
+            if (m_used[mut_idx.get()]) {
+                return &m_vals[mut_idx.get()];
+            }
+
+            if (this->is_full()) {
+                if (unlikely(!this->rehash((m_capacity << safe_umx::magic_1()).checked()))) {
+                    return nullptr;
+                }
+
+                mut_idx = this->find_slot(key);
+            }
+            else {
+                bsl::touch();
             }
 
             /// NOTE:
@@ -260,17 +627,59 @@ namespace bsl
             ///   so it is marked as checked. It cannot overflow.
             ///
 
-            if (nullptr == pmut_mut_node) {
-                // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-                pmut_mut_node = new nd_t{key, {}, m_head};
-                m_head = pmut_mut_node;
-                m_size = (m_size + safe_umx::magic_1()).checked();
+            m_keys[mut_idx.get()] = key;
+            m_used[mut_idx.get()] = true;
+            m_size = (m_size + safe_umx::magic_1()).checked();
+
+            return &m_vals[mut_idx.get()];
+        }
+
+        /// <!-- description -->
+        ///   @brief Set/get an entry in the map. If the key has to be
+        ///     added but the allocator fails, bsl::assert() is called and a
+        ///     reference to a (freshly reset) default value is returned,
+        ///     so anything written to it is lost. With an allocator that
+        ///     can fail, use at_if() or insert() instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key associated with the value to get/set in the
+        ///     map
+        ///   @return Returns a reference to the requested value in the map
+        ///
+        [[nodiscard]] constexpr auto
+        at(KEY_TYPE const &key) noexcept -> T &
+        {
+            auto *const pmut_val{this->at_if(key)};
+            if (unlikely(nullptr == pmut_val)) {
+                bsl::assert("unordered_map failed to allocate", bsl::here());
+                m_default = {};
+                return m_default;
             }
-            else {
-                bsl::touch();
+
+            return *pmut_val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of the provided key, adding the key to
+        ///     the map if it does not already exist.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key associated with the value to set
+        ///   @param val the value to set
+        ///   @return Returns bsl::errc_success on success, and
+        ///     bsl::errc_failure if the key does not exist and the
+        ///     allocator failed.
+        ///
+        [[nodiscard]] constexpr auto
+        insert(KEY_TYPE const &key, T const &val) noexcept -> errc_type
+        {
+            auto *const pmut_val{this->at_if(key)};
+            if (unlikely(nullptr == pmut_val)) {
+                return errc_failure;
             }
 
-            return pmut_mut_node->val;
+            *pmut_val = val;
+            return errc_success;
         }
 
         /// <!-- description -->
@@ -284,19 +693,16 @@ namespace bsl
         [[nodiscard]] constexpr auto
         at(KEY_TYPE const &key) const noexcept -> T const &
         {
-            auto *pmut_mut_node{m_head};
-            while (nullptr != pmut_mut_node) {
-                if (key == pmut_mut_node->key) {
-                    break;
-                }
-                pmut_mut_node = pmut_mut_node->next;
+            if (m_capacity.is_zero()) {
+                return m_default;
             }
 
-            if (nullptr == pmut_mut_node) {
+            auto const idx{this->find_slot(key)};
+            if (!m_used[idx.get()]) {
                 return m_default;
             }
 
-            return pmut_mut_node->val;
+            return m_vals[idx.get()];
         }
 
         /// <!-- description -->
@@ -310,36 +716,55 @@ namespace bsl
         [[nodiscard]] constexpr auto
         erase(KEY_TYPE const &key) noexcept -> bool
         {
-            auto *pmut_mut_node{m_head};
-            nd_t *pmut_mut_prev{};
-            while (nullptr != pmut_mut_node) {
-                if (key == pmut_mut_node->key) {
-                    break;
-                }
-                pmut_mut_prev = pmut_mut_node;
-                pmut_mut_node = pmut_mut_node->next;
+            if (m_capacity.is_zero()) {
+                return false;
             }
 
-            if (nullptr == pmut_mut_node) {
+            auto mut_hole{this->find_slot(key)};
+            if (!m_used[mut_hole.get()]) {
                 return false;
             }
 
-            if (nullptr == pmut_mut_prev) {
-                m_head = pmut_mut_node->next;
-            }
-            else {
-                pmut_mut_prev->next = pmut_mut_node->next;
+            /// NOTE:
+            /// - Backward shift deletion. Every element that follows the
+            ///   hole in the same cluster is moved into the hole, unless
+            ///   doing so would move the element in front of its home
+            ///   slot (in which case a lookup would no longer find it).
+            /// - All of the distance math below is done modulo the
+            ///   capacity, and adding the capacity first ensures that
+            ///   the subtraction cannot underflow, so it is marked as
+            ///   checked.
+            ///
+
+            auto const mask{(m_capacity - safe_umx::magic_1()).checked()};
+            auto mut_idx{this->next_of(mut_hole)};
+            while (m_used[mut_idx.get()]) {
+                auto const home{this->home_of(m_keys[mut_idx.get()])};
+                auto const dist_home{(((mut_idx + m_capacity) - home) & mask).checked()};
+                auto const dist_hole{(((mut_idx + m_capacity) - mut_hole) & mask).checked()};
+
+                if (dist_home >= dist_hole) {
+                    m_keys[mut_hole.get()] = bsl::move(m_keys[mut_idx.get()]);
+                    m_vals[mut_hole.get()] = bsl::move(m_vals[mut_idx.get()]);
+                    mut_hole = mut_idx;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                mut_idx = this->next_of(mut_idx);
             }
 
+            m_keys[mut_hole.get()] = {};
+            m_vals[mut_hole.get()] = {};
+            m_used[mut_hole.get()] = false;
+
             /// NOTE:
             /// - The m_size math below is really acting as an index
             ///   so it is marked as checked. It cannot underflow.
             ///
 
             m_size = (m_size - safe_umx::magic_1()).checked();
-
-            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-            delete pmut_mut_node;    // GRCOV_EXCLUDE_BR
             return true;
         }
 
@@ -355,15 +780,11 @@ namespace bsl
         [[nodiscard]] constexpr auto
         contains(KEY_TYPE const &key) const noexcept -> bool
         {
-            auto *pmut_mut_node{m_head};
-            while (nullptr != pmut_mut_node) {
-                if (key == pmut_mut_node->key) {
-                    return true;
-                }
-                pmut_mut_node = pmut_mut_node->next;
+            if (m_capacity.is_zero()) {
+                return false;
             }
 
-            return false;
+            return m_used[this->find_slot(key).get()];
         }
     };
 }
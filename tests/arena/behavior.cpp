@@ -0,0 +1,328 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/arena.hpp>
+#include <bsl/array.hpp>
+#include <bsl/as_const.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/hash.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/unordered_map.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of the buffers used by the tests
+    constexpr bsl::uintmx TEST_SIZE{static_cast<bsl::uintmx>(1024)};
+    /// @brief defines the alignment of the buffers used by the tests
+    constexpr bsl::uintmx TEST_ALIGN{static_cast<bsl::uintmx>(16)};
+
+    /// @brief stores the number of test_elem objects that are alive
+    constinit bsl::safe_i32 g_mut_alive{};
+
+    /// @class test_elem
+    ///
+    /// <!-- description -->
+    ///   @brief A non-trivial element type that keeps track of how many
+    ///     of it are alive.
+    ///
+    class test_elem final
+    {
+        /// @brief stores the value of this element
+        bsl::safe_i32 m_val{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a test_elem
+        ///
+        test_elem() noexcept
+        {
+            g_mut_alive = (g_mut_alive + bsl::safe_i32::magic_1()).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroys a test_elem
+        ///
+        ~test_elem() noexcept
+        {
+            g_mut_alive = (g_mut_alive - bsl::safe_i32::magic_1()).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        test_elem(test_elem const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        test_elem(test_elem &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(test_elem const &o) &noexcept -> test_elem & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(test_elem &&mut_o) &noexcept -> test_elem & = delete;
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns the provided pointer as an integer
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ptr the pointer to convert
+    ///   @return Returns the provided pointer as an integer
+    ///
+    [[nodiscard]] auto
+    addr_of(void const *const ptr) noexcept -> bsl::safe_umx
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return bsl::safe_umx{reinterpret_cast<bsl::uintmx>(ptr)};
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"empty arena"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            alignas(TEST_ALIGN) bsl::array<bsl::uint8, TEST_SIZE> mut_buf{};
+            bsl::span<bsl::uint8> mut_view{mut_buf};
+            bsl::arena const arena{mut_view};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(TEST_SIZE == arena.capacity());
+                bsl::ut_check(arena.used().is_zero());
+                bsl::ut_check(TEST_SIZE == arena.remaining());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"allocate_bytes bumps and aligns"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            alignas(TEST_ALIGN) bsl::array<bsl::uint8, TEST_SIZE> mut_buf{};
+            bsl::span<bsl::uint8> mut_view{mut_buf};
+            bsl::arena mut_arena{mut_view};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const *const ptr1{mut_arena.allocate_bytes(1_umx, 1_umx)};
+                auto const *const ptr2{mut_arena.allocate_bytes(8_umx, 8_umx)};
+                auto const *const ptr3{mut_arena.allocate_bytes(3_umx, 1_umx)};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(addr_of(mut_buf.data()) == addr_of(ptr1));
+                    bsl::ut_check((addr_of(ptr2) & 7_umx).checked().is_zero());
+                    bsl::ut_check((addr_of(ptr1) + 8_umx).checked() == addr_of(ptr2));
+                    bsl::ut_check((addr_of(ptr2) + 8_umx).checked() == addr_of(ptr3));
+                    bsl::ut_check(19_umx == mut_arena.used());
+                    bsl::ut_check((TEST_SIZE - 19_umx).checked() == mut_arena.remaining());
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"out of room"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            alignas(TEST_ALIGN) bsl::array<bsl::uint8, TEST_SIZE> mut_buf{};
+            bsl::span<bsl::uint8> mut_view{mut_buf};
+            bsl::arena mut_arena{mut_view};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::discard(mut_arena.allocate_bytes(1_umx, 1_umx));
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const size{(TEST_SIZE - 1_umx).checked()};
+                    auto const align{bsl::safe_umx{TEST_ALIGN}};
+                    bsl::ut_check(nullptr == mut_arena.allocate_bytes(size, align));
+                    bsl::ut_check(1_umx == mut_arena.used());
+                    bsl::ut_check(nullptr == mut_arena.allocate<bsl::uint64>(size));
+
+                    auto const max{bsl::safe_umx::max_value()};
+                    bsl::ut_check(nullptr == mut_arena.allocate<bsl::uint64>(max));
+                    bsl::ut_check(1_umx == mut_arena.used());
+                    bsl::ut_check(nullptr != mut_arena.allocate_bytes(size, 1_umx));
+                    bsl::ut_check(mut_arena.remaining().is_zero());
+                    bsl::ut_check(nullptr == mut_arena.allocate_bytes(1_umx, 1_umx));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"allocate value initializes"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            alignas(TEST_ALIGN) bsl::array<bsl::uint8, TEST_SIZE> mut_buf{};
+            bsl::span<bsl::uint8> mut_view{mut_buf};
+            bsl::arena mut_arena{mut_view};
+            bsl::ut_when{} = [&]() noexcept {
+                for (auto &mut_elem : mut_buf) {
+                    mut_elem = static_cast<bsl::uint8>(0xFF);
+                }
+
+                auto const *const arr{mut_arena.allocate<bsl::uint64>(4_umx)};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(nullptr != arr);
+                    bsl::ut_check(32_umx == mut_arena.used());
+                    for (bsl::safe_idx mut_i{}; mut_i < 4_umx; ++mut_i) {
+                        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                        bsl::ut_check(static_cast<bsl::uint64>(0) == arr[mut_i.get()]);
+                    }
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"deallocate destroys"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            alignas(TEST_ALIGN) bsl::array<bsl::uint8, TEST_SIZE> mut_buf{};
+            bsl::span<bsl::uint8> mut_view{mut_buf};
+            bsl::arena mut_arena{mut_view};
+            bsl::ut_when{} = [&]() noexcept {
+                auto *const pmut_arr{mut_arena.allocate<test_elem>(3_umx)};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(3_i32 == g_mut_alive);
+                    mut_arena.deallocate(pmut_arr, 3_umx);
+                    bsl::ut_check(g_mut_alive.is_zero());
+                    bsl::ut_check(mut_arena.used().is_pos());
+                    mut_arena.deallocate<test_elem>(nullptr, 3_umx);
+                    bsl::ut_check(g_mut_alive.is_zero());
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"reset"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            alignas(TEST_ALIGN) bsl::array<bsl::uint8, TEST_SIZE> mut_buf{};
+            bsl::span<bsl::uint8> mut_view{mut_buf};
+            bsl::arena mut_arena{mut_view};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const *const ptr1{mut_arena.allocate<bsl::uint32>(8_umx)};
+                mut_arena.reset();
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_arena.used().is_zero());
+                    bsl::ut_check(TEST_SIZE == mut_arena.remaining());
+                    bsl::ut_check(ptr1 == mut_arena.allocate<bsl::uint32>(8_umx));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"unordered_map with an arena_allocator"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            alignas(TEST_ALIGN) bsl::array<bsl::uint8, TEST_SIZE> mut_buf{};
+            bsl::span<bsl::uint8> mut_view{mut_buf};
+            bsl::arena mut_arena{mut_view};
+            bsl::ut_when{} = [&]() noexcept {
+                {
+                    bsl::unordered_map<
+                        bsl::uintmx,
+                        bsl::uintmx,
+                        bsl::hash<bsl::uintmx>,
+                        bsl::arena_allocator>
+                        mut_map{bsl::arena_allocator{mut_arena}};
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_map.try_reserve(16_umx));
+                        auto const used{mut_arena.used()};
+                        bsl::ut_check(used.is_pos());
+                        for (bsl::safe_idx mut_i{}; mut_i < 16_umx; ++mut_i) {
+                            bsl::ut_check(mut_map.insert(mut_i.get(), mut_i.get()));
+                        }
+
+                        bsl::ut_check(used == mut_arena.used());
+                        bsl::ut_check(16_umx == mut_map.size());
+                        bsl::ut_check(!mut_map.try_reserve(bsl::safe_umx{TEST_SIZE}));
+                        bsl::ut_check(16_umx == mut_map.size());
+
+                        auto const key{static_cast<bsl::uintmx>(7)};
+                        bsl::ut_check(key == bsl::as_const(mut_map).at(key));
+                    };
+                }
+
+                mut_arena.reset();
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_arena.used().is_zero());
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"unordered_map out of arena"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            alignas(TEST_ALIGN) bsl::array<bsl::uint8, TEST_SIZE> mut_buf{};
+            bsl::span<bsl::uint8> mut_view{mut_buf};
+            bsl::arena mut_arena{mut_view};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::unordered_map<
+                    bsl::uintmx,
+                    bsl::uintmx,
+                    bsl::hash<bsl::uintmx>,
+                    bsl::arena_allocator>
+                    mut_map{bsl::arena_allocator{mut_arena}};
+
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::safe_umx mut_added{};
+                    for (bsl::safe_idx mut_i{}; mut_i < TEST_SIZE; ++mut_i) {
+                        if (!mut_map.insert(mut_i.get(), mut_i.get())) {
+                            break;
+                        }
+
+                        mut_added = (mut_added + 1_umx).checked();
+                    }
+
+                    bsl::ut_check(mut_added.is_pos());
+                    bsl::ut_check(mut_added == mut_map.size());
+                    bsl::ut_check(nullptr == mut_map.at_if(TEST_SIZE));
+                    bsl::ut_check(mut_added == mut_map.size());
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
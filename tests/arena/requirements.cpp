@@ -0,0 +1,78 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/arena.hpp>
+#include <bsl/array.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of the buffer used by the tests
+    constexpr bsl::uintmx TEST_SIZE{static_cast<bsl::uintmx>(64)};
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::array<bsl::uint8, TEST_SIZE> mut_buf{};
+            bsl::span<bsl::uint8> mut_view{mut_buf};
+            bsl::arena mut_arena{mut_view};
+            bsl::arena const arena{mut_view};
+            bsl::arena_allocator const alloc{mut_arena};
+            bsl::ut_then{} = []() noexcept {
+                static_assert(noexcept(bsl::arena{mut_view}));
+                static_assert(noexcept(bsl::arena_allocator{mut_arena}));
+
+                static_assert(noexcept(mut_arena.allocate_bytes({}, {})));
+                static_assert(noexcept(mut_arena.allocate<bool>({})));
+                static_assert(noexcept(mut_arena.deallocate<bool>({}, {})));
+                static_assert(noexcept(mut_arena.reset()));
+                static_assert(noexcept(mut_arena.capacity()));
+                static_assert(noexcept(mut_arena.used()));
+                static_assert(noexcept(mut_arena.remaining()));
+
+                static_assert(noexcept(arena.capacity()));
+                static_assert(noexcept(arena.used()));
+                static_assert(noexcept(arena.remaining()));
+
+                static_assert(noexcept(alloc.allocate<bool>({})));
+                static_assert(noexcept(alloc.deallocate<bool>({}, {})));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,149 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/atomic.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/memory_order.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"load and store"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::atomic<bsl::uint32> mut_atomic{};
+            bsl::atomic<bsl::int64> mut_signed{-42_i64};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(0_u32 == mut_atomic.load());
+                bsl::ut_check(-42_i64 == mut_signed.load());
+
+                mut_atomic.store(23_u32);
+                bsl::ut_check(23_u32 == mut_atomic.load());
+                mut_atomic.store(42_u32, bsl::memory_order::memory_order_release);
+                bsl::ut_check(42_u32 == mut_atomic.load(bsl::memory_order::memory_order_acquire));
+                mut_atomic.store(43_u32, bsl::memory_order::memory_order_relaxed);
+                bsl::ut_check(43_u32 == mut_atomic.load(bsl::memory_order::memory_order_relaxed));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"exchange and compare_exchange"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::atomic<bsl::uint32> mut_atomic{42_u32};
+            bsl::safe_u32 mut_expected{23_u32};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(!mut_atomic.compare_exchange(mut_expected, 1_u32));
+                bsl::ut_check(42_u32 == mut_expected);
+                bsl::ut_check(42_u32 == mut_atomic.load());
+
+                bsl::ut_check(mut_atomic.compare_exchange(
+                    mut_expected, 1_u32, bsl::memory_order::memory_order_acq_rel));
+                bsl::ut_check(42_u32 == mut_expected);
+                bsl::ut_check(1_u32 == mut_atomic.load());
+
+                while (!mut_atomic.compare_exchange_weak(
+                    mut_expected, 2_u32, bsl::memory_order::memory_order_release)) {
+                    bsl::ut_check(1_u32 == mut_expected);
+                }
+                bsl::ut_check(2_u32 == mut_atomic.load());
+
+                bsl::ut_check(2_u32 == mut_atomic.exchange(3_u32));
+                bsl::ut_check(3_u32 == mut_atomic.load());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"checked fetch_add and fetch_sub"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::atomic<bsl::uint8> mut_atomic{250_u8};
+            bsl::atomic<bsl::int8> mut_signed{-120_i8};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(250_u8 == mut_atomic.fetch_add(5_u8));
+                bsl::ut_check(255_u8 == mut_atomic.load());
+                bsl::ut_check(mut_atomic.fetch_add(1_u8).is_poisoned());
+                bsl::ut_check(255_u8 == mut_atomic.load());
+
+                bsl::ut_check(255_u8 == mut_atomic.fetch_sub(255_u8));
+                bsl::ut_check(0_u8 == mut_atomic.load());
+                bsl::ut_check(mut_atomic.fetch_sub(1_u8).is_poisoned());
+                bsl::ut_check(0_u8 == mut_atomic.load());
+
+                bsl::ut_check(-120_i8 == mut_signed.fetch_sub(8_i8));
+                bsl::ut_check(mut_signed.fetch_sub(1_i8).is_poisoned());
+                bsl::ut_check(bsl::safe_i8::min_value() == mut_signed.load());
+                bsl::ut_check(mut_signed.fetch_add(-1_i8).is_poisoned());
+                bsl::ut_check(bsl::safe_i8::min_value() == mut_signed.fetch_add(1_i8));
+                bsl::ut_check(-127_i8 == mut_signed.load());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"wrapping and saturating fetch_add and fetch_sub"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::atomic<bsl::uint8> mut_atomic{250_u8};
+            bsl::atomic<bsl::int8> mut_signed{-120_i8};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(250_u8 == mut_atomic.fetch_sat_add(10_u8));
+                bsl::ut_check(255_u8 == mut_atomic.load());
+                bsl::ut_check(255_u8 == mut_atomic.fetch_wrap_add(2_u8));
+                bsl::ut_check(1_u8 == mut_atomic.load());
+                bsl::ut_check(1_u8 == mut_atomic.fetch_wrap_sub(2_u8));
+                bsl::ut_check(255_u8 == mut_atomic.load());
+                bsl::ut_check(255_u8 == mut_atomic.fetch_sat_sub(10_u8));
+                bsl::ut_check(245_u8 == mut_atomic.fetch_sat_sub(250_u8));
+                bsl::ut_check(0_u8 == mut_atomic.load());
+
+                bsl::ut_check(-120_i8 == mut_signed.fetch_sat_sub(100_i8));
+                bsl::ut_check(bsl::safe_i8::min_value() == mut_signed.load());
+                bsl::ut_check(bsl::safe_i8::min_value() == mut_signed.fetch_wrap_sub(1_i8));
+                bsl::ut_check(127_i8 == mut_signed.load());
+                bsl::ut_check(127_i8 == mut_signed.fetch_sat_add(1_i8));
+                bsl::ut_check(127_i8 == mut_signed.load());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"bitwise operations"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::atomic<bsl::uint64> mut_atomic{0xF0_u64};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(0xF0_u64 == mut_atomic.fetch_or(0x0F_u64));
+                bsl::ut_check(0xFF_u64 == mut_atomic.fetch_and(0x3C_u64));
+                bsl::ut_check(0x3C_u64 == mut_atomic.fetch_xor(0xFF_u64));
+                bsl::ut_check(0xC3_u64 == mut_atomic.load());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,145 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <pthread.h>
+
+#include <bsl/array.hpp>
+#include <bsl/atomic.hpp>
+#include <bsl/atomic_wait.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/memory_order.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+/// NOTE:
+/// - THREADS threads hammer the same atomics at the same time:
+///   - Each one adds 1 to g_mut_count PER_THREAD times, so nothing may
+///     be lost.
+///   - Each one also tries to add 1 to g_mut_small PER_THREAD times. It
+///     can only hold 255, so exactly 255 adds must succeed and every
+///     other add must be poisoned, no matter how they interleave.
+///   - Finally, each thread waits for its turn on g_mut_turn, which is
+///     handed from one thread to the next using atomic_wait() and
+///     atomic_notify_all().
+///
+
+namespace
+{
+    /// @brief defines the total number of threads
+    constexpr bsl::uintmx NUM_THREADS{static_cast<bsl::uintmx>(4)};
+    /// @brief defines the total number of threads as a safe_u32
+    constexpr auto THREADS{bsl::to_u32(NUM_THREADS)};
+    /// @brief defines the total number of adds each thread performs
+    constexpr auto PER_THREAD{250000_u64};
+    /// @brief defines the total number of times the turn goes around
+    constexpr auto ROUNDS{1000_u32};
+
+    /// @brief stores the counter that every thread adds to
+    constinit bsl::atomic<bsl::uint64> g_mut_count{};
+    /// @brief stores the counter that overflows
+    constinit bsl::atomic<bsl::uint8> g_mut_small{};
+    /// @brief stores the total number of poisoned adds to g_mut_small
+    constinit bsl::atomic<bsl::uint64> g_mut_poisoned{};
+    /// @brief stores whose turn it is
+    constinit bsl::atomic<bsl::uint32> g_mut_turn{};
+
+    /// <!-- description -->
+    ///   @brief Runs the adds and then takes ROUNDS turns.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_arg the id of this thread
+    ///   @return Always returns a nullptr
+    ///
+    [[nodiscard]] auto
+    worker(void *const pmut_arg) noexcept -> void *
+    {
+        auto const *const id{static_cast<bsl::safe_u32 const *>(pmut_arg)};
+
+        for (bsl::safe_u64 mut_i{}; mut_i < PER_THREAD; mut_i = (mut_i + 1_u64).checked()) {
+            constexpr auto relaxed{bsl::memory_order::memory_order_relaxed};
+
+            bsl::discard(g_mut_count.fetch_add(1_u64, relaxed));
+            if (g_mut_small.fetch_add(1_u8, relaxed).is_poisoned()) {
+                bsl::discard(g_mut_poisoned.fetch_add(1_u64));
+            }
+        }
+
+        for (bsl::safe_u32 mut_i{}; mut_i < ROUNDS; mut_i = (mut_i + 1_u32).checked()) {
+            auto const mine{((mut_i * THREADS) + *id).checked()};
+            for (auto mut_turn{g_mut_turn.load()}; mut_turn != mine; mut_turn = g_mut_turn.load()) {
+                bsl::atomic_wait(g_mut_turn, mut_turn);
+            }
+
+            g_mut_turn.store((mine + 1_u32).checked());
+            bsl::atomic_notify_all(g_mut_turn);
+        }
+
+        return nullptr;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"many threads sharing atomics"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::array<pthread_t, NUM_THREADS> mut_threads{};
+            bsl::array<bsl::safe_u32, NUM_THREADS> mut_ids{};
+            bsl::ut_when{} = [&]() noexcept {
+                for (bsl::safe_idx mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+                    *mut_ids.at_if(mut_i) = bsl::to_u32(mut_i.get());
+                    auto *const pmut_id{mut_ids.at_if(mut_i)};
+
+                    auto *const pmut_t{mut_threads.at_if(mut_i)};
+                    bsl::ut_check(0 == pthread_create(pmut_t, nullptr, &worker, pmut_id));
+                }
+
+                bsl::ut_then{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+                        bsl::ut_check(0 == pthread_join(*mut_threads.at_if(mut_i), nullptr));
+                    }
+
+                    auto const total{(PER_THREAD * bsl::to_u64(THREADS)).checked()};
+                    bsl::ut_check(total == g_mut_count.load());
+                    bsl::ut_check(255_u8 == g_mut_small.load());
+                    bsl::ut_check((total - 255_u64).checked() == g_mut_poisoned.load());
+                    bsl::ut_check((ROUNDS * THREADS).checked() == g_mut_turn.load());
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
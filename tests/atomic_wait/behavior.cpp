@@ -0,0 +1,62 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/atomic.hpp>
+#include <bsl/atomic_wait.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/memory_order.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"atomic_wait returns if the value already changed"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::atomic<bsl::uint32> mut_atomic{1_u32};
+            bsl::atomic<bsl::uint64> mut_atomic64{1_u64};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::atomic_wait(mut_atomic, 0_u32);
+                bsl::atomic_wait(mut_atomic, 0_u32, bsl::memory_order::memory_order_acquire);
+                bsl::atomic_notify_one(mut_atomic);
+                bsl::atomic_notify_all(mut_atomic);
+                bsl::atomic_wait(mut_atomic64, 0_u64);
+                bsl::atomic_notify_one(mut_atomic64);
+                bsl::atomic_notify_all(mut_atomic64);
+                bsl::ut_check(1_u32 == mut_atomic.load());
+                bsl::ut_check(1_u64 == mut_atomic64.load());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,264 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/basic_string_view.hpp>
+#include <bsl/char_type.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"find_first_of"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_of("lo") == bsl::npos);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_of("") == bsl::npos);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_of("42") == bsl::npos);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_of("ol") == bsl::to_umx(2));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_of("ol", bsl::to_idx(5)) == bsl::to_umx(7));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_of("dW") == bsl::to_umx(6));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_of("ol", bsl::npos) == bsl::npos);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_of('o') == bsl::to_umx(4));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_of('o', bsl::to_idx(5)) == bsl::to_umx(7));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"find_last_of"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_last_of("lo") == bsl::npos);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_last_of("") == bsl::npos);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_last_of("42") == bsl::npos);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_last_of("ol") == bsl::to_umx(9));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_last_of("ol", bsl::to_idx(8)) == bsl::to_umx(7));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_last_of("He") == bsl::to_umx(1));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_last_of("ol", bsl::to_idx(1)) == bsl::npos);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_last_of('o') == bsl::to_umx(7));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_last_of('o', bsl::to_idx(6)) == bsl::to_umx(4));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"find_first_not_of"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_not_of("lo") == bsl::npos);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_not_of("") == bsl::to_umx(0));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_not_of("", bsl::to_idx(3)) == bsl::to_umx(3));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_not_of("Hel") == bsl::to_umx(4));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_not_of("Helo Wrd") == bsl::npos);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_not_of("lo", bsl::to_idx(2)) == bsl::to_umx(5));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_not_of("Hel", bsl::npos) == bsl::npos);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_not_of('H') == bsl::to_umx(1));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"aaa"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_not_of('a') == bsl::npos);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::basic_string_view<bsl::char_type> const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(msg.find_first_not_of('l', bsl::to_idx(2)) == bsl::to_umx(4));
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
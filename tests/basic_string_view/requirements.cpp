@@ -93,6 +93,18 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_msg1.find(bsv_type{})));
                 static_assert(noexcept(mut_msg1.find('H')));
                 static_assert(noexcept(mut_msg1.find("")));
+                static_assert(noexcept(mut_msg1.rfind(bsv_type{})));
+                static_assert(noexcept(mut_msg1.rfind('H')));
+                static_assert(noexcept(mut_msg1.rfind("")));
+                static_assert(noexcept(mut_msg1.find_first_of(bsv_type{})));
+                static_assert(noexcept(mut_msg1.find_first_of('H')));
+                static_assert(noexcept(mut_msg1.find_first_of("")));
+                static_assert(noexcept(mut_msg1.find_last_of(bsv_type{})));
+                static_assert(noexcept(mut_msg1.find_last_of('H')));
+                static_assert(noexcept(mut_msg1.find_last_of("")));
+                static_assert(noexcept(mut_msg1.find_first_not_of(bsv_type{})));
+                static_assert(noexcept(mut_msg1.find_first_not_of('H')));
+                static_assert(noexcept(mut_msg1.find_first_not_of("")));
                 static_assert(noexcept(mut_msg1 == mut_msg2));
                 static_assert(noexcept(mut_msg1 == ""));
                 static_assert(noexcept("" == mut_msg2));
@@ -130,6 +142,18 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(msg1.find(bsv_type{})));
                 static_assert(noexcept(msg1.find('H')));
                 static_assert(noexcept(msg1.find("")));
+                static_assert(noexcept(msg1.rfind(bsv_type{})));
+                static_assert(noexcept(msg1.rfind('H')));
+                static_assert(noexcept(msg1.rfind("")));
+                static_assert(noexcept(msg1.find_first_of(bsv_type{})));
+                static_assert(noexcept(msg1.find_first_of('H')));
+                static_assert(noexcept(msg1.find_first_of("")));
+                static_assert(noexcept(msg1.find_last_of(bsv_type{})));
+                static_assert(noexcept(msg1.find_last_of('H')));
+                static_assert(noexcept(msg1.find_last_of("")));
+                static_assert(noexcept(msg1.find_first_not_of(bsv_type{})));
+                static_assert(noexcept(msg1.find_first_not_of('H')));
+                static_assert(noexcept(msg1.find_first_not_of("")));
                 static_assert(noexcept(msg1 == msg2));
                 static_assert(noexcept(msg1 == ""));
                 static_assert(noexcept("" == msg2));
@@ -0,0 +1,134 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+#include <bsl/array.hpp>
+#include <bsl/bench.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the number of samples used by the tests
+    constexpr bsl::uintmx NUM_SAMPLES{static_cast<bsl::uintmx>(101)};
+    /// @brief defines the number of repetitions used by the tests
+    constexpr bsl::uintmx NUM_REPS{static_cast<bsl::uintmx>(5)};
+    /// @brief defines the number of warmup repetitions used by the tests
+    constexpr bsl::uintmx NUM_WARMUP{static_cast<bsl::uintmx>(3)};
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"summarize a single sample"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array mut_samples{42_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto const res{bsl::details::bench_summarize(mut_samples, 1_umx)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(42000_u64 == res.min);
+                        bsl::ut_check(42000_u64 == res.median);
+                        bsl::ut_check(42000_u64 == res.p99);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"summarize samples in reverse order"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::safe_u64, NUM_SAMPLES> mut_samples{};
+                bsl::safe_u64 mut_val{bsl::to_u64(NUM_SAMPLES)};
+                for (auto &mut_sample : mut_samples) {
+                    mut_sample = mut_val.checked();
+                    --mut_val;
+                }
+                bsl::ut_when{} = [&]() noexcept {
+                    auto const res{bsl::details::bench_summarize(mut_samples, 10_umx)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(1_u64 == mut_samples.front());
+                        bsl::ut_check(100_u64 == res.min);
+                        bsl::ut_check(5100_u64 == res.median);
+                        bsl::ut_check(10000_u64 == res.p99);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"summarize samples with an outlier"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array mut_samples{7_u64, 5_u64, 900_u64, 6_u64, 5_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto const res{bsl::details::bench_summarize(mut_samples, 1000_umx)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(5_u64 == res.min);
+                        bsl::ut_check(6_u64 == res.median);
+                        bsl::ut_check(900_u64 == res.p99);
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"bench runs warmup and measured repetitions"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::uintmx mut_calls{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const res{bsl::bench<NUM_REPS, NUM_WARMUP>("test", 1_umx, [&]() noexcept {
+                    ++mut_calls;
+                    bsl::bench_keep(mut_calls);
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check((NUM_REPS + NUM_WARMUP) == mut_calls);
+                    bsl::ut_check(res.min <= res.median);
+                    bsl::ut_check(res.median <= res.p99);
+                };
+            };
+        };
+    };
+
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
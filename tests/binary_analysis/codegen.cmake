@@ -0,0 +1,185 @@
+#
+# Copyright (C) 2020 Assured Information Security, Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+# Codegen Check
+#
+# Disassembles the kernels in codegen.cpp, and the main() of each of the
+# other binary analysis programs, and makes sure that none of them has
+# more instructions, branches or calls than codegen_baseline.txt allows.
+# This is run as a script (cmake -P) after all of them are compiled.
+#
+# BF_OBJDUMP: The objdump (or llvm-objdump) to disassemble with
+# BINARIES: A comma separated list of the compiled binaries to disassemble
+# BASELINE: The file that stores the limits for each kernel
+# UPDATE: If true, the limits in BASELINE are replaced with the counts
+#   that were measured instead of being checked
+#
+
+string(REPLACE "," ";" BINARIES "${BINARIES}")
+
+foreach(BINARY IN LISTS BINARIES)
+    execute_process(
+        COMMAND ${BF_OBJDUMP} --disassemble --demangle --no-show-raw-insn ${BINARY}
+        OUTPUT_VARIABLE DISASM
+        RESULT_VARIABLE DISASM_RESULT
+    )
+
+    if(NOT DISASM_RESULT EQUAL 0)
+        message(FATAL_ERROR "unable to disassemble: ${BINARY}")
+    endif()
+
+    # NOTE:
+    # - The main() of each program is named after the program, without
+    #   its "binary_analysis_" prefix (e.g., safe_integral_main).
+    #
+
+    get_filename_component(PROGRAM ${BINARY} NAME_WE)
+    string(REGEX REPLACE "^(lib)?binary_analysis_" "" PROGRAM ${PROGRAM})
+
+    # NOTE:
+    # - Brackets and semicolons are replaced so that each line of the
+    #   disassembly is exactly one element of the list.
+    #
+
+    string(REPLACE ";" "," DISASM "${DISASM}")
+    string(REPLACE "[" "(" DISASM "${DISASM}")
+    string(REPLACE "]" ")" DISASM "${DISASM}")
+    string(REPLACE "\n" ";" DISASM "${DISASM}")
+
+    set(KERNEL "")
+    foreach(LINE IN LISTS DISASM)
+        if(LINE MATCHES "^[0-9a-fA-F]+ <.*(clone|\\.cold)")
+            set(KERNEL "")
+        elseif(LINE MATCHES "^[0-9a-fA-F]+ <codegen::([a-z0-9_]+)\\(")
+            set(KERNEL ${CMAKE_MATCH_1})
+        elseif(LINE MATCHES "^[0-9a-fA-F]+ <main>:")
+            set(KERNEL ${PROGRAM}_main)
+        elseif(LINE MATCHES "^[0-9a-fA-F]+ <")
+            set(KERNEL "")
+        elseif(KERNEL AND LINE MATCHES "^ *[0-9a-fA-F]+:[ \t]+([a-z][a-z0-9.]*)")
+            set(MNEMONIC ${CMAKE_MATCH_1})
+
+            # NOTE:
+            # - Padding between functions is not part of the kernel.
+            #
+
+            if(MNEMONIC MATCHES "^(nop.*|int3|cs|ds|data16)$")
+                continue()
+            endif()
+
+            if(NOT DEFINED ${KERNEL}_INSTRUCTIONS)
+                set(${KERNEL}_INSTRUCTIONS 0)
+                set(${KERNEL}_BRANCHES 0)
+                set(${KERNEL}_CALLS 0)
+            endif()
+
+            math(EXPR ${KERNEL}_INSTRUCTIONS "${${KERNEL}_INSTRUCTIONS} + 1")
+            if(MNEMONIC MATCHES "^(call.*|bl|blr)$")
+                math(EXPR ${KERNEL}_CALLS "${${KERNEL}_CALLS} + 1")
+            elseif(MNEMONIC MATCHES "^(j.*|b|b\\..*|cbn?z|tbn?z)$")
+                math(EXPR ${KERNEL}_BRANCHES "${${KERNEL}_BRANCHES} + 1")
+            endif()
+        endif()
+    endforeach()
+endforeach()
+
+# NOTE:
+# - Each line of the baseline is:
+#   <kernel> <reference> <instructions> <branches> <calls>
+# - If the reference is "-", the limits are the totals allowed for the
+#   kernel. Otherwise, the limits are how many more the kernel is allowed
+#   to have than the reference kernel.
+# - When updating, each row keeps its kernel and reference, and only its
+#   limits are replaced (each padded to the width of a column).
+#
+
+file(STRINGS ${BASELINE} ROWS REGEX "^[a-z]")
+file(READ ${BASELINE} UPDATED_BASELINE)
+
+set(FAILED FALSE)
+foreach(ROW IN LISTS ROWS)
+    string(REGEX REPLACE "[ \t]+" ";" FIELDS "${ROW}")
+    list(GET FIELDS 0 NAME)
+    list(GET FIELDS 1 REF)
+
+    if(NOT DEFINED ${NAME}_INSTRUCTIONS)
+        message(FATAL_ERROR "codegen kernel not found: ${NAME}")
+    endif()
+
+    set(INDEX 2)
+    set(RESULTS "")
+    set(COUNTS "")
+    foreach(KIND INSTRUCTIONS BRANCHES CALLS)
+        list(GET FIELDS ${INDEX} LIMIT)
+        math(EXPR INDEX "${INDEX} + 1")
+
+        set(COUNT ${${NAME}_${KIND}})
+        if(NOT REF STREQUAL "-")
+            if(NOT DEFINED ${REF}_${KIND})
+                message(FATAL_ERROR "codegen kernel not found: ${REF}")
+            endif()
+            math(EXPR COUNT "${COUNT} - ${${REF}_${KIND}}")
+        endif()
+
+        string(TOLOWER ${KIND} KIND_NAME)
+        string(APPEND RESULTS " ${KIND_NAME}=${COUNT}/${LIMIT}")
+        list(APPEND COUNTS ${COUNT})
+
+        if(UPDATE)
+            continue()
+        endif()
+
+        if(COUNT GREATER LIMIT)
+            set(FAILED TRUE)
+            message(SEND_ERROR "codegen kernel ${NAME} has too many ${KIND_NAME}: ${COUNT} > ${LIMIT}")
+        endif()
+    endforeach()
+
+    message(STATUS "codegen name=${NAME} reference=${REF}${RESULTS}")
+
+    set(LIMITS "")
+    foreach(COUNT IN LISTS COUNTS)
+        set(COLUMN ${COUNT})
+        string(LENGTH ${COLUMN} LENGTH)
+        while(LENGTH LESS 8)
+            string(APPEND COLUMN " ")
+            math(EXPR LENGTH "${LENGTH} + 1")
+        endwhile()
+        string(APPEND LIMITS "${COLUMN}")
+    endforeach()
+
+    string(STRIP "${LIMITS}" LIMITS)
+    string(REGEX REPLACE
+        "(^|\n)(${NAME}[ \t]+[^ \t\n]+[ \t]+)[^\n]*"
+        "\\1\\2${LIMITS}"
+        UPDATED_BASELINE "${UPDATED_BASELINE}"
+    )
+endforeach()
+
+if(UPDATE)
+    file(WRITE ${BASELINE} "${UPDATED_BASELINE}")
+    message(STATUS "codegen baseline updated: ${BASELINE}")
+    return()
+endif()
+
+if(FAILED)
+    message(FATAL_ERROR "codegen regression detected (see ${BASELINE})")
+endif()
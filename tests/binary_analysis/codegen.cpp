@@ -0,0 +1,211 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+
+#include <bsl/convert.hpp>
+
+#include <bsl/cstdint.hpp>
+#include <bsl/details/fmt_impl_integral_helpers.hpp>
+#include <bsl/fmt_options.hpp>
+#include <bsl/from_chars.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/string_view.hpp>
+
+/// NOTE:
+/// - These are the kernels checked by codegen.cmake. It disassembles them
+///   after they are compiled and compares the number of instructions,
+///   branches and calls in each one with the limits in
+///   codegen_baseline.txt, failing the build if a limit is exceeded.
+/// - Each *_raw kernel is a hand written version of the kernel that uses
+///   the matching safe type, doing the same work (including the overflow
+///   checks). The kernel that uses the safe type is allowed to be only so
+///   many instructions larger than its *_raw version.
+/// - Every kernel is marked noinline and is not in an anonymous namespace
+///   so that it is kept as its own symbol.
+///
+
+namespace codegen
+{
+    /// @class codegen::raw_u64
+    ///
+    /// <!-- description -->
+    ///   @brief Stores an integer and its poisoned state the same way
+    ///     that a bsl::safe_u64 does in release mode.
+    ///
+    struct raw_u64 final
+    {
+        /// @brief stores the value of the integer
+        bsl::uint64 val;
+        /// @brief stores whether or not the integer has overflowed
+        bool poisoned;
+    };
+
+    /// <!-- description -->
+    ///   @brief Adds two integers, checking for overflow by hand.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param lhs the left hand side of the add
+    ///   @param rhs the right hand side of the add
+    ///   @return Returns lhs + rhs
+    ///
+    [[nodiscard]] __attribute__((noinline)) auto
+    add_raw(raw_u64 const &lhs, raw_u64 const &rhs) noexcept -> raw_u64
+    {
+        raw_u64 mut_ret{};
+        bool const overflowed{__builtin_add_overflow(lhs.val, rhs.val, &mut_ret.val)};
+        mut_ret.poisoned = overflowed || lhs.poisoned || rhs.poisoned;
+        return mut_ret;
+    }
+
+    /// <!-- description -->
+    ///   @brief Adds two integers using bsl::safe_u64.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param lhs the left hand side of the add
+    ///   @param rhs the right hand side of the add
+    ///   @return Returns lhs + rhs
+    ///
+    [[nodiscard]] __attribute__((noinline)) auto
+    add_checked(bsl::safe_u64 const &lhs, bsl::safe_u64 const &rhs) noexcept -> bsl::safe_u64
+    {
+        return lhs + rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Sums an array, checking for overflow by hand.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param spn the values to sum
+    ///   @return Returns the sum of the values, or 0 on overflow
+    ///
+    [[nodiscard]] __attribute__((noinline)) auto
+    sum_raw(bsl::span<bsl::uint64 const> const &spn) noexcept -> bsl::uint64
+    {
+        bsl::uint64 mut_sum{};
+        bool mut_poisoned{};
+
+        bsl::uint64 const *const ptr{spn.data()};
+        bsl::uintmx const size{spn.size().get()};
+        for (bsl::uintmx mut_i{}; mut_i < size; ++mut_i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            mut_poisoned = __builtin_add_overflow(mut_sum, ptr[mut_i], &mut_sum) || mut_poisoned;
+        }
+
+        if (mut_poisoned) {
+            return {};
+        }
+
+        return mut_sum;
+    }
+
+    /// <!-- description -->
+    ///   @brief Sums an array using bsl::safe_u64 and a ranged based for
+    ///     loop over the bsl::span.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param spn the values to sum
+    ///   @return Returns the sum of the values, or 0 on overflow
+    ///
+    [[nodiscard]] __attribute__((noinline)) auto
+    sum_checked(bsl::span<bsl::uint64 const> const &spn) noexcept -> bsl::uint64
+    {
+        bsl::safe_u64 mut_sum{};
+        for (auto const &elem : spn) {
+            mut_sum += elem;
+        }
+
+        if (mut_sum.is_poisoned()) {
+            return {};
+        }
+
+        return mut_sum.checked().get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Sums an array using a raw pointer loop.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param spn the values to sum
+    ///   @return Returns the sum of the values
+    ///
+    [[nodiscard]] __attribute__((noinline)) auto
+    iter_raw(bsl::span<bsl::uint32 const> const &spn) noexcept -> bsl::uint64
+    {
+        bsl::uint64 mut_sum{};
+
+        bsl::uint32 const *const ptr{spn.data()};
+        bsl::uintmx const size{spn.size().get()};
+        for (bsl::uintmx mut_i{}; mut_i < size; ++mut_i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            mut_sum += static_cast<bsl::uint64>(ptr[mut_i]);
+        }
+
+        return mut_sum;
+    }
+
+    /// <!-- description -->
+    ///   @brief Sums an array using a ranged based for loop over the
+    ///     bsl::span.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param spn the values to sum
+    ///   @return Returns the sum of the values
+    ///
+    [[nodiscard]] __attribute__((noinline)) auto
+    iter_span(bsl::span<bsl::uint32 const> const &spn) noexcept -> bsl::uint64
+    {
+        bsl::uint64 mut_sum{};
+        for (auto const &elem : spn) {
+            mut_sum += static_cast<bsl::uint64>(elem);
+        }
+
+        return mut_sum;
+    }
+
+    /// <!-- description -->
+    ///   @brief Converts a hex string to an integer using bsl::from_chars.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str the string to convert
+    ///   @return Returns the resulting integer
+    ///
+    [[nodiscard]] __attribute__((noinline)) auto
+    from_chars_hex(bsl::string_view const &str) noexcept -> bsl::safe_u64
+    {
+        constexpr bsl::safe_i32 base16{16};
+        return bsl::from_chars<bsl::uint64>(str, base16);
+    }
+
+    /// <!-- description -->
+    ///   @brief Converts an integer to hex text the same way bsl::fmt does.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param val the integer to convert
+    ///   @return Returns the resulting digits
+    ///
+    [[nodiscard]] __attribute__((noinline)) auto
+    fmt_hex(bsl::safe_u64 const &val) noexcept -> bsl::details::fmt_impl_integral_info
+    {
+        constexpr bsl::fmt_options ops{"x"};
+        return bsl::details::get_integral_info(ops, val);
+    }
+}
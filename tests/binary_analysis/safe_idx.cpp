@@ -0,0 +1,70 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+
+#include <bsl/convert.hpp>
+#include <bsl/cstr_type.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace
+{
+    /// NOTE:
+    /// - In release mode, a safe_idx stores its poisoned state as a
+    ///   sentinel value and safe_integral does not store the unchecked
+    ///   bit, so neither should be any larger than what they wrap.
+    ///
+
+    static_assert(!BSL_RELEASE_MODE || (sizeof(bsl::safe_idx) == sizeof(bsl::uintmx)));
+    static_assert(
+        !BSL_RELEASE_MODE || (sizeof(bsl::safe_u8) == (sizeof(bsl::uint8) + sizeof(bool))));
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main(bsl::int32 const argc, bsl::cstr_type const *const argv) noexcept -> bsl::exit_code
+{
+    bsl::discard(argv);
+
+    bsl::safe_idx mut_idx{};
+    for (bsl::safe_idx mut_i{}; mut_i < bsl::to_umx(argc); ++mut_i) {
+        mut_idx += mut_i;
+    }
+
+    if (mut_idx.is_invalid()) {
+        bsl::print() << 'f' << bsl::endl;
+        return bsl::exit_failure;
+    }
+
+    bsl::print() << mut_idx << bsl::endl;
+    return bsl::exit_success;
+}
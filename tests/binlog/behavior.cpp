@@ -0,0 +1,230 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BSL_BINARY_LOG
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BSL_LOG_RING
+
+#include <bsl/carray.hpp>
+#include <bsl/char_type.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/details/binlog.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/fmt.hpp>
+#include <bsl/fmt_type.hpp>
+#include <bsl/log_ring.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief stores the bytes that were drained from the log ring
+    constinit bsl::carray<bsl::uint8, bsl::details::LOG_RECORD_SIZE> g_mut_bytes{};
+    /// @brief stores the total number of bytes in g_mut_bytes
+    constinit bsl::uintmx g_mut_size{};
+
+    /// <!-- description -->
+    ///   @brief Drains the log ring, storing the bytes of the record
+    ///     that was written in g_mut_bytes.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the total number of bytes that were drained
+    ///
+    [[nodiscard]] auto
+    drain() noexcept -> bsl::uintmx
+    {
+        g_mut_size = {};
+        bsl::discard(bsl::log_drain([](bsl::safe_u64 const &seq,
+                                       bsl::safe_umx const &level,
+                                       bsl::string_view const &msg) noexcept {
+            bsl::discard(seq);
+            bsl::discard(level);
+            for (bsl::safe_idx mut_i{}; mut_i < msg.size(); ++mut_i) {
+                *g_mut_bytes.at_if(g_mut_size) = static_cast<bsl::uint8>(*msg.at_if(mut_i));
+                ++g_mut_size;
+            }
+        }));
+
+        return g_mut_size;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the drained byte at index i
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param i the index of the byte to return
+    ///   @return Returns the drained byte at index i
+    ///
+    [[nodiscard]] auto
+    byte(bsl::uintmx const i) noexcept -> bsl::uintmx
+    {
+        return static_cast<bsl::uintmx>(*g_mut_bytes.at_if(i));
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    constexpr auto marker{static_cast<bsl::uintmx>(bsl::details::BINLOG_MARKER)};
+    constexpr auto answer{static_cast<bsl::uintmx>(42)};
+
+    bsl::ut_scenario{"text is written as is"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::print() << "hi" << '!' << true;
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(drain() == static_cast<bsl::uintmx>(7));
+                bsl::ut_check(byte(0U) == static_cast<bsl::uintmx>('h'));
+                bsl::ut_check(byte(2U) == static_cast<bsl::uintmx>('!'));
+                bsl::ut_check(byte(3U) == static_cast<bsl::uintmx>('t'));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"unsigned integrals"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::print() << bsl::safe_u8{static_cast<bsl::uint8>(answer)};
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(drain() == static_cast<bsl::uintmx>(3));
+                bsl::ut_check(byte(0U) == marker);
+                bsl::ut_check(byte(1U) == sizeof(bsl::uint8));
+                bsl::ut_check(byte(2U) == answer);
+            };
+        };
+
+        bsl::ut_given{} = []() noexcept {
+            bsl::print() << static_cast<bsl::uint64>(answer);
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(drain() == static_cast<bsl::uintmx>(10));
+                bsl::ut_check(byte(0U) == marker);
+                bsl::ut_check(byte(1U) == sizeof(bsl::uint64));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"signed integrals"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::print() << bsl::safe_i16{static_cast<bsl::int16>(-1)};
+            bsl::ut_then{} = []() noexcept {
+                constexpr auto all_ones{static_cast<bsl::uintmx>(0xFF)};
+                bsl::ut_check(drain() == static_cast<bsl::uintmx>(4));
+                bsl::ut_check(byte(0U) == marker);
+                bsl::ut_check(
+                    byte(1U) == (bsl::details::BINLOG_TAG_SIGNED | sizeof(bsl::int16)));
+                bsl::ut_check(byte(2U) == all_ones);
+                bsl::ut_check(byte(3U) == all_ones);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"poisoned integrals"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::print() << bsl::safe_u32::failure();
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(drain() == static_cast<bsl::uintmx>(2));
+                bsl::ut_check(byte(0U) == marker);
+                bsl::ut_check(
+                    byte(1U) == (bsl::details::BINLOG_TAG_POISONED | sizeof(bsl::uint32)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"formatted integrals"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::print() << bsl::fmt{"*<#6x", bsl::safe_u8{static_cast<bsl::uint8>(answer)}};
+            bsl::ut_then{} = []() noexcept {
+                constexpr auto width{static_cast<bsl::uintmx>(6)};
+                bsl::ut_check(
+                    drain() ==
+                    static_cast<bsl::uintmx>(3) + bsl::details::BINLOG_OPS_SIZE);
+                bsl::ut_check(byte(0U) == marker);
+                bsl::ut_check(byte(1U) == (bsl::details::BINLOG_TAG_OPS | sizeof(bsl::uint8)));
+                bsl::ut_check(byte(2U) == static_cast<bsl::uintmx>('*'));
+                bsl::ut_check(byte(3U) == static_cast<bsl::uintmx>(bsl::fmt_align::fmt_align_left));
+                bsl::ut_check(byte(5U) == bsl::details::BINLOG_FLAG_ALTERNATE_FORM);
+                bsl::ut_check(byte(6U) == width);
+                bsl::ut_check(byte(7U) == static_cast<bsl::uintmx>(0));
+                bsl::ut_check(byte(8U) == static_cast<bsl::uintmx>(bsl::fmt_type::fmt_type_x));
+                bsl::ut_check(byte(9U) == answer);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"pointers"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::print() << static_cast<void const *>(&g_mut_size);
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(
+                    drain() ==
+                    static_cast<bsl::uintmx>(2) + bsl::details::BINLOG_OPS_SIZE +
+                        sizeof(bsl::uintmx));
+                bsl::ut_check(byte(0U) == marker);
+                bsl::ut_check(byte(1U) == (bsl::details::BINLOG_TAG_OPS | sizeof(bsl::uintmx)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"nul chars are escaped"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::print() << '\0';
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(drain() == static_cast<bsl::uintmx>(2));
+                bsl::ut_check(byte(0U) == marker);
+                bsl::ut_check(byte(1U) == bsl::details::BINLOG_TAG_NUL);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"nul chars inside of strings are escaped"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::print() << bsl::string_view{"a\0b", 3_umx} << bsl::string_view{"\0\0", 2_umx};
+            bsl::ut_then{} = []() noexcept {
+                constexpr auto a{static_cast<bsl::uintmx>('a')};
+                constexpr auto b{static_cast<bsl::uintmx>('b')};
+                bsl::ut_check(drain() == static_cast<bsl::uintmx>(8));
+                bsl::ut_check(byte(0U) == a);
+                bsl::ut_check(byte(1U) == marker);
+                bsl::ut_check(byte(2U) == bsl::details::BINLOG_TAG_NUL);
+                bsl::ut_check(byte(3U) == b);
+                bsl::ut_check(byte(4U) == marker);
+                bsl::ut_check(byte(5U) == bsl::details::BINLOG_TAG_NUL);
+                bsl::ut_check(byte(6U) == marker);
+                bsl::ut_check(byte(7U) == bsl::details::BINLOG_TAG_NUL);
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,52 @@
+#
+# Copyright (C) 2020 Assured Information Security, Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+# Runs TEXT and pipes BINARY into DECODE (utils/binlog_decode), and
+# fails unless both produce exactly the same bytes. TEXT and BINARY are
+# the same program, compiled without and with BSL_BINARY_LOG.
+
+execute_process(
+    COMMAND ${TEXT}
+    OUTPUT_FILE ${CMAKE_CURRENT_BINARY_DIR}/round_trip_text.out
+    RESULT_VARIABLE TEXT_RESULT
+)
+
+execute_process(
+    COMMAND ${BINARY}
+    COMMAND ${DECODE}
+    OUTPUT_FILE ${CMAKE_CURRENT_BINARY_DIR}/round_trip_decoded.out
+    RESULTS_VARIABLE DECODE_RESULTS
+)
+
+if(NOT TEXT_RESULT EQUAL 0 OR NOT DECODE_RESULTS STREQUAL "0;0")
+    message(FATAL_ERROR "binlog round trip: a command failed")
+endif()
+
+execute_process(
+    COMMAND ${CMAKE_COMMAND} -E compare_files
+        ${CMAKE_CURRENT_BINARY_DIR}/round_trip_text.out
+        ${CMAKE_CURRENT_BINARY_DIR}/round_trip_decoded.out
+    RESULT_VARIABLE COMPARE_RESULT
+)
+
+if(NOT COMPARE_RESULT EQUAL 0)
+    message(FATAL_ERROR "binlog round trip: decoded output does not match the text output")
+endif()
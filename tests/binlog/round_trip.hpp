@@ -0,0 +1,53 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef TESTS_BINLOG_ROUND_TRIP_HPP
+#define TESTS_BINLOG_ROUND_TRIP_HPP
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/fmt.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+
+namespace round_trip
+{
+    /// <!-- description -->
+    ///   @brief Outputs text (including NUL chars) and integrals. This is
+    ///     compiled both with and without BSL_BINARY_LOG, and the decoded
+    ///     binary output must match the text output byte for byte.
+    ///
+    inline void
+    output() noexcept
+    {
+        bsl::print() << "text" << bsl::endl;
+        bsl::print() << bsl::string_view{"a\0b\0", 4_umx} << bsl::endl;
+        bsl::print() << '\0' << bsl::endl;
+        bsl::print() << 42_u8 << ' ' << -42_i32 << ' ' << bsl::safe_u64::max_value() << bsl::endl;
+        bsl::print() << bsl::fmt{"#010x", 42_u32} << bsl::endl;
+        bsl::print() << bsl::safe_i16::failure() << bsl::endl;
+    }
+}
+
+#endif
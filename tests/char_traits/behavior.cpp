@@ -25,6 +25,7 @@
 #include <bsl/char_traits.hpp>
 #include <bsl/char_type.hpp>
 #include <bsl/convert.hpp>
+#include <bsl/npos.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
 
@@ -74,6 +75,29 @@ namespace
             };
         };
 
+        bsl::ut_scenario{"compare"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(0 == traits::compare("42", "42", bsl::to_umx(2)));
+                    bsl::ut_check(0 == traits::compare("42", "43", bsl::to_umx(1)));
+                    bsl::ut_check(0 == traits::compare("42", "23", bsl::to_umx(0)));
+                    bsl::ut_check(traits::compare("42", "43", bsl::to_umx(2)) < 0);
+                    bsl::ut_check(traits::compare("43", "42", bsl::to_umx(2)) > 0);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"find"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(traits::find("42", bsl::to_umx(2), '4') == bsl::to_idx(0));
+                    bsl::ut_check(traits::find("42", bsl::to_umx(2), '2') == bsl::to_idx(1));
+                    bsl::ut_check(traits::find("42", bsl::to_umx(1), '2') == bsl::npos);
+                    bsl::ut_check(traits::find("42", bsl::to_umx(0), '4') == bsl::npos);
+                };
+            };
+        };
+
         bsl::ut_scenario{"to_char_type"} = []() noexcept {
             bsl::ut_then{} = []() noexcept {
                 constexpr bsl::safe_i32 s{bsl::to_i32(42)};
@@ -45,6 +45,8 @@ main() noexcept -> bsl::exit_code
         static_assert(noexcept(traits::eq('H', 'H')));
         static_assert(noexcept(traits::lt('H', 'H')));
         static_assert(noexcept(traits::length(nullptr)));
+        static_assert(noexcept(traits::compare("42", "42", bsl::to_umx(2))));
+        static_assert(noexcept(traits::find("42", bsl::to_umx(2), '4')));
         static_assert(noexcept(traits::to_char_type(bsl::to_i32(0).get())));
         static_assert(noexcept(traits::to_int_type(' ')));
         static_assert(noexcept(traits::eq_int_type(bsl::to_i32(0).get(), bsl::to_i32(0).get())));
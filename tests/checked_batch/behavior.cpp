@@ -0,0 +1,373 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/checked_batch.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/numeric_limits.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief the max value of a bsl::uint8
+    constexpr auto U8_MAX{bsl::numeric_limits<bsl::uint8>::max_value()};
+    /// @brief the max value of a bsl::int8
+    constexpr auto I8_MAX{bsl::numeric_limits<bsl::int8>::max_value()};
+    /// @brief the min value of a bsl::int8
+    constexpr auto I8_MIN{bsl::numeric_limits<bsl::int8>::min_value()};
+    /// @brief the max value of a bsl::uint64
+    constexpr auto U64_MAX{bsl::numeric_limits<bsl::uint64>::max_value()};
+    /// @brief the max value of a bsl::int64
+    constexpr auto I64_MAX{bsl::numeric_limits<bsl::int64>::max_value()};
+    /// @brief the min value of a bsl::int64
+    constexpr auto I64_MIN{bsl::numeric_limits<bsl::int64>::min_value()};
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"checked_add"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::uint64, 5> mut_arr{};
+                bsl::array<bsl::uint64, 5> const lhs{1U, 2U, 3U, 4U, 5U};
+                bsl::array<bsl::uint64, 5> const rhs{10U, 20U, 30U, 40U, U64_MAX - 5U};
+                bsl::span mut_dst{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::errc_success ==
+                        bsl::checked_add(mut_dst, bsl::span{lhs}, bsl::span{rhs}));
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(0)) == 11U);
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(3)) == 44U);
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(4)) == U64_MAX);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::uint8, 3> mut_arr{};
+                bsl::array<bsl::uint8, 3> const lhs{1U, U8_MAX, 3U};
+                bsl::array<bsl::uint8, 3> const rhs{1U, 1U, 3U};
+                bsl::span mut_dst{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::errc_unsigned_wrap ==
+                        bsl::checked_add(mut_dst, bsl::span{lhs}, bsl::span{rhs}));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::int64, 3> mut_arr{};
+                bsl::array<bsl::int64, 3> const lhs{-1, I64_MAX, I64_MIN};
+                bsl::array<bsl::int64, 3> const rhs{1, I64_MIN, I64_MAX};
+                bsl::array<bsl::int64, 3> const pos{1, 1, 1};
+                bsl::array<bsl::int64, 3> const neg{-1, -1, -1};
+                bsl::span mut_dst{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::errc_success ==
+                        bsl::checked_add(mut_dst, bsl::span{lhs}, bsl::span{rhs}));
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(0)) == 0);
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(1)) == -1);
+                    bsl::ut_check(
+                        bsl::errc_signed_overflow ==
+                        bsl::checked_add(mut_dst, bsl::span{lhs}, bsl::span{pos}));
+                    bsl::ut_check(
+                        bsl::errc_signed_overflow ==
+                        bsl::checked_add(mut_dst, bsl::span{lhs}, bsl::span{neg}));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::uint64, 2> mut_arr{};
+                bsl::array<bsl::uint64, 3> const big{};
+                bsl::array<bsl::uint64, 2> const small{};
+                bsl::span mut_dst{mut_arr};
+                bsl::span<bsl::uint64> mut_empty{};
+                bsl::span<bsl::uint64 const> const empty{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::errc_index_out_of_bounds ==
+                        bsl::checked_add(mut_dst, bsl::span{big}, bsl::span{big}));
+                    bsl::ut_check(
+                        bsl::errc_index_out_of_bounds ==
+                        bsl::checked_add(mut_dst, bsl::span{small}, bsl::span{big}));
+                    bsl::ut_check(
+                        bsl::errc_index_out_of_bounds ==
+                        bsl::checked_add(mut_empty, bsl::span{small}, bsl::span{small}));
+                    bsl::ut_check(bsl::errc_success == bsl::checked_add(mut_empty, empty, empty));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"checked_sub"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::uint8, 2> mut_arr{};
+                bsl::array<bsl::uint8, 2> const lhs{10U, 1U};
+                bsl::array<bsl::uint8, 2> const rhs{3U, 1U};
+                bsl::span mut_dst{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::errc_success ==
+                        bsl::checked_sub(mut_dst, bsl::span{lhs}, bsl::span{rhs}));
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(0)) == 7U);
+                    bsl::ut_check(
+                        bsl::errc_unsigned_wrap ==
+                        bsl::checked_sub(mut_dst, bsl::span{rhs}, bsl::span{lhs}));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::int8, 2> mut_arr{};
+                bsl::array<bsl::int8, 2> const lhs{I8_MIN, 0};
+                bsl::array<bsl::int8, 2> const rhs{-1, I8_MAX};
+                bsl::array<bsl::int8, 2> const one{1, 1};
+                bsl::span mut_dst{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::errc_success ==
+                        bsl::checked_sub(mut_dst, bsl::span{lhs}, bsl::span{rhs}));
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(0)) == I8_MIN + 1);
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(1)) == -I8_MAX);
+                    bsl::ut_check(
+                        bsl::errc_signed_overflow ==
+                        bsl::checked_sub(mut_dst, bsl::span{lhs}, bsl::span{one}));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"checked_mul"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::uint8, 2> mut_arr{};
+                bsl::array<bsl::uint8, 2> const lhs{15U, 15U};
+                bsl::array<bsl::uint8, 2> const rhs{17U, 18U};
+                bsl::span mut_dst{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::errc_success ==
+                        bsl::checked_mul(mut_dst, bsl::span{lhs}, bsl::span{lhs}));
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(0)) == 225U);
+                    bsl::ut_check(
+                        bsl::errc_unsigned_wrap ==
+                        bsl::checked_mul(mut_dst, bsl::span{lhs}, bsl::span{rhs}));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::int8, 2> mut_arr{};
+                bsl::array<bsl::int8, 2> const lhs{-16, 8};
+                bsl::array<bsl::int8, 2> const rhs{8, -16};
+                bsl::array<bsl::int8, 2> const big{-16, 9};
+                bsl::span mut_dst{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::errc_success ==
+                        bsl::checked_mul(mut_dst, bsl::span{lhs}, bsl::span{rhs}));
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(0)) == I8_MIN);
+                    bsl::ut_check(
+                        bsl::errc_signed_overflow ==
+                        bsl::checked_mul(mut_dst, bsl::span{big}, bsl::span{rhs}));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::int64, 2> mut_arr{};
+                bsl::array<bsl::int64, 2> const lhs{I64_MAX, -1};
+                bsl::array<bsl::int64, 2> const rhs{1, I64_MAX};
+                bsl::array<bsl::int64, 2> const two{2, 2};
+                bsl::span mut_dst{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::errc_success ==
+                        bsl::checked_mul(mut_dst, bsl::span{lhs}, bsl::span{rhs}));
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(1)) == -I64_MAX);
+                    bsl::ut_check(
+                        bsl::errc_signed_overflow ==
+                        bsl::checked_mul(mut_dst, bsl::span{lhs}, bsl::span{two}));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"checked_mac"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::uint32, 2> mut_arr{1U, 2U};
+                bsl::array<bsl::uint32, 2> const lhs{3U, 4U};
+                bsl::array<bsl::uint32, 2> const rhs{5U, 6U};
+                bsl::span mut_dst{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::errc_success ==
+                        bsl::checked_mac(mut_dst, bsl::span{lhs}, bsl::span{rhs}));
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(0)) == 16U);
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(1)) == 26U);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::uint8, 2> mut_arr{U8_MAX, 0U};
+                bsl::array<bsl::uint8, 2> const lhs{1U, 1U};
+                bsl::span mut_dst{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::errc_unsigned_wrap ==
+                        bsl::checked_mac(mut_dst, bsl::span{lhs}, bsl::span{lhs}));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"saturating"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::uint8, 3> mut_arr{};
+                bsl::array<bsl::uint8, 3> const lhs{200U, 1U, 20U};
+                bsl::array<bsl::uint8, 3> const rhs{100U, 2U, 30U};
+                bsl::span mut_dst{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::errc_success ==
+                        bsl::saturating_add(mut_dst, bsl::span{lhs}, bsl::span{rhs}));
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(0)) == U8_MAX);
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(1)) == 3U);
+                    bsl::ut_check(
+                        bsl::errc_success ==
+                        bsl::saturating_sub(mut_dst, bsl::span{lhs}, bsl::span{rhs}));
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(0)) == 100U);
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(1)) == 0U);
+                    bsl::ut_check(
+                        bsl::errc_success ==
+                        bsl::saturating_mul(mut_dst, bsl::span{lhs}, bsl::span{rhs}));
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(0)) == U8_MAX);
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(1)) == 2U);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::int8, 3> mut_arr{};
+                bsl::array<bsl::int8, 3> const lhs{100, -100, 5};
+                bsl::array<bsl::int8, 3> const rhs{100, 100, -6};
+                bsl::span mut_dst{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::errc_success ==
+                        bsl::saturating_add(mut_dst, bsl::span{lhs}, bsl::span{rhs}));
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(0)) == I8_MAX);
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(1)) == 0);
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(2)) == -1);
+                    bsl::ut_check(
+                        bsl::errc_success ==
+                        bsl::saturating_sub(mut_dst, bsl::span{lhs}, bsl::span{rhs}));
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(0)) == 0);
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(1)) == I8_MIN);
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(2)) == 11);
+                    bsl::ut_check(
+                        bsl::errc_success ==
+                        bsl::saturating_mul(mut_dst, bsl::span{lhs}, bsl::span{rhs}));
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(0)) == I8_MAX);
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(1)) == I8_MIN);
+                    bsl::ut_check(*mut_dst.at_if(bsl::to_idx(2)) == -30);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::uint8, 2> mut_arr{};
+                bsl::array<bsl::uint8, 3> const big{};
+                bsl::span mut_dst{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::errc_index_out_of_bounds ==
+                        bsl::saturating_add(mut_dst, bsl::span{big}, bsl::span{big}));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"checked_sum"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::uint64, 9> const vals{1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U};
+                bsl::span<bsl::uint64 const> const empty{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::checked_sum(bsl::span{vals}) == bsl::to_u64(45));
+                    bsl::ut_check(bsl::checked_sum(bsl::span{vals}).is_valid_and_checked());
+                    bsl::ut_check(bsl::checked_sum(empty) == bsl::to_u64(0));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::uint8, 6> const lanes{U8_MAX, 0U, 0U, 0U, 1U, 0U};
+                bsl::array<bsl::uint8, 5> const tail{0U, 0U, 0U, 0U, U8_MAX};
+                bsl::array<bsl::uint8, 2> const across{128U, 128U};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::checked_sum(bsl::span{lanes}).is_poisoned());
+                    bsl::ut_check(bsl::checked_sum(bsl::span{tail}) == bsl::to_u8(U8_MAX));
+                    bsl::ut_check(bsl::checked_sum(bsl::span{across}).is_poisoned());
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::int64, 5> const vals{-1, -2, -3, -4, I64_MIN + 10};
+                bsl::array<bsl::int64, 5> const over{-1, -2, -3, -4, I64_MIN + 9};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::checked_sum(bsl::span{vals}) == bsl::to_i64(I64_MIN));
+                    bsl::ut_check(bsl::checked_sum(bsl::span{over}).is_poisoned());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"checked_min/max"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::int32, 5> const vals{3, -7, 42, 0, 9};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::checked_min(bsl::span{vals}) == bsl::to_i32(-7));
+                    bsl::ut_check(bsl::checked_max(bsl::span{vals}) == bsl::to_i32(42));
+                    bsl::ut_check(bsl::checked_min(bsl::span<bsl::int32 const>{}).is_poisoned());
+                    bsl::ut_check(bsl::checked_max(bsl::span<bsl::int32 const>{}).is_poisoned());
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
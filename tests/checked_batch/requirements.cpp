@@ -0,0 +1,64 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/checked_batch.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::array<bsl::uint64, 4> mut_arr{};
+            bsl::array<bsl::uint64, 4> const arr{};
+            bsl::span mut_dst{mut_arr};
+            bsl::span const src{arr};
+            bsl::ut_then{} = []() noexcept {
+                static_assert(noexcept(bsl::checked_add(mut_dst, src, src)));
+                static_assert(noexcept(bsl::checked_sub(mut_dst, src, src)));
+                static_assert(noexcept(bsl::checked_mul(mut_dst, src, src)));
+                static_assert(noexcept(bsl::checked_mac(mut_dst, src, src)));
+                static_assert(noexcept(bsl::saturating_add(mut_dst, src, src)));
+                static_assert(noexcept(bsl::saturating_sub(mut_dst, src, src)));
+                static_assert(noexcept(bsl::saturating_mul(mut_dst, src, src)));
+                static_assert(noexcept(bsl::checked_sum(src)));
+                static_assert(noexcept(bsl::checked_min(src)));
+                static_assert(noexcept(bsl::checked_max(src)));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,160 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+#include "../array_init.hpp"
+
+#include <bsl/checked_range.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"construct from a pointer and a count"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                auto mut_arr{test::ARRAY_INIT};
+                bsl::checked_range const rng{mut_arr.data(), mut_arr.size()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(rng.data() == mut_arr.data());
+                    bsl::ut_check(rng.size() == mut_arr.size());
+                    bsl::ut_check(!rng.empty());
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_i32 *const ptr{};
+                bsl::checked_range const rng{ptr, bsl::to_umx(6)};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(nullptr == rng.data());
+                    bsl::ut_check(rng.size().is_zero());
+                    bsl::ut_check(rng.empty());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"index"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                auto mut_arr{test::ARRAY_INIT};
+                bsl::checked_range mut_rng{mut_arr.data(), mut_arr.size()};
+                bsl::ut_when{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < mut_rng.size(); ++mut_i) {
+                        mut_rng[mut_i] = bsl::to_i32(42);
+                    }
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        for (bsl::safe_idx mut_i{}; mut_i < mut_arr.size(); ++mut_i) {
+                            bsl::ut_check(*mut_arr.at_if(mut_i) == bsl::to_i32(42));
+                        }
+                    };
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                auto const arr{test::ARRAY_INIT};
+                bsl::checked_range const rng{arr.data(), arr.size()};
+                bsl::ut_then{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < rng.size(); ++mut_i) {
+                        bsl::ut_check(rng[mut_i] == *arr.at_if(mut_i));
+                    }
+                };
+            };
+        };
+
+        bsl::ut_scenario{"span unchecked_view"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::span<bsl::safe_i32> mut_spn{};
+                bsl::span<bsl::safe_i32> const spn{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_spn.unchecked_view().empty());
+                    bsl::ut_check(spn.unchecked_view().empty());
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                auto mut_arr{test::ARRAY_INIT};
+                bsl::span mut_spn{mut_arr};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto mut_rng{mut_spn.unchecked_view()};
+                    mut_rng[bsl::to_idx(5)] = bsl::to_i32(42);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rng.size() == mut_spn.size());
+                        bsl::ut_check(*mut_arr.at_if(bsl::to_idx(5)) == bsl::to_i32(42));
+                    };
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                auto const arr{test::ARRAY_INIT};
+                bsl::span const spn{arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const rng{spn.unchecked_view(bsl::to_idx(2), bsl::to_umx(3))};
+                    bsl::ut_check(rng.size() == bsl::to_umx(3));
+                    bsl::ut_check(rng[bsl::to_idx(0)] == *arr.at_if(bsl::to_idx(2)));
+                    bsl::ut_check(rng[bsl::to_idx(2)] == *arr.at_if(bsl::to_idx(4)));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                auto const arr{test::ARRAY_INIT};
+                bsl::span const spn{arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const rng1{spn.unchecked_view(bsl::to_idx(4), bsl::to_umx(42))};
+                    auto const rng2{spn.unchecked_view(bsl::to_idx(6))};
+                    bsl::ut_check(rng1.size() == bsl::to_umx(2));
+                    bsl::ut_check(rng2.empty());
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
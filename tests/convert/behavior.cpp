@@ -985,7 +985,9 @@ namespace
             ut_check(to_u32(safe_u64::max_value()).is_invalid());
             ut_check(to_u64(safe_u64::max_value()) == static_cast<uint64>(max));
             ut_check(to_umx(safe_u64::max_value()) == static_cast<uintmx>(max));
-            ut_check(to_idx(safe_u64::max_value()) == static_cast<uintmx>(max));
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ut_check(to_idx(safe_u64::max_value()).is_invalid());
+            };
 
             auto const min{numeric_limits<uint64>::min_value()};    // NOLINT
             ut_check(to_i8(safe_u64::min_value()) == static_cast<int8>(min));
@@ -1033,7 +1035,9 @@ namespace
             ut_check(to_u32(numeric_limits<uint64>::max_value()).is_invalid());
             ut_check(to_u64(numeric_limits<uint64>::max_value()) == static_cast<uint64>(max));
             ut_check(to_umx(numeric_limits<uint64>::max_value()) == static_cast<uintmx>(max));
-            ut_check(to_idx(numeric_limits<uint64>::max_value()) == static_cast<uintmx>(max));
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ut_check(to_idx(numeric_limits<uint64>::max_value()).is_invalid());
+            };
 
             auto const min{numeric_limits<uint64>::min_value()};    // NOLINT
             ut_check(to_i8(numeric_limits<uint64>::min_value()) == static_cast<int8>(min));
@@ -1098,7 +1102,9 @@ namespace
             ut_check(to_u32(safe_umx::max_value()).is_invalid());
             ut_check(to_u64(safe_umx::max_value()) == static_cast<uint64>(max));
             ut_check(to_umx(safe_umx::max_value()) == static_cast<uintmx>(max));
-            ut_check(to_idx(safe_umx::max_value()) == static_cast<uintmx>(max));
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ut_check(to_idx(safe_umx::max_value()).is_invalid());
+            };
 
             auto const min{numeric_limits<uintmx>::min_value()};    // NOLINT
             ut_check(to_i8(safe_umx::min_value()) == static_cast<int8>(min));
@@ -1146,7 +1152,9 @@ namespace
             ut_check(to_u32(numeric_limits<uintmx>::max_value()).is_invalid());
             ut_check(to_u64(numeric_limits<uintmx>::max_value()) == static_cast<uint64>(max));
             ut_check(to_umx(numeric_limits<uintmx>::max_value()) == static_cast<uintmx>(max));
-            ut_check(to_idx(numeric_limits<uintmx>::max_value()) == static_cast<uintmx>(max));
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                ut_check(to_idx(numeric_limits<uintmx>::max_value()).is_invalid());
+            };
 
             auto const min{numeric_limits<uintmx>::min_value()};    // NOLINT
             ut_check(to_i8(numeric_limits<uintmx>::min_value()) == static_cast<int8>(min));
@@ -1202,7 +1210,7 @@ namespace
             ut_check(to_umx(safe_idx::magic_1()) == safe_umx::magic_1());
             ut_check(to_idx(safe_idx::magic_1()) == safe_umx::magic_1());
 
-            auto const max{numeric_limits<uintmx>::max_value()};    // NOLINT
+            auto const max{safe_idx::max_value().get()};    // NOLINT
             ut_check(to_i8(safe_idx::max_value()).is_invalid());
             ut_check(to_i16(safe_idx::max_value()).is_invalid());
             ut_check(to_i32(safe_idx::max_value()).is_invalid());
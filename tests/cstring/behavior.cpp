@@ -28,6 +28,7 @@
 #include <bsl/convert.hpp>
 #include <bsl/cstr_type.hpp>
 #include <bsl/cstring.hpp>
+#include <bsl/npos.hpp>
 #include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
@@ -55,6 +56,19 @@ namespace
                     bsl::ut_check(bsl::builtin_strlen(msg2) == bsl::to_umx(5));
                 };
             };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::cstr_type const msg1{"1234567"};
+                bsl::cstr_type const msg2{"12345678"};
+                bsl::cstr_type const msg3{"123456789"};
+                bsl::cstr_type const msg4{"1234567812345678123456781234567812345678123"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::builtin_strlen(msg1) == bsl::to_umx(7));
+                    bsl::ut_check(bsl::builtin_strlen(msg2) == bsl::to_umx(8));
+                    bsl::ut_check(bsl::builtin_strlen(msg3) == bsl::to_umx(9));
+                    bsl::ut_check(bsl::builtin_strlen(msg4) == bsl::to_umx(43));
+                };
+            };
         };
 
         bsl::ut_scenario{"builtin_memset"} = []() noexcept {
@@ -97,6 +111,34 @@ namespace
             };
         };
 
+        bsl::ut_scenario{"builtin_memchr"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::cstr_type const msg{"Hello World"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::builtin_memchr(msg, 'H', 0_umx) == bsl::npos);
+                    bsl::ut_check(bsl::builtin_memchr(msg, 'H', 11_umx) == bsl::to_idx(0));
+                    bsl::ut_check(bsl::builtin_memchr(msg, 'o', 11_umx) == bsl::to_idx(4));
+                    bsl::ut_check(bsl::builtin_memchr(msg, 'd', 11_umx) == bsl::to_idx(10));
+                    bsl::ut_check(bsl::builtin_memchr(msg, 'd', 10_umx) == bsl::npos);
+                    bsl::ut_check(bsl::builtin_memchr(msg, '*', 11_umx) == bsl::npos);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"builtin_memcmp"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::cstr_type const msg1{"Hello World"};
+                bsl::cstr_type const msg2{"Hello Earth"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(0 == bsl::builtin_memcmp(msg1, msg2, 0_umx));
+                    bsl::ut_check(0 == bsl::builtin_memcmp(msg1, msg2, 6_umx));
+                    bsl::ut_check(bsl::builtin_memcmp(msg1, msg2, 7_umx) > 0);
+                    bsl::ut_check(bsl::builtin_memcmp(msg2, msg1, 7_umx) < 0);
+                    bsl::ut_check(0 == bsl::builtin_memcmp(msg1, msg1, 11_umx));
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
@@ -48,6 +48,8 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(bsl::builtin_strlen("")));
                 static_assert(noexcept(bsl::builtin_memset(mut_arr.data(), '\0', size)));
                 static_assert(noexcept(bsl::builtin_memcpy(mut_arr.data(), mut_arr.data(), size)));
+                static_assert(noexcept(bsl::builtin_memchr("42", '4', size)));
+                static_assert(noexcept(bsl::builtin_memcmp("42", "42", size)));
             };
         };
     };
@@ -0,0 +1,320 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define REDIRECT_STDOUT
+
+#include <bsl/carray.hpp>
+#include <bsl/char_type.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/cstr_type.hpp>
+#include <bsl/details/out_buffer.hpp>
+#include <bsl/details/out_char.hpp>
+#include <bsl/details/out_cstr.hpp>
+
+/// NOTE:
+/// - Every write to the console is recorded, so that the tests below
+///   can check how the out_buffer splits output into writes, and not
+///   only what is output.
+///
+
+namespace
+{
+    /// @brief defines the max number of writes that can be recorded
+    constexpr bsl::uintmx MAX_WRITES{static_cast<bsl::uintmx>(16)};
+    /// @brief defines the max number of chars that can be recorded
+    constexpr bsl::uintmx MAX_CHARS{static_cast<bsl::uintmx>(4096)};
+
+    /// @brief stores the length of each write to the console
+    constinit bsl::carray<bsl::uintmx, MAX_WRITES> g_mut_writes{};
+    /// @brief stores the total number of writes to the console
+    constinit bsl::uintmx g_mut_num_writes{};
+    /// @brief stores every char written to the console
+    constinit bsl::carray<bsl::char_type, MAX_CHARS> g_mut_chars{};
+    /// @brief stores the total number of chars written to the console
+    constinit bsl::uintmx g_mut_num_chars{};
+
+    /// <!-- description -->
+    ///   @brief Records a write of len chars from str.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str the chars that were written
+    ///   @param len the total number of chars that were written
+    ///
+    void
+    record(bsl::cstr_type const str, bsl::uintmx const len) noexcept
+    {
+        *g_mut_writes.at_if(g_mut_num_writes) = len;
+        ++g_mut_num_writes;
+
+        for (bsl::uintmx mut_i{}; mut_i < len; ++mut_i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            *g_mut_chars.at_if(g_mut_num_chars) = str[mut_i];
+            ++g_mut_num_chars;
+        }
+    }
+}
+
+namespace bsl::details
+{
+    /// <!-- description -->
+    ///   @brief Records a character written to stdout.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param c the character to output to stdout
+    ///
+    void
+    redirected_out_char(bsl::char_type const c) noexcept
+    {
+        record(&c, static_cast<bsl::uintmx>(1));
+    }
+
+    /// <!-- description -->
+    ///   @brief Records a string written to stdout.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str the string to output to stdout
+    ///   @param len the total number of bytes to output
+    ///
+    void
+    redirected_out_cstr(cstr_type const str, uintmx const len) noexcept
+    {
+        record(str, len);
+    }
+}
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/format.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of the out_buffer
+    constexpr bsl::uintmx SIZE{bsl::details::OUT_BUFFER_SIZE};
+
+    /// <!-- description -->
+    ///   @brief Forgets every write that was recorded so far.
+    ///
+    void
+    reset() noexcept
+    {
+        g_mut_num_writes = {};
+        g_mut_num_chars = {};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the length of the write at index i
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param i the index of the write to return
+    ///   @return Returns the length of the write at index i
+    ///
+    [[nodiscard]] auto
+    write(bsl::uintmx const i) noexcept -> bsl::uintmx
+    {
+        return *g_mut_writes.at_if(i);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the chars that were written match str.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str the string to compare with
+    ///   @return Returns true if the chars that were written match str.
+    ///
+    [[nodiscard]] auto
+    written(bsl::string_view const &str) noexcept -> bool
+    {
+        return str == bsl::string_view{g_mut_chars.data(), bsl::to_umx(g_mut_num_chars)};
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(bsl::details::OUT_BUFFER_ENABLED);
+
+    bsl::ut_scenario{"a statement is a single write"} = []() noexcept {
+        bsl::ut_when{} = []() noexcept {
+            reset();
+            bsl::print() << "the answer is " << 'x' << " or " << true;
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(static_cast<bsl::uintmx>(1) == g_mut_num_writes);
+                bsl::ut_check(written("the answer is x or true"));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"bsl::format is a single write"} = []() noexcept {
+        bsl::ut_when{} = []() noexcept {
+            reset();
+            bsl::format(bsl::print(), "{} and {:#x}", bsl::to_u32(42), bsl::safe_u32::magic_3());
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(static_cast<bsl::uintmx>(1) == g_mut_num_writes);
+                bsl::ut_check(written("42 and 0x3"));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"a newline flushes the buffer"} = []() noexcept {
+        bsl::ut_when{} = []() noexcept {
+            reset();
+            bsl::print() << 'a' << '\n' << 'b';
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(static_cast<bsl::uintmx>(2) == g_mut_num_writes);
+                bsl::ut_check(static_cast<bsl::uintmx>(2) == write(0U));
+                bsl::ut_check(static_cast<bsl::uintmx>(1) == write(1U));
+                bsl::ut_check(written("a\nb"));
+            };
+        };
+
+        bsl::ut_when{} = []() noexcept {
+            reset();
+            bsl::print() << "ab\ncd\n\nef";
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(static_cast<bsl::uintmx>(4) == g_mut_num_writes);
+                bsl::ut_check(static_cast<bsl::uintmx>(3) == write(0U));
+                bsl::ut_check(static_cast<bsl::uintmx>(3) == write(1U));
+                bsl::ut_check(static_cast<bsl::uintmx>(1) == write(2U));
+                bsl::ut_check(static_cast<bsl::uintmx>(2) == write(3U));
+                bsl::ut_check(written("ab\ncd\n\nef"));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"a full buffer is flushed"} = []() noexcept {
+        bsl::ut_when{} = []() noexcept {
+            reset();
+            {
+                auto const o{bsl::print()};
+                for (bsl::uintmx mut_i{}; mut_i < SIZE; ++mut_i) {
+                    o.write_to_console('*');
+                }
+
+                bsl::ut_check(g_mut_num_writes == static_cast<bsl::uintmx>(0));
+                o.write_to_console('!');
+                bsl::ut_check(g_mut_num_writes == static_cast<bsl::uintmx>(1));
+                bsl::ut_check(SIZE == write(0U));
+            }
+
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(static_cast<bsl::uintmx>(2) == g_mut_num_writes);
+                bsl::ut_check(static_cast<bsl::uintmx>(1) == write(1U));
+                bsl::ut_check('!' == *g_mut_chars.at_if(SIZE));
+            };
+        };
+
+        bsl::ut_when{} = []() noexcept {
+            reset();
+            bsl::carray<bsl::char_type, SIZE> mut_str{};
+            for (bsl::uintmx mut_i{}; mut_i < mut_str.size(); ++mut_i) {
+                *mut_str.at_if(mut_i) = '*';
+            }
+
+            constexpr bsl::uintmx half{SIZE / static_cast<bsl::uintmx>(2)};
+            {
+                auto const o{bsl::print()};
+                o.write_to_console(mut_str.data(), half);
+                o.write_to_console(mut_str.data(), half);
+                bsl::ut_check(g_mut_num_writes == static_cast<bsl::uintmx>(0));
+                o.write_to_console(mut_str.data(), half);
+                bsl::ut_check(g_mut_num_writes == static_cast<bsl::uintmx>(1));
+            }
+
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(static_cast<bsl::uintmx>(2) == g_mut_num_writes);
+                bsl::ut_check(SIZE == write(0U));
+                bsl::ut_check(half == write(1U));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"a line longer than the buffer"} = []() noexcept {
+        bsl::ut_when{} = []() noexcept {
+            reset();
+            constexpr bsl::uintmx len{SIZE + SIZE};
+            bsl::carray<bsl::char_type, len> mut_str{};
+            for (bsl::uintmx mut_i{}; mut_i < mut_str.size(); ++mut_i) {
+                *mut_str.at_if(mut_i) = '*';
+            }
+
+            {
+                auto const o{bsl::print()};
+                o.write_to_console("ab", static_cast<bsl::uintmx>(2));
+                o.write_to_console(mut_str.data(), mut_str.size());
+                o.write_to_console("cd\n", static_cast<bsl::uintmx>(3));
+            }
+
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(static_cast<bsl::uintmx>(3) == g_mut_num_writes);
+                bsl::ut_check(static_cast<bsl::uintmx>(2) == write(0U));
+                bsl::ut_check(len == write(1U));
+                bsl::ut_check(static_cast<bsl::uintmx>(3) == write(2U));
+                bsl::ut_check(len + static_cast<bsl::uintmx>(5) == g_mut_num_chars);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"a nested bsl::out"} = []() noexcept {
+        bsl::ut_when{} = []() noexcept {
+            reset();
+            {
+                auto const o{bsl::print()};
+                o << "outer ";
+                bsl::print() << "inner";
+                bsl::ut_check(g_mut_num_writes == static_cast<bsl::uintmx>(0));
+                o << " outer";
+            }
+
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(static_cast<bsl::uintmx>(1) == g_mut_num_writes);
+                bsl::ut_check(written("outer inner outer"));
+            };
+        };
+
+        bsl::ut_when{} = []() noexcept {
+            reset();
+            bsl::print() << "first";
+            bsl::print() << "second";
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(static_cast<bsl::uintmx>(2) == g_mut_num_writes);
+                bsl::ut_check(static_cast<bsl::uintmx>(5) == write(0U));
+                bsl::ut_check(static_cast<bsl::uintmx>(6) == write(1U));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -24,8 +24,11 @@
 
 #include "../fmt_test.hpp"
 
+#include <bsl/carray.hpp>
+#include <bsl/char_type.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
 #include <bsl/is_signed.hpp>
 #include <bsl/ut.hpp>
 
@@ -1382,5 +1385,94 @@ main() noexcept -> bsl::exit_code
         };
     };
 
+    bsl::ut_scenario{"integral limits"} = [&]() noexcept {
+        bsl::ut_when{} = [&]() noexcept {
+            fmt_test::reset();
+            bsl::print() << bsl::safe_i8::min_value() << ' ' << bsl::safe_i8::max_value();
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(fmt_test::was_this_outputted("-128 127"));
+            };
+        };
+
+        bsl::ut_when{} = [&]() noexcept {
+            fmt_test::reset();
+            bsl::print() << bsl::safe_i64::min_value() << ' ' << bsl::safe_i64::max_value();
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(fmt_test::was_this_outputted(
+                    "-9223372036854775808 9223372036854775807"));
+            };
+        };
+
+        bsl::ut_when{} = [&]() noexcept {
+            fmt_test::reset();
+            bsl::print() << bsl::safe_u64::max_value();
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(fmt_test::was_this_outputted("18446744073709551615"));
+            };
+        };
+
+        bsl::ut_when{} = [&]() noexcept {
+            fmt_test::reset();
+            bsl::print() << bsl::fmt{"x", bsl::safe_i64::min_value()};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(fmt_test::was_this_outputted("-8000000000000000"));
+            };
+        };
+
+        bsl::ut_when{} = [&]() noexcept {
+            fmt_test::reset();
+            bsl::print() << bsl::fmt{"x", bsl::safe_u64::max_value()};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(fmt_test::was_this_outputted("FFFFFFFFFFFFFFFF"));
+            };
+        };
+
+        bsl::ut_when{} = [&]() noexcept {
+            fmt_test::reset();
+            bsl::print() << bsl::fmt{"b", bsl::safe_i8::min_value()};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(fmt_test::was_this_outputted("-10000000"));
+            };
+        };
+
+        bsl::ut_when{} = [&]() noexcept {
+            fmt_test::reset();
+            bsl::print() << bsl::fmt{"b", bsl::safe_u64::max_value()};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(fmt_test::was_this_outputted(
+                    "1111111111111111111111111111111111111111111111111111111111111111"));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"every number of decimal digits"} = [&]() noexcept {
+        bsl::ut_given{} = [&]() noexcept {
+            constexpr auto base10{static_cast<bsl::uint64>(10)};
+            constexpr auto max_digits{static_cast<bsl::uintmx>(20)};
+            constexpr auto max_str{static_cast<bsl::uintmx>(64)};
+
+            bsl::uint64 mut_pow{static_cast<bsl::uint64>(1)};
+            for (bsl::uintmx mut_i{}; mut_i < max_digits; ++mut_i) {
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::carray<bsl::char_type, max_str> mut_str{};
+                    fmt_test::reset();
+                    bsl::print() << mut_pow << ' ' << (mut_pow - static_cast<bsl::uint64>(1));
+                    bsl::ut_then{} = [&]() noexcept {
+                        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+                        bsl::discard(snprintf(
+                            mut_str.data(),
+                            mut_str.size(),
+                            "%llu %llu",
+                            static_cast<unsigned long long>(mut_pow),    // NOLINT
+                            static_cast<unsigned long long>(mut_pow - 1U)));    // NOLINT
+                        bsl::ut_check(fmt_test::was_this_outputted(mut_str.data()));
+                    };
+                };
+
+                mut_pow *= base10;
+            }
+        };
+    };
+
     return bsl::ut_success();
 }
@@ -411,6 +411,37 @@ namespace
             };
         };
 
+        bsl::ut_scenario{"is_valid"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(bsl::fmt_options::is_valid(""));
+                    bsl::ut_check(bsl::fmt_options::is_valid("x"));
+                    bsl::ut_check(bsl::fmt_options::is_valid("#<+#010d"));
+                    bsl::ut_check(bsl::fmt_options::is_valid("*^+#018x"));
+                    bsl::ut_check(bsl::fmt_options::is_valid(">10"));
+                    bsl::ut_check(bsl::fmt_options::is_valid("<"));
+                    bsl::ut_check(bsl::fmt_options::is_valid("0"));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(!bsl::fmt_options::is_valid("q"));
+                    bsl::ut_check(!bsl::fmt_options::is_valid("08q"));
+                    bsl::ut_check(!bsl::fmt_options::is_valid("xx"));
+                    bsl::ut_check(!bsl::fmt_options::is_valid("#<+#010dHello World"));
+                    bsl::ut_check(!bsl::fmt_options::is_valid("Hello World"));
+                    bsl::ut_check(!bsl::fmt_options::is_valid("/:"));
+                };
+            };
+
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(!bsl::fmt_options::is_valid("9999"));
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
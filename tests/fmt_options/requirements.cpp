@@ -78,6 +78,7 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(ops.sign_aware()));
                 static_assert(noexcept(ops.width()));
                 static_assert(noexcept(ops.type()));
+                static_assert(noexcept(bsl::fmt_options::is_valid("")));
             };
         };
     };
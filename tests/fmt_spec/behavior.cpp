@@ -0,0 +1,109 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/fmt.hpp>
+#include <bsl/fmt_align.hpp>
+#include <bsl/fmt_options.hpp>
+#include <bsl/fmt_sign.hpp>
+#include <bsl/fmt_spec.hpp>
+#include <bsl/fmt_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"empty spec"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                constexpr bsl::fmt_spec spec{""};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(' ' == spec.ops().fill());
+                    bsl::ut_check(bsl::fmt_align::fmt_align_default == spec.ops().align());
+                    bsl::ut_check(bsl::fmt_sign::fmt_sign_neg_only == spec.ops().sign());
+                    bsl::ut_check(!spec.ops().alternate_form());
+                    bsl::ut_check(!spec.ops().sign_aware());
+                    bsl::ut_check(spec.ops().width().is_zero());
+                    bsl::ut_check(bsl::fmt_type::fmt_type_default == spec.ops().type());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"spec matches fmt_options"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                constexpr bsl::fmt_spec spec{"*^+#018x"};
+                constexpr bsl::fmt_options ops{"*^+#018x"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(ops.fill() == spec.ops().fill());
+                    bsl::ut_check(ops.align() == spec.ops().align());
+                    bsl::ut_check(ops.sign() == spec.ops().sign());
+                    bsl::ut_check(ops.alternate_form() == spec.ops().alternate_form());
+                    bsl::ut_check(ops.sign_aware() == spec.ops().sign_aware());
+                    bsl::ut_check(ops.width() == spec.ops().width());
+                    bsl::ut_check(ops.type() == spec.ops().type());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"output using a spec"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                constexpr bsl::fmt_spec spec{"08x"};
+                constexpr auto val{42_u64};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::print() << bsl::fmt{spec, val} << bsl::endl;
+                    bsl::print() << bsl::fmt{spec, val, 4_umx} << bsl::endl;
+                    bsl::print() << bsl::fmt{"08x", val} << bsl::endl;
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
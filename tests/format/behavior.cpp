@@ -0,0 +1,122 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/cstr_type.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/fmt_align.hpp>
+#include <bsl/fmt_type.hpp>
+#include <bsl/format.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"placeholders without a spec"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                constexpr bsl::format_string<bsl::safe_u64, bool> f{"{} and {}"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::fmt_type::fmt_type_default == f.ops(0_idx).type());
+                    bsl::ut_check(bsl::fmt_type::fmt_type_default == f.ops(1_idx).type());
+                    bsl::ut_check(f.ops(0_idx).width().is_zero());
+                    bsl::ut_check(f.ops(1_idx).width().is_zero());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"placeholders with a spec"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                constexpr bsl::format_string<bsl::safe_u64, bsl::cstr_type> f{"{:#018x} at {:*>8}"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::fmt_type::fmt_type_x == f.ops(0_idx).type());
+                    bsl::ut_check(f.ops(0_idx).alternate_form());
+                    bsl::ut_check(18_umx == f.ops(0_idx).width());
+                    bsl::ut_check('*' == f.ops(1_idx).fill());
+                    bsl::ut_check(bsl::fmt_align::fmt_align_right == f.ops(1_idx).align());
+                    bsl::ut_check(8_umx == f.ops(1_idx).width());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"format a line"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                constexpr auto val{42_u64};
+                constexpr bsl::cstr_type name{"answer"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::format(bsl::print(), "{} is {} ({:#x})", name, val, val) << bsl::endl;
+                    bsl::format(bsl::print(), "{}{}{}", val, val, val) << bsl::endl;
+                    bsl::format(bsl::print(), "no placeholders") << bsl::endl;
+                    bsl::format(bsl::debug(), "{:<8}|{:^8}|", name, val) << bsl::endl;
+                    bsl::format(bsl::alert(), "{:08x}", val) << bsl::endl;
+                    bsl::format(bsl::error(), "{}", val) << bsl::endl;
+                    bsl::format(bsl::debug<bsl::V>(), "{}", val) << bsl::endl;
+                };
+            };
+        };
+
+        bsl::ut_scenario{"format each supported type"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                constexpr bsl::string_view str{"str"};
+                constexpr bsl::safe_idx idx{42_idx};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::println("{} {:c} {:d} {:>6}", true, 'c', 42, str);
+                    bsl::println("{} {:x} {} {}", idx, idx, 42_i32, bsl::safe_i32::failure());
+                    bsl::println("{} {} {}", nullptr, bsl::errc_failure, "str");
+                    bsl::println("");
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,88 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../fmt_test.hpp"
+
+#include <bsl/convert.hpp>
+#include <bsl/format.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"text and placeholders"} = []() noexcept {
+        bsl::ut_when{} = []() noexcept {
+            fmt_test::reset();
+            bsl::format(bsl::print(), "a {} b {:#x}", 42_u32, 42_u32);
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(fmt_test::was_this_outputted("a 42 b 0x2A"));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"doubled braces are written once"} = []() noexcept {
+        bsl::ut_when{} = []() noexcept {
+            fmt_test::reset();
+            bsl::format(bsl::print(), "{{}}");
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(fmt_test::was_this_outputted("{}"));
+            };
+        };
+
+        bsl::ut_when{} = []() noexcept {
+            fmt_test::reset();
+            bsl::format(bsl::print(), "{{{}}}", 42_u32);
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(fmt_test::was_this_outputted("{42}"));
+            };
+        };
+
+        bsl::ut_when{} = []() noexcept {
+            fmt_test::reset();
+            bsl::format(bsl::print(), "a {{ b }} {:x} }}}}{{", 42_u32);
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(fmt_test::was_this_outputted("a { b } 2A }}{"));
+            };
+        };
+
+        bsl::ut_when{} = []() noexcept {
+            fmt_test::reset();
+            bsl::format(bsl::print(), "{}{{x}}{}", 1_u32, 2_u32);
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(fmt_test::was_this_outputted("1{x}2"));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
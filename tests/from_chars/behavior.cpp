@@ -506,6 +506,210 @@ namespace
             }
         };
 
+        bsl::ut_scenario{"whitespace"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::string_view const str{" \t\n\v\f\r42"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::from_chars<T>(str, 10_i32) == static_cast<T>(42));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::string_view const str{"42 "};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::from_chars<T>(str, 10_i32).is_invalid());
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::string_view const str{"\b42"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::from_chars<T>(str, 10_i32).is_invalid());
+                };
+            };
+
+            if constexpr (bsl::is_signed<T>::value) {
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"  -42"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 10_i32) == static_cast<T>(-42));
+                    };
+                };
+
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"-"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 10_i32).is_invalid());
+                    };
+                };
+            }
+        };
+
+        bsl::ut_scenario{"bin"} = []() noexcept {
+            if constexpr (bsl::is_signed<T>::value) {
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"101"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 2_i32).is_invalid());
+                    };
+                };
+            }
+            else {
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"101010"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 2_i32) == static_cast<T>(42));
+                    };
+                };
+
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"0000000000101010"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 2_i32) == static_cast<T>(42));
+                    };
+                };
+
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"102"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 2_i32).is_invalid());
+                    };
+                };
+
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"/1"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 2_i32).is_invalid());
+                    };
+                };
+
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"11111111"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 2_i32) == static_cast<T>(0xFF));
+                    };
+                };
+
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{
+                        "11111111111111111111111111111111111111111111111111111111111111111"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 2_i32).is_invalid());
+                    };
+                };
+            }
+        };
+
+        bsl::ut_scenario{"oct"} = []() noexcept {
+            if constexpr (bsl::is_signed<T>::value) {
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"52"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 8_i32).is_invalid());
+                    };
+                };
+            }
+            else {
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"52"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 8_i32) == static_cast<T>(42));
+                    };
+                };
+
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"58"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 8_i32).is_invalid());
+                    };
+                };
+
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"377"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 8_i32) == static_cast<T>(0xFF));
+                    };
+                };
+
+                if constexpr (bsl::is_same<T, bsl::uint64>::value) {
+                    bsl::ut_given{} = []() noexcept {
+                        bsl::string_view const str{"1777777777777777777777"};
+                        bsl::ut_then{} = [&]() noexcept {
+                            bsl::ut_check(
+                                bsl::from_chars<T>(str, 8_i32) == bsl::safe_u64::max_value());
+                        };
+                    };
+
+                    bsl::ut_given{} = []() noexcept {
+                        bsl::string_view const str{"2000000000000000000000"};
+                        bsl::ut_then{} = [&]() noexcept {
+                            bsl::ut_check(bsl::from_chars<T>(str, 8_i32).is_invalid());
+                        };
+                    };
+                }
+            }
+        };
+
+        bsl::ut_scenario{"blocks"} = []() noexcept {
+            if constexpr (bsl::is_same<T, bsl::uint64>::value) {
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"12345678"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 10_i32) == 12345678_u64);
+                    };
+                };
+
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"123456789"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 10_i32) == 123456789_u64);
+                    };
+                };
+
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"1234567890123456"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 10_i32) == 1234567890123456_u64);
+                    };
+                };
+
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"00000000000000000000000000000042"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 10_i32) == 42_u64);
+                    };
+                };
+
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"18446744073709551616"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 10_i32).is_invalid());
+                    };
+                };
+
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"123456781234567x"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 10_i32).is_invalid());
+                    };
+                };
+
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"FfFfFfFfaBcDeF09"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 16_i32) == 0xFFFFFFFFABCDEF09_u64);
+                    };
+                };
+
+                bsl::ut_given{} = []() noexcept {
+                    bsl::string_view const str{"10000000000000000"};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::from_chars<T>(str, 16_i32).is_invalid());
+                    };
+                };
+            }
+        };
+
         return bsl::ut_success();
     }
 }
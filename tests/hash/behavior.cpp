@@ -0,0 +1,120 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/char_type.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/hash.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the raw integer used by the tests
+    constexpr bsl::uintmx ANSWER{static_cast<bsl::uintmx>(42)};
+
+    /// @brief used to test hashing enums
+    enum class test_enum : bsl::uint8
+    {
+        /// @brief a test value
+        value1 = 1,
+        /// @brief a test value
+        value2 = 2,
+    };
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"hash is deterministic"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::hash<bsl::uintmx> const hash{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(hash(ANSWER) == hash(ANSWER));
+                    bsl::ut_check(hash(ANSWER).is_valid_and_checked());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"hash spreads consecutive keys"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::hash<bsl::safe_umx> const hash{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(hash(0_umx) != hash(1_umx));
+                    bsl::ut_check(hash(1_umx) != hash(2_umx));
+                    bsl::ut_check((hash(1_umx) ^ hash(2_umx)) > 0xFFFF_umx);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"hash supported types"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::hash<bool>{}(true) != bsl::hash<bool>{}(false));
+                    bsl::ut_check(
+                        bsl::hash<bsl::char_type>{}('a') != bsl::hash<bsl::char_type>{}('b'));
+                    bsl::ut_check(bsl::hash<bsl::int32>{}(-1) != bsl::hash<bsl::int32>{}(1));
+                    bsl::ut_check(
+                        bsl::hash<bsl::uint8>{}(static_cast<bsl::uint8>(ANSWER)) ==
+                        bsl::hash<bsl::uintmx>{}(ANSWER));
+                    bsl::ut_check(
+                        bsl::hash<bsl::safe_i32>{}(42_i32) ==
+                        bsl::hash<bsl::int32>{}(static_cast<bsl::int32>(ANSWER)));
+                    bsl::ut_check(
+                        bsl::hash<bsl::safe_idx>{}(bsl::safe_idx{ANSWER}) ==
+                        bsl::hash<bsl::uintmx>{}(ANSWER));
+                    bsl::ut_check(
+                        bsl::hash<test_enum>{}(test_enum::value1) !=
+                        bsl::hash<test_enum>{}(test_enum::value2));
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
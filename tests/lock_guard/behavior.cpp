@@ -0,0 +1,111 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/cstdint.hpp>
+#include <bsl/lock_guard.hpp>
+#include <bsl/mcs_lock.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @class test_lock
+    ///
+    /// <!-- description -->
+    ///   @brief A lock that counts the calls to lock() and unlock()
+    ///
+    class test_lock final
+    {
+    public:
+        /// @brief stores the total number of calls to lock()
+        bsl::uintmx m_locks{};
+        /// @brief stores the total number of calls to unlock()
+        bsl::uintmx m_unlocks{};
+
+        /// <!-- description -->
+        ///   @brief Counts a call to lock()
+        ///
+        void
+        lock() noexcept
+        {
+            ++m_locks;
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts a call to unlock()
+        ///
+        void
+        unlock() noexcept
+        {
+            ++m_unlocks;
+        }
+    };
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"locks on construction and unlocks on destruction"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            test_lock mut_lock{};
+            bsl::ut_then{} = [&]() noexcept {
+                {
+                    bsl::lock_guard const guard{mut_lock};
+                    bsl::ut_check(1U == mut_lock.m_locks);
+                    bsl::ut_check(0U == mut_lock.m_unlocks);
+                }
+
+                bsl::ut_check(1U == mut_lock.m_locks);
+                bsl::ut_check(1U == mut_lock.m_unlocks);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"nested guards of an mcs_lock"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::mcs_lock mut_lock1{};
+            bsl::mcs_lock mut_lock2{};
+            bsl::ut_then{} = [&]() noexcept {
+                {
+                    bsl::lock_guard const guard1{mut_lock1};
+                    bsl::lock_guard const guard2{mut_lock2};
+                    bsl::ut_check(mut_lock1.is_locked());
+                    bsl::ut_check(mut_lock2.is_locked());
+                }
+
+                bsl::ut_check(!mut_lock1.is_locked());
+                bsl::ut_check(!mut_lock2.is_locked());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,154 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BSL_LOCK_STATS
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/lock_guard.hpp>
+#include <bsl/lock_stats.hpp>
+#include <bsl/mcs_lock.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/spinlock.hpp>
+#include <bsl/ticket_lock.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(bsl::LOCK_STATS_ENABLED);
+
+    bsl::ut_scenario{"empty stats"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::lock_stats const stats{};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(stats.acquisitions().is_zero());
+                bsl::ut_check(stats.contended().is_zero());
+                bsl::ut_check(stats.spins().is_zero());
+                bsl::ut_check(stats.max_hold_cycles().is_zero());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"record acquisitions and releases"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::lock_stats mut_stats{};
+            bsl::ut_then{} = [&]() noexcept {
+                mut_stats.record_acquire(false, {});
+                mut_stats.record_release();
+                mut_stats.record_acquire(true, static_cast<bsl::uint64>(3));
+                mut_stats.record_release();
+                mut_stats.record_acquire(true, static_cast<bsl::uint64>(4));
+                mut_stats.record_release();
+
+                bsl::ut_check(3_u64 == mut_stats.acquisitions());
+                bsl::ut_check(2_u64 == mut_stats.contended());
+                bsl::ut_check(7_u64 == mut_stats.spins());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"contention does not depend on spinning"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::lock_stats mut_stats{};
+            bsl::ut_then{} = [&]() noexcept {
+                mut_stats.record_acquire(true, {});
+                mut_stats.record_release();
+
+                bsl::ut_check(1_u64 == mut_stats.acquisitions());
+                bsl::ut_check(1_u64 == mut_stats.contended());
+                bsl::ut_check(mut_stats.spins().is_zero());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"max hold cycles never goes down"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::lock_stats mut_stats{};
+            bsl::ut_then{} = [&]() noexcept {
+                mut_stats.record_acquire(false, {});
+                mut_stats.record_release();
+                auto const max{mut_stats.max_hold_cycles()};
+
+                mut_stats.record_acquire(false, {});
+                mut_stats.record_release();
+                bsl::ut_check(max <= mut_stats.max_hold_cycles());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"every lock records its stats"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::spinlock mut_spinlock{};
+            bsl::ticket_lock mut_ticket_lock{};
+            bsl::mcs_lock mut_mcs_lock{};
+            bsl::mcs_node mut_node{};
+            bsl::ut_when{} = [&]() noexcept {
+                {
+                    bsl::lock_guard const guard1{mut_spinlock};
+                    bsl::lock_guard const guard2{mut_ticket_lock};
+                    bsl::lock_guard const guard3{mut_mcs_lock};
+                }
+
+                bsl::ut_check(mut_spinlock.try_lock());
+                mut_spinlock.unlock();
+                bsl::ut_check(mut_ticket_lock.try_lock());
+                mut_ticket_lock.unlock();
+                bsl::ut_check(mut_mcs_lock.try_lock(mut_node));
+                mut_mcs_lock.unlock(mut_node);
+
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(2_u64 == mut_spinlock.stats().acquisitions());
+                    bsl::ut_check(2_u64 == mut_ticket_lock.stats().acquisitions());
+                    bsl::ut_check(2_u64 == mut_mcs_lock.stats().acquisitions());
+                    bsl::ut_check(mut_spinlock.stats().contended().is_zero());
+                    bsl::ut_check(mut_ticket_lock.stats().contended().is_zero());
+                    bsl::ut_check(mut_mcs_lock.stats().contended().is_zero());
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"output doesn't crash"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::spinlock mut_lock{};
+            bsl::ut_then{} = [&]() noexcept {
+                mut_lock.lock();
+                mut_lock.unlock();
+                bsl::print() << mut_lock.stats() << bsl::endl;
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,75 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/cstdint.hpp>
+#include <bsl/lock_stats.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::lock_stats mut_stats{};
+            bsl::lock_stats const stats{};
+            bsl::ut_then{} = []() noexcept {
+                static_assert(noexcept(bsl::lock_stats{}));
+
+                static_assert(noexcept(mut_stats.record_acquire(false, {})));
+                static_assert(noexcept(mut_stats.record_release()));
+
+                static_assert(noexcept(stats.acquisitions()));
+                static_assert(noexcept(stats.contended()));
+                static_assert(noexcept(stats.spins()));
+                static_assert(noexcept(stats.max_hold_cycles()));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"stats are disabled by default"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::lock_stats mut_stats{};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(!bsl::LOCK_STATS_ENABLED);
+
+                mut_stats.record_acquire(true, static_cast<bsl::uint64>(42));
+                mut_stats.record_release();
+                bsl::ut_check(mut_stats.acquisitions().is_zero());
+                bsl::ut_check(mut_stats.contended().is_zero());
+                bsl::ut_check(mut_stats.spins().is_zero());
+                bsl::ut_check(mut_stats.max_hold_cycles().is_zero());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,128 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef TESTS_LOCK_STRESS_HPP
+#define TESTS_LOCK_STRESS_HPP
+
+#include <pthread.h>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/lock_guard.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+/// NOTE:
+/// - NUM_THREADS threads each take the lock PER_THREAD times, and while
+///   holding it, bump two plain (non-atomic) counters. If the lock ever
+///   lets two threads in at once, increments are lost and the counters
+///   drift apart.
+/// - Waiters spin without yielding, so on a machine with a single core
+///   each hand-off to a thread that is not running costs a time slice.
+///   PER_THREAD is kept small so that the test still finishes quickly.
+/// - Each lock's stress test includes this header, and then adds the
+///   checks that only apply to that lock.
+///
+
+namespace lock_stress
+{
+    /// @brief defines the total number of threads
+    constexpr bsl::uintmx NUM_THREADS{static_cast<bsl::uintmx>(4)};
+    /// @brief defines the total number of times each thread takes the lock
+    constexpr auto PER_THREAD{1000_u64};
+
+    /// @brief stores the first counter protected by the lock
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    constinit inline bsl::uint64 g_mut_count1{};
+    /// @brief stores the second counter protected by the lock
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    constinit inline bsl::uint64 g_mut_count2{};
+
+    /// <!-- description -->
+    ///   @brief Takes the lock PER_THREAD times, bumping the counters
+    ///     each time.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LOCK the type of lock being tested
+    ///   @param pmut_arg the lock being tested
+    ///   @return Always returns a nullptr
+    ///
+    template<typename LOCK>
+    [[nodiscard]] auto
+    worker(void *const pmut_arg) noexcept -> void *
+    {
+        auto *const pmut_lock{static_cast<LOCK *>(pmut_arg)};
+
+        for (bsl::safe_u64 mut_i{}; mut_i < PER_THREAD; mut_i = (mut_i + 1_u64).checked()) {
+            bsl::lock_guard mut_guard{*pmut_lock};
+            ++g_mut_count1;
+            ++g_mut_count2;
+        }
+
+        return nullptr;
+    }
+
+    /// <!-- description -->
+    ///   @brief Runs NUM_THREADS workers on the provided lock, and checks
+    ///     that no increment was lost. The lock must not have been used
+    ///     before, as its statistics are checked as well.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LOCK the type of lock being tested
+    ///   @param mut_lock the lock being tested
+    ///
+    template<typename LOCK>
+    void
+    many_threads(LOCK &mut_lock) noexcept
+    {
+        bsl::ut_scenario{"many threads sharing a lock"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                bsl::array<pthread_t, NUM_THREADS> mut_threads{};
+                bsl::ut_when{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+                        auto *const pmut_t{mut_threads.at_if(mut_i)};
+                        bsl::ut_check(
+                            0 == pthread_create(pmut_t, nullptr, &worker<LOCK>, &mut_lock));
+                    }
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        for (bsl::safe_idx mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+                            bsl::ut_check(0 == pthread_join(*mut_threads.at_if(mut_i), nullptr));
+                        }
+
+                        auto const total{(PER_THREAD * bsl::to_u64(NUM_THREADS)).checked()};
+                        bsl::ut_check(total == g_mut_count1);
+                        bsl::ut_check(total == g_mut_count2);
+                        bsl::ut_check(total == mut_lock.stats().acquisitions());
+                        bsl::ut_check(!mut_lock.is_locked());
+                    };
+                };
+            };
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,282 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BSL_LOG_RING
+
+#include <bsl/carray.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/details/log_ring.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/log_ring.hpp>
+#include <bsl/npos.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of a string that needs more than one record
+    constexpr bsl::uintmx LONG_STR_SIZE{
+        bsl::details::LOG_RECORD_SIZE +
+        (bsl::details::LOG_RECORD_SIZE / static_cast<bsl::uintmx>(2))};
+
+    /// @brief used to test long strings
+    constinit bsl::carray<bsl::char_type, LONG_STR_SIZE> g_mut_long_str{};
+
+    /// <!-- description -->
+    ///   @brief Drains all of the log rings and throws away the records.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the total number of records that were drained
+    ///
+    [[nodiscard]] auto
+    drain_all() noexcept -> bsl::safe_umx
+    {
+        return bsl::log_drain([](bsl::safe_u64 const &seq,
+                                 bsl::safe_umx const &level,
+                                 bsl::string_view const &msg) noexcept {
+            bsl::discard(seq);
+            bsl::discard(level);
+            bsl::discard(msg);
+        });
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"nothing to drain"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(drain_all() == bsl::safe_umx::magic_0());
+                bsl::ut_check(bsl::log_dropped() == bsl::safe_umx::magic_0());
+                bsl::ut_check(bsl::log_fallbacks() == bsl::safe_umx::magic_0());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"print goes to the log ring"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::print() << "hello " << 42_umx << bsl::endl;
+            bsl::ut_then{} = []() noexcept {
+                bsl::safe_umx mut_count{};
+                bsl::ut_check(
+                    bsl::log_drain([&mut_count](
+                                       bsl::safe_u64 const &seq,
+                                       bsl::safe_umx const &level,
+                                       bsl::string_view const &msg) noexcept {
+                        bsl::discard(seq);
+                        bsl::ut_check(level == bsl::CRITICAL_ONLY);
+                        bsl::ut_check(msg == "hello 42\n");
+                        ++mut_count;
+                    }) == bsl::safe_umx::magic_1());
+                bsl::ut_check(mut_count.checked() == bsl::safe_umx::magic_1());
+                bsl::ut_check(drain_all() == bsl::safe_umx::magic_0());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"records keep the label and thread id prefix"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::debug() << "42\n";
+            bsl::alert() << "42\n";
+            bsl::error() << "42\n";
+            bsl::ut_then{} = []() noexcept {
+                constexpr bsl::carray<bsl::cstr_type, 3> labels{"DEBUG", "ALERT", "ERROR"};
+                bsl::uintmx mut_i{};
+                bsl::ut_check(
+                    bsl::log_drain([&mut_i, &labels](
+                                       bsl::safe_u64 const &seq,
+                                       bsl::safe_umx const &level,
+                                       bsl::string_view const &msg) noexcept {
+                        bsl::discard(seq);
+                        bsl::ut_check(level == bsl::CRITICAL_ONLY);
+                        bsl::ut_check(msg.find(*labels.at_if(mut_i)) != bsl::npos);
+                        bsl::ut_check(msg.ends_with(": 42\n"));
+                        ++mut_i;
+                    }) == bsl::safe_umx::magic_3());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"records are drained in order"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::print() << "1\n";
+            bsl::print() << "2" << '\n' << "3\n";
+            bsl::ut_then{} = []() noexcept {
+                bsl::safe_u64 mut_last{};
+                bsl::safe_umx mut_count{};
+                bsl::ut_check(
+                    bsl::log_drain([&mut_last, &mut_count](
+                                       bsl::safe_u64 const &seq,
+                                       bsl::safe_umx const &level,
+                                       bsl::string_view const &msg) noexcept {
+                        bsl::discard(level);
+                        if (mut_count.checked().is_pos()) {
+                            bsl::ut_check(seq > mut_last);
+                        }
+                        else {
+                            bsl::touch();
+                        }
+
+                        bsl::ut_check(msg.size() == bsl::safe_umx::magic_2());
+                        mut_last = seq;
+                        ++mut_count;
+                    }) == bsl::safe_umx::magic_3());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"a newline inside of a string ends a record"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::print() << "1\n2\n" << "3";
+            bsl::ut_then{} = []() noexcept {
+                constexpr bsl::carray<bsl::cstr_type, 3> lines{"1\n", "2\n", "3"};
+                bsl::uintmx mut_i{};
+                bsl::ut_check(
+                    bsl::log_drain([&mut_i, &lines](
+                                       bsl::safe_u64 const &seq,
+                                       bsl::safe_umx const &level,
+                                       bsl::string_view const &msg) noexcept {
+                        bsl::discard(seq);
+                        bsl::discard(level);
+                        bsl::ut_check(msg == *lines.at_if(mut_i));
+                        ++mut_i;
+                    }) == bsl::safe_umx::magic_3());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"debug level is kept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::ut_check(bsl::details::log_ring_write("42\n", 3U, bsl::VV));
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(
+                    bsl::log_drain([](bsl::safe_u64 const &seq,
+                                      bsl::safe_umx const &level,
+                                      bsl::string_view const &msg) noexcept {
+                        bsl::discard(seq);
+                        bsl::discard(msg);
+                        bsl::ut_check(level == bsl::VV);
+                    }) == bsl::safe_umx::magic_1());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"long strings are split"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            for (bsl::uintmx mut_i{}; mut_i < g_mut_long_str.size(); ++mut_i) {
+                *g_mut_long_str.at_if(mut_i) = '*';
+            }
+            bsl::print() << bsl::string_view{g_mut_long_str.data(), bsl::to_umx(LONG_STR_SIZE)};
+            bsl::ut_then{} = []() noexcept {
+                bsl::safe_umx mut_total{};
+                bsl::ut_check(
+                    bsl::log_drain([&mut_total](
+                                       bsl::safe_u64 const &seq,
+                                       bsl::safe_umx const &level,
+                                       bsl::string_view const &msg) noexcept {
+                        bsl::discard(seq);
+                        bsl::discard(level);
+                        mut_total += msg.size();
+                    }) == bsl::safe_umx::magic_2());
+                bsl::ut_check(mut_total.checked() == LONG_STR_SIZE);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"full rings drop records"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            constexpr auto extra{static_cast<bsl::uintmx>(2)};
+            for (bsl::uintmx mut_i{}; mut_i < bsl::details::LOG_RING_SIZE + extra; ++mut_i) {
+                bsl::print() << "42\n";
+            }
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(bsl::log_dropped() == extra);
+                bsl::ut_check(drain_all() == bsl::details::LOG_RING_SIZE);
+                bsl::ut_check(drain_all() == bsl::safe_umx::magic_0());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"no log ring falls back to the console"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::details::g_mut_log_ring_owner.release();
+            for (bsl::uintmx mut_i{}; mut_i < bsl::details::LOG_RING_TOTAL; ++mut_i) {
+                bsl::ut_check(bsl::details::g_mut_log_rings.at_if(mut_i)->try_claim());
+            }
+            bsl::ut_when{} = []() noexcept {
+                bsl::print() << "42\n";
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(drain_all() == bsl::safe_umx::magic_0());
+                    bsl::ut_check(bsl::log_fallbacks() == bsl::safe_umx::magic_1());
+                };
+            };
+            bsl::ut_when{} = []() noexcept {
+                bsl::details::g_mut_log_rings.at_if(bsl::uintmx{})->release();
+                bsl::print() << "42\n";
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(drain_all() == bsl::safe_umx::magic_1());
+                    bsl::ut_check(bsl::log_fallbacks() == bsl::safe_umx::magic_1());
+                };
+            };
+            constexpr auto first{static_cast<bsl::uintmx>(1)};
+            for (bsl::uintmx mut_i{first}; mut_i < bsl::details::LOG_RING_TOTAL; ++mut_i) {
+                bsl::details::g_mut_log_rings.at_if(mut_i)->release();
+            }
+        };
+    };
+
+    bsl::ut_scenario{"a log ring on its own"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            static bsl::details::log_ring s_mut_ring{};
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(nullptr == s_mut_ring.front());
+                bsl::ut_check(s_mut_ring.push(42U, bsl::V, "42", 2U));
+                auto const *const rec{s_mut_ring.front()};
+                bsl::ut_check(nullptr != rec);
+                bsl::ut_check(42U == rec->m_seq);
+                bsl::ut_check(bsl::V == rec->m_level);
+                bsl::ut_check(2U == rec->m_size);
+                s_mut_ring.pop();
+                bsl::ut_check(nullptr == s_mut_ring.front());
+                bsl::ut_check(0U == s_mut_ring.dropped());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
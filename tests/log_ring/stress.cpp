@@ -0,0 +1,173 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BSL_LOG_RING
+
+#include <pthread.h>
+
+#include <bsl/array.hpp>
+#include <bsl/atomic.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/details/log_ring.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/log_ring.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+/// NOTE:
+/// - More threads than there are log rings write output, a batch at a
+///   time. Each thread gives its ring back when it exits, so every line
+///   must end up in a ring and none may fall back to the console.
+/// - A producer writes output as fast as it can while the consumer
+///   drains. Each call to bsl::log_drain() must still return.
+///
+
+namespace
+{
+    /// @brief defines the total number of threads in a batch
+    constexpr bsl::uintmx NUM_THREADS{static_cast<bsl::uintmx>(8)};
+    /// @brief defines the total number of batches
+    constexpr bsl::uintmx NUM_BATCHES{static_cast<bsl::uintmx>(8)};
+    /// @brief defines the total number of times the consumer drains
+    constexpr bsl::uintmx NUM_DRAINS{static_cast<bsl::uintmx>(1000)};
+
+    static_assert(NUM_THREADS * NUM_BATCHES > bsl::details::LOG_RING_TOTAL);
+
+    /// @brief stores whether the busy producer should stop
+    constinit bsl::atomic<bsl::uint32> g_mut_stop{};
+
+    /// <!-- description -->
+    ///   @brief Drains all of the log rings and throws away the records.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the total number of records that were drained
+    ///
+    [[nodiscard]] auto
+    drain_all() noexcept -> bsl::safe_umx
+    {
+        return bsl::log_drain([](bsl::safe_u64 const &seq,
+                                 bsl::safe_umx const &level,
+                                 bsl::string_view const &msg) noexcept {
+            bsl::discard(seq);
+            bsl::discard(level);
+            bsl::discard(msg);
+        });
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes a single line and exits.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_arg unused
+    ///   @return Always returns a nullptr
+    ///
+    [[nodiscard]] auto
+    writer(void *const pmut_arg) noexcept -> void *
+    {
+        bsl::discard(pmut_arg);
+        bsl::print() << "42\n";
+        return nullptr;
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes lines until g_mut_stop is set.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_arg unused
+    ///   @return Always returns a nullptr
+    ///
+    [[nodiscard]] auto
+    busy_writer(void *const pmut_arg) noexcept -> void *
+    {
+        bsl::discard(pmut_arg);
+        while (g_mut_stop.load().is_zero()) {
+            bsl::print() << "42\n";
+        }
+
+        return nullptr;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"threads give their log ring back when they exit"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::array<pthread_t, NUM_THREADS> mut_threads{};
+            bsl::ut_when{} = [&]() noexcept {
+                for (bsl::safe_idx mut_b{}; mut_b < NUM_BATCHES; ++mut_b) {
+                    for (bsl::safe_idx mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+                        auto *const pmut_t{mut_threads.at_if(mut_i)};
+                        bsl::ut_check(0 == pthread_create(pmut_t, nullptr, &writer, nullptr));
+                    }
+
+                    for (bsl::safe_idx mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+                        bsl::ut_check(0 == pthread_join(*mut_threads.at_if(mut_i), nullptr));
+                    }
+                }
+
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const total{bsl::to_umx(NUM_THREADS * NUM_BATCHES)};
+                    bsl::ut_check(bsl::log_fallbacks() == bsl::safe_umx::magic_0());
+                    bsl::ut_check(bsl::log_dropped() == bsl::safe_umx::magic_0());
+                    bsl::ut_check(drain_all() == total);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"a busy producer cannot starve log_drain"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            pthread_t mut_thread{};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::ut_check(0 == pthread_create(&mut_thread, nullptr, &busy_writer, nullptr));
+                for (bsl::safe_idx mut_i{}; mut_i < NUM_DRAINS; ++mut_i) {
+                    bsl::discard(drain_all());
+                }
+
+                g_mut_stop.store(1_u32);
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(0 == pthread_join(mut_thread, nullptr));
+                    bsl::discard(drain_all());
+                    bsl::ut_check(drain_all() == bsl::safe_umx::magic_0());
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,120 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/lock_guard.hpp>
+#include <bsl/mcs_lock.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"lock and unlock"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::mcs_lock mut_lock{};
+            bsl::mcs_node mut_node{};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(!mut_lock.is_locked());
+                mut_lock.lock(mut_node);
+                bsl::ut_check(mut_lock.is_locked());
+                mut_lock.unlock(mut_node);
+                bsl::ut_check(!mut_lock.is_locked());
+                mut_lock.lock(mut_node);
+                mut_lock.unlock(mut_node);
+                bsl::ut_check(!mut_lock.is_locked());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"try_lock"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::mcs_lock mut_lock{};
+            bsl::mcs_node mut_node1{};
+            bsl::mcs_node mut_node2{};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(mut_lock.try_lock(mut_node1));
+                bsl::ut_check(mut_lock.is_locked());
+                bsl::ut_check(!mut_lock.try_lock(mut_node2));
+                mut_lock.unlock(mut_node1);
+                bsl::ut_check(mut_lock.try_lock(mut_node2));
+                mut_lock.unlock(mut_node2);
+                bsl::ut_check(!mut_lock.is_locked());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"lock_guard"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::mcs_lock mut_lock{};
+            bsl::mcs_node mut_node{};
+            bsl::ut_then{} = [&]() noexcept {
+                {
+                    bsl::lock_guard const guard{mut_lock};
+                    bsl::ut_check(mut_lock.is_locked());
+                    bsl::ut_check(!mut_lock.try_lock(mut_node));
+                }
+
+                bsl::ut_check(!mut_lock.is_locked());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"has_waiter"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::mcs_lock mut_lock{};
+            bsl::mcs_node mut_node1{};
+            bsl::mcs_node mut_node2{};
+            bsl::ut_then{} = [&]() noexcept {
+                mut_lock.lock(mut_node1);
+                bsl::ut_check(!bsl::mcs_lock::has_waiter(mut_node1));
+                bsl::ut_check(!mut_lock.try_lock(mut_node2));
+                bsl::ut_check(!bsl::mcs_lock::has_waiter(mut_node1));
+                mut_lock.unlock(mut_node1);
+                bsl::ut_check(!mut_lock.is_locked());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"stats are not recorded by default"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::mcs_lock mut_lock{};
+            bsl::mcs_node mut_node{};
+            bsl::ut_then{} = [&]() noexcept {
+                mut_lock.lock(mut_node);
+                mut_lock.unlock(mut_node);
+                bsl::ut_check(mut_lock.stats().acquisitions().is_zero());
+                bsl::ut_check(mut_lock.stats().max_hold_cycles().is_zero());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
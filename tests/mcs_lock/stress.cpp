@@ -0,0 +1,164 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BSL_LOCK_STATS
+
+#include <bsl/mcs_lock.hpp>
+
+#include "../lock_stress.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+/// NOTE:
+/// - To check that waiters are served in the order they joined the
+///   queue, main holds the lock and starts NUM_WAITERS threads one at a
+///   time, waiting for each to link its node behind the previous one
+///   (see has_waiter()) before starting the next. When main releases
+///   the lock, each waiter records its index, which must come out in
+///   the order the threads were started.
+/// - Every waiter also records whether its node still had a waiter
+///   linked behind it when it was about to unlock, which means the lock
+///   was handed directly to the next node instead of being released.
+/// - Every waiter joined the queue behind another node, so each of them
+///   (and not main) must be counted as contended, no matter how long it
+///   had to spin.
+///
+
+namespace
+{
+    /// @brief defines the total number of threads queued behind main
+    constexpr bsl::uintmx NUM_WAITERS{static_cast<bsl::uintmx>(4)};
+
+    /// @brief stores the lock being stress tested
+    constinit bsl::mcs_lock g_mut_lock{};
+    /// @brief stores the lock that is checked for queue order
+    constinit bsl::mcs_lock g_mut_fifo_lock{};
+    /// @brief stores the node of each waiter
+    constinit bsl::array<bsl::mcs_node, NUM_WAITERS> g_mut_nodes{};
+    /// @brief stores the index of each waiter, given to each thread
+    constinit bsl::array<bsl::safe_idx, NUM_WAITERS> g_mut_ids{};
+    /// @brief stores the index of each waiter in the order it got the lock
+    constinit bsl::array<bsl::safe_idx, NUM_WAITERS> g_mut_order{};
+    /// @brief stores true for each waiter that handed the lock to a node
+    constinit bsl::array<bool, NUM_WAITERS> g_mut_handed_off{};
+    /// @brief stores the total number of entries in g_mut_order
+    constinit bsl::safe_idx g_mut_order_size{};
+
+    /// <!-- description -->
+    ///   @brief Takes g_mut_fifo_lock once using this waiter's node, and
+    ///     records the index of this waiter in g_mut_order while
+    ///     holding it.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_arg the index of this waiter
+    ///   @return Always returns a nullptr
+    ///
+    [[nodiscard]] auto
+    fifo_worker(void *const pmut_arg) noexcept -> void *
+    {
+        auto const *const id{static_cast<bsl::safe_idx const *>(pmut_arg)};
+        auto *const pmut_node{g_mut_nodes.at_if(*id)};
+
+        g_mut_fifo_lock.lock(*pmut_node);
+        *g_mut_order.at_if(g_mut_order_size) = *id;
+        *g_mut_handed_off.at_if(*id) = bsl::mcs_lock::has_waiter(*pmut_node);
+        ++g_mut_order_size;
+        g_mut_fifo_lock.unlock(*pmut_node);
+
+        return nullptr;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    lock_stress::many_threads(g_mut_lock);
+
+    bsl::ut_scenario{"waiters are served in queue order"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::array<pthread_t, NUM_WAITERS> mut_threads{};
+            bsl::mcs_node mut_node{};
+            bsl::ut_when{} = [&]() noexcept {
+                g_mut_fifo_lock.lock(mut_node);
+                bsl::mcs_node const *mut_prev{&mut_node};
+                for (bsl::safe_idx mut_i{}; mut_i < NUM_WAITERS; ++mut_i) {
+                    auto *const pmut_id{g_mut_ids.at_if(mut_i)};
+                    *pmut_id = mut_i;
+
+                    auto *const pmut_t{mut_threads.at_if(mut_i)};
+                    bsl::ut_check(0 == pthread_create(pmut_t, nullptr, &fifo_worker, pmut_id));
+
+                    while (!bsl::mcs_lock::has_waiter(*mut_prev)) {
+                        bsl::discard(sched_yield());
+                    }
+
+                    mut_prev = g_mut_nodes.at_if(mut_i);
+                }
+
+                g_mut_fifo_lock.unlock(mut_node);
+
+                bsl::ut_then{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < NUM_WAITERS; ++mut_i) {
+                        bsl::ut_check(0 == pthread_join(*mut_threads.at_if(mut_i), nullptr));
+                    }
+
+                    bsl::ut_check(NUM_WAITERS == g_mut_order_size.get());
+                    for (bsl::safe_idx mut_i{}; mut_i < NUM_WAITERS; ++mut_i) {
+                        bsl::ut_check(mut_i == *g_mut_order.at_if(mut_i));
+                    }
+
+                    constexpr bsl::safe_idx last{NUM_WAITERS - static_cast<bsl::uintmx>(1)};
+                    for (bsl::safe_idx mut_i{}; mut_i < last; ++mut_i) {
+                        bsl::ut_check(*g_mut_handed_off.at_if(mut_i));
+                    }
+
+                    bsl::ut_check(!*g_mut_handed_off.at_if(last));
+
+                    auto const waiters{bsl::to_u64(NUM_WAITERS)};
+                    bsl::ut_check(waiters == g_mut_fifo_lock.stats().contended());
+                    bsl::ut_check(!g_mut_fifo_lock.is_locked());
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
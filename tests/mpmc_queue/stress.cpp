@@ -0,0 +1,176 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/mpmc_queue.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+/// NOTE:
+/// - NUM_THREADS producer threads each push PER_PRODUCER values, tagged
+///   with the producer that pushed them, while NUM_THREADS consumer
+///   threads pop them. The queue is much smaller than the total, so all
+///   of the threads spend most of the test running into a full (or
+///   empty) queue, at which point they yield so that the test also
+///   finishes quickly on a machine with a single core. Every value must
+///   come out exactly once, and each consumer must see the values of a
+///   given producer in the order they were pushed.
+///
+
+namespace
+{
+    /// @brief defines the max number of elements in the queue
+    constexpr bsl::uintmx QUEUE_N{static_cast<bsl::uintmx>(64)};
+    /// @brief defines the total number of producers (and consumers)
+    constexpr bsl::uintmx NUM_THREADS{static_cast<bsl::uintmx>(4)};
+    /// @brief defines the total number of values each producer pushes
+    constexpr auto PER_PRODUCER{250000_u64};
+    /// @brief defines the total number of values pushed through the queue
+    constexpr auto TOTAL{(PER_PRODUCER * bsl::to_u64(NUM_THREADS)).checked()};
+
+    /// @brief stores the queue being tested
+    constinit bsl::mpmc_queue<bsl::safe_u64, QUEUE_N> g_mut_queue{};
+    /// @brief stores the total number of values that have been popped
+    constinit bsl::uint64 g_mut_popped{};
+    /// @brief stores the sum of all of the values that have been popped
+    constinit bsl::uint64 g_mut_sum{};
+    /// @brief stores the total number of values seen out of order
+    constinit bsl::uint64 g_mut_out_of_order{};
+
+    /// <!-- description -->
+    ///   @brief Pushes the values of the producer with the provided id
+    ///     onto the queue, spinning while the queue is full. The value
+    ///     pushed is (id * PER_PRODUCER) + i.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_arg the id of the producer
+    ///   @return Always returns a nullptr
+    ///
+    [[nodiscard]] auto
+    producer(void *const pmut_arg) noexcept -> void *
+    {
+        auto const *const id{static_cast<bsl::safe_u64 const *>(pmut_arg)};
+        auto const base{(*id * PER_PRODUCER).checked()};
+
+        for (bsl::safe_u64 mut_i{}; mut_i < PER_PRODUCER; mut_i = (mut_i + 1_u64).checked()) {
+            while (!g_mut_queue.try_push((base + mut_i).checked())) {
+                bsl::discard(sched_yield());
+            }
+        }
+
+        return nullptr;
+    }
+
+    /// <!-- description -->
+    ///   @brief Pops values from the queue until every value has been
+    ///     popped, adding each one to g_mut_sum and checking that the
+    ///     values of each producer are seen in order.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_arg ignored
+    ///   @return Always returns a nullptr
+    ///
+    [[nodiscard]] auto
+    consumer(void *const pmut_arg) noexcept -> void *
+    {
+        constexpr auto one{static_cast<bsl::uint64>(1)};
+        bsl::discard(pmut_arg);
+
+        bsl::array<bsl::safe_u64, NUM_THREADS> mut_next{};
+        bsl::safe_u64 mut_val{};
+
+        while (__atomic_load_n(&g_mut_popped, __ATOMIC_RELAXED) < TOTAL.get()) {
+            if (!g_mut_queue.try_pop(mut_val)) {
+                bsl::discard(sched_yield());
+                continue;
+            }
+
+            auto const id{(mut_val / PER_PRODUCER).checked()};
+            auto *const pmut_next{mut_next.at_if(bsl::to_idx(id))};
+            if (mut_val < *pmut_next) {
+                bsl::discard(__atomic_fetch_add(&g_mut_out_of_order, one, __ATOMIC_RELAXED));
+            }
+
+            *pmut_next = (mut_val + 1_u64).checked();
+            bsl::discard(__atomic_fetch_add(&g_mut_sum, mut_val.get(), __ATOMIC_RELAXED));
+            bsl::discard(__atomic_fetch_add(&g_mut_popped, one, __ATOMIC_RELAXED));
+        }
+
+        return nullptr;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"many producers and many consumers"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::array<pthread_t, NUM_THREADS> mut_producers{};
+            bsl::array<pthread_t, NUM_THREADS> mut_consumers{};
+            bsl::array<bsl::safe_u64, NUM_THREADS> mut_ids{};
+            bsl::ut_when{} = [&]() noexcept {
+                for (bsl::safe_idx mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+                    *mut_ids.at_if(mut_i) = bsl::to_u64(mut_i.get());
+                    auto *const pmut_id{mut_ids.at_if(mut_i)};
+
+                    auto *const pmut_p{mut_producers.at_if(mut_i)};
+                    bsl::ut_check(0 == pthread_create(pmut_p, nullptr, &producer, pmut_id));
+
+                    auto *const pmut_c{mut_consumers.at_if(mut_i)};
+                    bsl::ut_check(0 == pthread_create(pmut_c, nullptr, &consumer, nullptr));
+                }
+
+                bsl::ut_then{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+                        bsl::ut_check(0 == pthread_join(*mut_producers.at_if(mut_i), nullptr));
+                        bsl::ut_check(0 == pthread_join(*mut_consumers.at_if(mut_i), nullptr));
+                    }
+
+                    auto const sum{((TOTAL * (TOTAL - 1_u64)) / 2_u64).checked()};
+                    bsl::ut_check(TOTAL == g_mut_popped);
+                    bsl::ut_check(sum == g_mut_sum);
+                    bsl::ut_check(0U == g_mut_out_of_order);
+                    bsl::ut_check(g_mut_queue.empty());
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,232 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/object_pool.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the max number of objects used by the tests
+    constexpr bsl::uintmx TEST_N{static_cast<bsl::uintmx>(4)};
+
+    /// @brief stores the number of test_elem objects that are alive
+    constinit bsl::safe_i32 g_mut_alive{};
+
+    /// @class test_elem
+    ///
+    /// <!-- description -->
+    ///   @brief A non-trivial element type that keeps track of how many
+    ///     of it are alive.
+    ///
+    class test_elem final
+    {
+        /// @brief stores the value of this element
+        bsl::safe_i32 m_val{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a test_elem
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value of this element
+        ///
+        explicit test_elem(bsl::safe_i32 const &val = {}) noexcept    // --
+            : m_val{val}
+        {
+            g_mut_alive = (g_mut_alive + bsl::safe_i32::magic_1()).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroys a test_elem
+        ///
+        ~test_elem() noexcept
+        {
+            g_mut_alive = (g_mut_alive - bsl::safe_i32::magic_1()).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        test_elem(test_elem const &o) noexcept    // --
+            : m_val{o.m_val}
+        {
+            g_mut_alive = (g_mut_alive + bsl::safe_i32::magic_1()).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        test_elem(test_elem &&mut_o) noexcept    // --
+            : m_val{mut_o.m_val}
+        {
+            g_mut_alive = (g_mut_alive + bsl::safe_i32::magic_1()).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(test_elem const &o) &noexcept -> test_elem & = default;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(test_elem &&mut_o) &noexcept -> test_elem & = default;
+
+        /// <!-- description -->
+        ///   @brief Returns the value of this element
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of this element
+        ///
+        [[nodiscard]] auto
+        val() const noexcept -> bsl::safe_i32 const &
+        {
+            return m_val;
+        }
+    };
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"empty pool"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::object_pool<test_elem, TEST_N> const pool{};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(pool.empty());
+                bsl::ut_check(!pool.full());
+                bsl::ut_check(pool.size().is_zero());
+                bsl::ut_check(TEST_N == pool.capacity());
+                bsl::ut_check(g_mut_alive.is_zero());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"create until full"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::object_pool<test_elem, TEST_N> mut_pool{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const *const elem1{mut_pool.create(1_i32)};
+                auto const *const elem2{mut_pool.create(2_i32)};
+                auto const *const elem3{mut_pool.create(3_i32)};
+                auto const *const elem4{mut_pool.create()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(nullptr != elem1);
+                    bsl::ut_check(nullptr != elem2);
+                    bsl::ut_check(nullptr != elem3);
+                    bsl::ut_check(nullptr != elem4);
+                    bsl::ut_check(1_i32 == elem1->val());
+                    bsl::ut_check(2_i32 == elem2->val());
+                    bsl::ut_check(3_i32 == elem3->val());
+                    bsl::ut_check(0_i32 == elem4->val());
+                    bsl::ut_check(mut_pool.full());
+                    bsl::ut_check(TEST_N == mut_pool.size());
+                    bsl::ut_check(4_i32 == g_mut_alive);
+                    bsl::ut_check(nullptr == mut_pool.create(5_i32));
+                    bsl::ut_check(4_i32 == g_mut_alive);
+                };
+            };
+        };
+
+        bsl::ut_check(g_mut_alive.is_zero());
+    };
+
+    bsl::ut_scenario{"destroy gives the slot back"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::object_pool<test_elem, TEST_N> mut_pool{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto *const pmut_elem1{mut_pool.create(1_i32)};
+                auto *const pmut_elem2{mut_pool.create(2_i32)};
+                bsl::discard(mut_pool.create(3_i32));
+                bsl::discard(mut_pool.create(4_i32));
+                mut_pool.destroy(pmut_elem1);
+                mut_pool.destroy(pmut_elem2);
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(2_umx == mut_pool.size());
+                    bsl::ut_check(2_i32 == g_mut_alive);
+                    bsl::ut_check(pmut_elem2 == mut_pool.create(5_i32));
+                    bsl::ut_check(pmut_elem1 == mut_pool.create(6_i32));
+                    bsl::ut_check(5_i32 == pmut_elem2->val());
+                    bsl::ut_check(6_i32 == pmut_elem1->val());
+                    bsl::ut_check(mut_pool.full());
+                    mut_pool.destroy(nullptr);
+                    bsl::ut_check(mut_pool.full());
+                };
+            };
+        };
+
+        bsl::ut_check(g_mut_alive.is_zero());
+    };
+
+    bsl::ut_scenario{"clear"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::object_pool<test_elem, TEST_N> mut_pool{};
+            bsl::object_pool<bsl::uint64, TEST_N> mut_trivial{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto *const pmut_elem{mut_pool.create(1_i32)};
+                bsl::discard(mut_pool.create(2_i32));
+                bsl::discard(mut_pool.create(3_i32));
+                mut_pool.destroy(pmut_elem);
+                bsl::discard(mut_trivial.create(static_cast<bsl::uint64>(42)));
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(2_i32 == g_mut_alive);
+                    mut_pool.clear();
+                    bsl::ut_check(mut_pool.empty());
+                    bsl::ut_check(g_mut_alive.is_zero());
+                    mut_trivial.clear();
+                    bsl::ut_check(mut_trivial.empty());
+                    bsl::ut_check(nullptr != mut_trivial.create());
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
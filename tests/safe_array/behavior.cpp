@@ -0,0 +1,195 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_array.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"get"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_array<bsl::uint64, 4> const arr{{4U, 8U, 15U, 16U}};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(arr.get(bsl::to_idx(0)) == bsl::to_u64(4));
+                    bsl::ut_check(arr.get(bsl::to_idx(3)) == bsl::to_u64(16));
+                    bsl::ut_check(arr.get(bsl::to_idx(0)).is_valid_and_checked());
+                    bsl::ut_check(arr.get(bsl::to_idx(4)).is_poisoned());
+                    bsl::ut_check(arr.get(bsl::safe_idx::max_value()).is_poisoned());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"set"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_array<bsl::uint64, 4> mut_arr{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_arr.set(bsl::to_idx(1), bsl::to_u64(42));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_arr.get(bsl::to_idx(0)) == bsl::to_u64(0));
+                        bsl::ut_check(mut_arr.get(bsl::to_idx(1)) == bsl::to_u64(42));
+                        bsl::ut_check(!mut_arr.is_any_poisoned());
+                    };
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_array<bsl::uint64, 4> mut_arr{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_arr.set(bsl::to_idx(2), bsl::safe_u64::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto mut_val{mut_arr.get(bsl::to_idx(2))};
+                        bsl::ut_check(mut_val.is_poisoned());
+                        bsl::ut_check(mut_val.is_unchecked());
+                        bsl::ut_check(mut_arr.is_poisoned(bsl::to_idx(2)));
+                        bsl::ut_check(mut_arr.is_any_poisoned());
+                    };
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_array<bsl::uint64, 4> mut_arr{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_arr.set(bsl::to_idx(2), bsl::safe_u64::failure());
+                    mut_arr.set(bsl::to_idx(2), bsl::to_u64(23));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_arr.get(bsl::to_idx(2)) == bsl::to_u64(23));
+                        bsl::ut_check(!mut_arr.is_poisoned(bsl::to_idx(2)));
+                        bsl::ut_check(!mut_arr.is_any_poisoned());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"is_poisoned"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_array<bsl::uint8, 130> mut_arr{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_arr.set(bsl::to_idx(63), bsl::safe_u8::failure());
+                    mut_arr.set(bsl::to_idx(64), bsl::safe_u8::failure());
+                    mut_arr.set(bsl::to_idx(129), bsl::safe_u8::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_arr.is_poisoned(bsl::to_idx(0)));
+                        bsl::ut_check(!mut_arr.is_poisoned(bsl::to_idx(62)));
+                        bsl::ut_check(mut_arr.is_poisoned(bsl::to_idx(63)));
+                        bsl::ut_check(mut_arr.is_poisoned(bsl::to_idx(64)));
+                        bsl::ut_check(!mut_arr.is_poisoned(bsl::to_idx(65)));
+                        bsl::ut_check(!mut_arr.is_poisoned(bsl::to_idx(128)));
+                        bsl::ut_check(mut_arr.is_poisoned(bsl::to_idx(129)));
+                        bsl::ut_check(mut_arr.is_poisoned(bsl::to_idx(130)));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"is_any_poisoned"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_array<bsl::uint32, 200> mut_arr{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_arr.is_any_poisoned());
+                };
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_arr.set(bsl::to_idx(199), bsl::safe_u32::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_arr.is_any_poisoned());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"data"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_array<bsl::int32, 2> mut_arr{{-1, 1}};
+                bsl::safe_array<bsl::int32, 2> const arr{{-1, 1}};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(nullptr != mut_arr.data());
+                    bsl::ut_check(nullptr != arr.data());
+                    bsl::ut_check(nullptr != mut_arr.poisoned_data());
+                    bsl::ut_check(nullptr != arr.poisoned_data());
+                    bsl::ut_check(*arr.data() == -1);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"size"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_array<bsl::uint16, 5> const arr{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!arr.empty());
+                    bsl::ut_check(arr.size() == bsl::to_umx(5));
+                    bsl::ut_check(arr.size_bytes() == bsl::to_umx(10));
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(tests() == bsl::ut_success());
+
+    /// NOTE:
+    /// - An out of bounds set() is a compile-time error, so it can only
+    ///   be tested at run-time.
+    ///
+
+    bsl::ut_scenario{"set out of bounds"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::safe_array<bsl::uint64, 4> mut_arr{};
+            bsl::ut_when{} = [&]() noexcept {
+                mut_arr.set(bsl::to_idx(4), bsl::safe_u64::failure());
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_arr.is_any_poisoned());
+                };
+            };
+        };
+    };
+
+    return tests();
+}
@@ -108,7 +108,33 @@ namespace bsl
         };
 
         bsl::ut_scenario{"max_value"} = []() noexcept {
-            bsl::ut_check(safe_idx::max_value() == bsl::numeric_limits<bsl::uintmx>::max_value());
+            constexpr auto max{bsl::numeric_limits<bsl::uintmx>::max_value()};
+            bsl::ut_check(safe_idx::max_value() == max - static_cast<bsl::uintmx>(1));
+            bsl::ut_check(safe_idx::max_value().is_valid());
+        };
+
+        bsl::ut_scenario{"max is reserved as the poison value"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_idx const val{bsl::numeric_limits<bsl::uintmx>::max_value()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(val.is_invalid());
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_idx const val{safe_idx::max_value() + static_cast<bsl::uintmx>(1)};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(val.is_invalid());
+                };
+            };
+
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                constexpr auto max{bsl::numeric_limits<bsl::uintmx>::max_value()};
+                bsl::safe_idx const val{bsl::safe_umx{max}, bsl::here()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(val.is_invalid());
+                };
+            };
         };
 
         bsl::ut_scenario{"min_value"} = []() noexcept {
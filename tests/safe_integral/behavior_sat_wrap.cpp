@@ -0,0 +1,203 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/discard.hpp>
+#include <bsl/is_signed.hpp>
+#include <bsl/numeric_limits.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    tests_sat_wrap() noexcept -> bsl::exit_code
+    {
+        constexpr auto min{bsl::safe_integral<T>::min_value()};
+        constexpr auto max{bsl::safe_integral<T>::max_value()};
+        constexpr auto zero{bsl::safe_integral<T>::magic_0()};
+        constexpr auto one{bsl::safe_integral<T>::magic_1()};
+        constexpr auto two{bsl::safe_integral<T>::magic_2()};
+        constexpr auto three{bsl::safe_integral<T>::magic_3()};
+        constexpr auto six{(three + three).checked()};
+        constexpr auto min_plus_one{(min + one).checked()};
+        constexpr auto max_minus_one{(max - one).checked()};
+
+        bsl::ut_scenario{"sat_add"} = [&]() noexcept {
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(one.sat_add(two) == three);
+                bsl::ut_check(max.sat_add(one) == max);
+                bsl::ut_check(max.sat_add(max) == max);
+                bsl::ut_check(max.sat_add(one).is_valid_and_checked());
+                if constexpr (bsl::is_signed<T>::value) {
+                    constexpr auto neg_one{(-one).checked()};
+                    bsl::ut_check(min.sat_add(neg_one) == min);
+                    bsl::ut_check(min.sat_add(min) == min);
+                    bsl::ut_check(min.sat_add(max) == neg_one);
+                }
+            };
+        };
+
+        bsl::ut_scenario{"sat_sub"} = [&]() noexcept {
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(three.sat_sub(two) == one);
+                bsl::ut_check(min.sat_sub(one) == min);
+                bsl::ut_check(min.sat_sub(one).is_valid_and_checked());
+                if constexpr (bsl::is_signed<T>::value) {
+                    constexpr auto neg_one{(-one).checked()};
+                    bsl::ut_check(max.sat_sub(neg_one) == max);
+                    bsl::ut_check(zero.sat_sub(min) == max);
+                    bsl::ut_check(neg_one.sat_sub(max) == min);
+                }
+                else {
+                    bsl::ut_check(zero.sat_sub(max) == zero);
+                }
+            };
+        };
+
+        bsl::ut_scenario{"sat_mul"} = [&]() noexcept {
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(two.sat_mul(three) == six);
+                bsl::ut_check(max.sat_mul(two) == max);
+                bsl::ut_check(max.sat_mul(zero) == zero);
+                bsl::ut_check(max.sat_mul(two).is_valid_and_checked());
+                if constexpr (bsl::is_signed<T>::value) {
+                    constexpr auto neg_one{(-one).checked()};
+                    constexpr auto neg_two{(-two).checked()};
+                    bsl::ut_check(min.sat_mul(two) == min);
+                    bsl::ut_check(min.sat_mul(neg_one) == max);
+                    bsl::ut_check(max.sat_mul(neg_two) == min);
+                    bsl::ut_check(min.sat_mul(min) == max);
+                }
+            };
+        };
+
+        bsl::ut_scenario{"wrap_add"} = [&]() noexcept {
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(one.wrap_add(two) == three);
+                bsl::ut_check(max.wrap_add(one) == min);
+                bsl::ut_check(max.wrap_add(two) == min_plus_one);
+                bsl::ut_check(max.wrap_add(one).is_valid_and_checked());
+            };
+        };
+
+        bsl::ut_scenario{"wrap_sub"} = [&]() noexcept {
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(three.wrap_sub(two) == one);
+                bsl::ut_check(min.wrap_sub(one) == max);
+                bsl::ut_check(min.wrap_sub(two) == max_minus_one);
+                bsl::ut_check(min.wrap_sub(one).is_valid_and_checked());
+            };
+        };
+
+        bsl::ut_scenario{"wrap_mul"} = [&]() noexcept {
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(two.wrap_mul(three) == six);
+                bsl::ut_check(max.wrap_mul(one) == max);
+                bsl::ut_check(max.wrap_mul(two).is_valid_and_checked());
+                if constexpr (bsl::is_signed<T>::value) {
+                    constexpr auto neg_one{(-one).checked()};
+                    constexpr auto neg_two{(-two).checked()};
+                    bsl::ut_check(max.wrap_mul(two) == neg_two);
+                    bsl::ut_check(min.wrap_mul(neg_one) == min);
+                }
+                else {
+                    bsl::ut_check(max.wrap_mul(two) == max_minus_one);
+                    bsl::ut_check(max.wrap_mul(max) == one);
+                }
+            };
+        };
+
+        bsl::ut_scenario{"poisoned inputs"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const bad{bsl::safe_integral<T>::failure()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bad.sat_add(one).is_invalid());
+                    bsl::ut_check(one.sat_sub(bad).is_invalid());
+                    bsl::ut_check(bad.sat_mul(one).is_invalid());
+                    bsl::ut_check(one.wrap_add(bad).is_invalid());
+                    bsl::ut_check(bad.wrap_sub(one).is_invalid());
+                    bsl::ut_check(one.wrap_mul(bad).is_invalid());
+                    bsl::ut_check(bad.sat_add(one).is_unchecked());
+                    bsl::ut_check(one.wrap_add(bad).is_unchecked());
+                };
+            };
+
+            bsl::ut_given{} = [&]() noexcept {
+                auto const unchecked{one + one};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(unchecked.sat_add(one).is_unchecked());
+                    bsl::ut_check(!unchecked.sat_add(one).is_invalid());
+                    bsl::ut_check(one.wrap_sub(unchecked).is_unchecked());
+                    bsl::ut_check(!one.wrap_sub(unchecked).is_invalid());
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(bsl::tests_sat_wrap<bsl::int8>() == bsl::ut_success());
+    static_assert(bsl::tests_sat_wrap<bsl::int16>() == bsl::ut_success());
+    static_assert(bsl::tests_sat_wrap<bsl::int32>() == bsl::ut_success());
+    static_assert(bsl::tests_sat_wrap<bsl::int64>() == bsl::ut_success());
+    static_assert(bsl::tests_sat_wrap<bsl::uint8>() == bsl::ut_success());
+    static_assert(bsl::tests_sat_wrap<bsl::uint16>() == bsl::ut_success());
+    static_assert(bsl::tests_sat_wrap<bsl::uint32>() == bsl::ut_success());
+    static_assert(bsl::tests_sat_wrap<bsl::uint64>() == bsl::ut_success());
+    static_assert(bsl::tests_sat_wrap<bsl::uintmx>() == bsl::ut_success());
+
+    bsl::discard(bsl::tests_sat_wrap<bsl::int8>());
+    bsl::discard(bsl::tests_sat_wrap<bsl::int16>());
+    bsl::discard(bsl::tests_sat_wrap<bsl::int32>());
+    bsl::discard(bsl::tests_sat_wrap<bsl::int64>());
+    bsl::discard(bsl::tests_sat_wrap<bsl::uint8>());
+    bsl::discard(bsl::tests_sat_wrap<bsl::uint16>());
+    bsl::discard(bsl::tests_sat_wrap<bsl::uint32>());
+    bsl::discard(bsl::tests_sat_wrap<bsl::uint64>());
+    bsl::discard(bsl::tests_sat_wrap<bsl::uintmx>());
+
+    return bsl::ut_success();
+}
@@ -91,6 +91,12 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_ival1.failure()));
                 static_assert(noexcept(mut_ival1.max({})));
                 static_assert(noexcept(mut_ival1.min({})));
+                static_assert(noexcept(mut_ival1.sat_add({})));
+                static_assert(noexcept(mut_ival1.sat_sub({})));
+                static_assert(noexcept(mut_ival1.sat_mul({})));
+                static_assert(noexcept(mut_ival1.wrap_add({})));
+                static_assert(noexcept(mut_ival1.wrap_sub({})));
+                static_assert(noexcept(mut_ival1.wrap_mul({})));
                 static_assert(noexcept(mut_ival1 += mut_ival2));
                 static_assert(noexcept(mut_ival1 += 42));
                 static_assert(noexcept(mut_ival1 -= mut_ival2));
@@ -189,6 +195,12 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(ival1.failure()));
                 static_assert(noexcept(ival1.max({})));
                 static_assert(noexcept(ival1.min({})));
+                static_assert(noexcept(ival1.sat_add({})));
+                static_assert(noexcept(ival1.sat_sub({})));
+                static_assert(noexcept(ival1.sat_mul({})));
+                static_assert(noexcept(ival1.wrap_add({})));
+                static_assert(noexcept(ival1.wrap_sub({})));
+                static_assert(noexcept(ival1.wrap_mul({})));
                 static_assert(noexcept(ival1 == ival2));
                 static_assert(noexcept(ival1 == 42));
                 static_assert(noexcept(42 == ival1));
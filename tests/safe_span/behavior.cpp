@@ -0,0 +1,138 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_array.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/safe_span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"default constructor"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_span<bsl::uint64> const spn{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(spn.empty());
+                    bsl::ut_check(spn.data() == nullptr);
+                    bsl::ut_check(spn.size() == bsl::to_umx(0));
+                    bsl::ut_check(spn.size_bytes() == bsl::to_umx(0));
+                    bsl::ut_check(!spn.is_any_poisoned());
+                    bsl::ut_check(spn.is_poisoned(bsl::to_idx(0)));
+                    bsl::ut_check(spn.get(bsl::to_idx(0)).is_poisoned());
+                    bsl::ut_check(spn.subspan(bsl::to_idx(0)).empty());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"array constructor"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_array<bsl::uint32, 3> const arr{{4U, 8U, 15U}};
+                bsl::safe_span const spn{arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!spn.empty());
+                    bsl::ut_check(spn.data() == arr.data());
+                    bsl::ut_check(spn.size() == bsl::to_umx(3));
+                    bsl::ut_check(spn.size_bytes() == bsl::to_umx(12));
+                    bsl::ut_check(spn.get(bsl::to_idx(2)) == bsl::to_u32(15));
+                    bsl::ut_check(spn.get(bsl::to_idx(3)).is_poisoned());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"set"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_array<bsl::uint64, 4> mut_arr{};
+                bsl::safe_span mut_spn{mut_arr};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_spn.set(bsl::to_idx(0), bsl::to_u64(42));
+                    mut_spn.set(bsl::to_idx(3), bsl::safe_u64::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_arr.get(bsl::to_idx(0)) == bsl::to_u64(42));
+                        bsl::ut_check(mut_arr.is_poisoned(bsl::to_idx(3)));
+                        bsl::ut_check(mut_spn.is_poisoned(bsl::to_idx(3)));
+                        bsl::ut_check(mut_spn.get(bsl::to_idx(3)).is_unchecked());
+                        bsl::ut_check(mut_spn.is_any_poisoned());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"subspan"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_array<bsl::uint8, 200> mut_arr{};
+                bsl::safe_span mut_spn{mut_arr};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto mut_sub{mut_spn.subspan(bsl::to_idx(60), bsl::to_umx(10))};
+                    mut_sub.set(bsl::to_idx(4), bsl::safe_u8::failure());
+                    mut_sub.set(bsl::to_idx(5), bsl::to_u8(42));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sub.size() == bsl::to_umx(10));
+                        bsl::ut_check(mut_sub.is_poisoned(bsl::to_idx(4)));
+                        bsl::ut_check(!mut_sub.is_poisoned(bsl::to_idx(5)));
+                        bsl::ut_check(mut_arr.is_poisoned(bsl::to_idx(64)));
+                        bsl::ut_check(mut_arr.get(bsl::to_idx(65)) == bsl::to_u8(42));
+                        bsl::ut_check(mut_sub.is_any_poisoned());
+                        bsl::ut_check(!mut_sub.subspan(bsl::to_idx(5)).is_any_poisoned());
+                        bsl::ut_check(!mut_sub.subspan({}, bsl::to_umx(4)).is_any_poisoned());
+                        bsl::ut_check(!mut_spn.subspan(bsl::to_idx(65)).is_any_poisoned());
+                        bsl::ut_check(mut_spn.subspan(bsl::to_idx(64)).is_any_poisoned());
+                        bsl::ut_check(mut_spn.subspan(bsl::to_idx(190)).size() == bsl::to_umx(10));
+                        bsl::ut_check(mut_spn.subspan(bsl::to_idx(200)).empty());
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,86 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/safe_array.hpp>
+#include <bsl/safe_span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief used to verify that a safe_span supports constinit
+    constinit bsl::safe_array<bsl::uint64, 4> const g_verify_arr{{1U, 2U, 3U, 4U}};
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    constinit bsl::safe_span const g_verify_constinit{g_verify_arr};
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"verify supports constinit"} = []() noexcept {
+        bsl::discard(g_verify_constinit);
+    };
+
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::safe_array<bsl::uint64, 4> mut_arr{};
+            bsl::safe_span mut_spn{mut_arr};
+            bsl::safe_span const spn{mut_arr};
+            bsl::ut_then{} = []() noexcept {
+                static_assert(noexcept(bsl::safe_span<bsl::uint64>{}));
+                static_assert(noexcept(bsl::safe_span{mut_arr}));
+
+                static_assert(noexcept(mut_spn.get(bsl::to_idx(0))));
+                static_assert(noexcept(mut_spn.set(bsl::to_idx(0), bsl::safe_u64::magic_1())));
+                static_assert(noexcept(mut_spn.is_poisoned(bsl::to_idx(0))));
+                static_assert(noexcept(mut_spn.is_any_poisoned()));
+                static_assert(noexcept(mut_spn.data()));
+                static_assert(noexcept(mut_spn.empty()));
+                static_assert(noexcept(mut_spn.size()));
+                static_assert(noexcept(mut_spn.size_bytes()));
+                static_assert(noexcept(mut_spn.subspan(bsl::to_idx(0))));
+
+                static_assert(noexcept(spn.get(bsl::to_idx(0))));
+                static_assert(noexcept(spn.is_poisoned(bsl::to_idx(0))));
+                static_assert(noexcept(spn.is_any_poisoned()));
+                static_assert(noexcept(spn.data()));
+                static_assert(noexcept(spn.empty()));
+                static_assert(noexcept(spn.size()));
+                static_assert(noexcept(spn.size_bytes()));
+                static_assert(noexcept(spn.subspan(bsl::to_idx(0))));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -24,14 +24,227 @@
 
 #include "../array_init.hpp"
 
+#include <bsl/array.hpp>
 #include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/sort.hpp>
 #include <bsl/span.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/ut.hpp>
 
 namespace
 {
+    /// @brief defines the number of elements used by the larger tests
+    constexpr bsl::uintmx NUM_ELEMS{static_cast<bsl::uintmx>(200)};
+    /// @brief defines the multiplier of the test's random number generator
+    constexpr auto LCG_MUL{1103515245_umx};
+    /// @brief defines the increment of the test's random number generator
+    constexpr auto LCG_INC{12345_umx};
+    /// @brief defines the mask of the test's random number generator
+    constexpr auto LCG_MASK{0x7FFFFFFF_umx};
+
+    /// @brief defines the array type used by the larger tests
+    using test_array = bsl::array<bsl::safe_umx, NUM_ELEMS>;
+
+    /// @class <anonymous>::test_pair
+    ///
+    /// <!-- description -->
+    ///   @brief Stores a key and the order the key was added in, which
+    ///     is used to verify that stable_sort is stable.
+    ///
+    struct test_pair final
+    {
+        /// @brief stores the key being sorted
+        bsl::safe_umx key;
+        /// @brief stores the original position of the key
+        bsl::safe_umx seq;
+    };
+
+    /// <!-- description -->
+    ///   @brief Compares two test_pairs using their keys only
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param a the first element to compare
+    ///   @param b the second element to compare
+    ///   @return Returns true if a.key is less b.key, false otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    test_pair_cmp(test_pair const &a, test_pair const &b) noexcept -> bool
+    {
+        return a.key < b.key;
+    }
+
+    /// @class <anonymous>::adversary_cmp
+    ///
+    /// <!-- description -->
+    ///   @brief Implements McIlroy's "A Killer Adversary for Quicksort".
+    ///     The elements being sorted are indices into m_vals. Elements
+    ///     start out as "gas" (larger than everything else), and are
+    ///     frozen into a value on demand such that quicksort keeps
+    ///     choosing bad pivots. This is used to verify that bsl::sort
+    ///     falls back to heapsort instead of going quadratic.
+    ///
+    class adversary_cmp final
+    {
+        /// @brief stores the value of each element
+        test_array m_vals{};
+        /// @brief stores the number of elements that are frozen
+        bsl::safe_umx m_solid{};
+        /// @brief stores the element that is most likely the pivot
+        bsl::safe_umx m_candidate{};
+
+        /// <!-- description -->
+        ///   @brief Returns a reference to the value of the element
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param elem the element to get the value of
+        ///   @return Returns a reference to the value of the element
+        ///
+        [[nodiscard]] constexpr auto
+        val(bsl::safe_umx const &elem) noexcept -> bsl::safe_umx &
+        {
+            return *m_vals.at_if(bsl::to_idx(elem));
+        }
+
+        /// <!-- description -->
+        ///   @brief Freezes the provided element into the next value
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param elem the element to freeze
+        ///
+        constexpr void
+        freeze(bsl::safe_umx const &elem) noexcept
+        {
+            this->val(elem) = m_solid;
+            m_solid = (m_solid + 1_umx).checked();
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates the adversary, turning every element into gas
+        ///
+        constexpr adversary_cmp() noexcept
+        {
+            for (auto &mut_val : m_vals) {
+                mut_val = bsl::to_umx(NUM_ELEMS);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of the provided element
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param elem the element to get the value of
+        ///   @return Returns the value of the provided element
+        ///
+        [[nodiscard]] constexpr auto
+        value_of(bsl::safe_umx const &elem) const noexcept -> bsl::safe_umx
+        {
+            return *m_vals.at_if(bsl::to_idx(elem));
+        }
+
+        /// <!-- description -->
+        ///   @brief Compares two elements, freezing them as needed
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param a the first element to compare
+        ///   @param b the second element to compare
+        ///   @return Returns true if a is less b, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        operator()(bsl::safe_umx const &a, bsl::safe_umx const &b) noexcept -> bool
+        {
+            auto const gas{bsl::to_umx(NUM_ELEMS)};
+            if (this->val(a) == gas && this->val(b) == gas) {
+                if (a == m_candidate) {
+                    this->freeze(a);
+                }
+                else {
+                    this->freeze(b);
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (this->val(a) == gas) {
+                m_candidate = a;
+            }
+            else if (this->val(b) == gas) {
+                m_candidate = b;
+            }
+            else {
+                bsl::touch();
+            }
+
+            return this->val(a) < this->val(b);
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Fills the provided array with pseudo random numbers that
+    ///     are less than max.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_data the array to fill
+    ///   @param max all of the numbers will be less than max
+    ///
+    constexpr void
+    fill_random(test_array &mut_data, bsl::safe_umx const &max) noexcept
+    {
+        auto mut_seed{42_umx};
+        for (auto &mut_elem : mut_data) {
+            mut_seed = ((mut_seed * LCG_MUL + LCG_INC) & LCG_MASK).checked();
+            mut_elem = (mut_seed % max).checked();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the first count elements of the provided
+    ///     array are sorted in non-descending order.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param data the array to check
+    ///   @param count the number of elements to check
+    ///   @return Returns true if the first count elements of the provided
+    ///     array are sorted in non-descending order.
+    ///
+    [[nodiscard]] constexpr auto
+    is_sorted(test_array const &data, bsl::safe_umx const &count) noexcept -> bool
+    {
+        for (bsl::safe_idx mut_i{bsl::safe_idx::magic_1()}; mut_i < count; ++mut_i) {
+            if (*data.at_if(mut_i) < *data.at_if(mut_i - bsl::safe_idx::magic_1())) {
+                return false;
+            }
+
+            bsl::touch();
+        }
+
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the sum of all of the elements in the provided
+    ///     array, which is used to verify that sorting does not lose
+    ///     any elements.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param data the array to sum
+    ///   @return Returns the sum of all of the elements
+    ///
+    [[nodiscard]] constexpr auto
+    sum(test_array const &data) noexcept -> bsl::safe_umx
+    {
+        bsl::safe_umx mut_sum{};
+        for (auto const &elem : data) {
+            mut_sum += elem;
+        }
+
+        return mut_sum.checked();
+    }
+
     /// <!-- description -->
     ///   @brief Implements sort's comparison function in reverse
     ///
@@ -133,6 +346,216 @@ namespace
             };
         };
 
+        bsl::ut_scenario{"sort random numbers with duplicates"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                test_array mut_data{};
+                fill_random(mut_data, 10_umx);
+                auto const expected{sum(mut_data)};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::sort(mut_data);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(is_sorted(mut_data, mut_data.size()));
+                        bsl::ut_check(sum(mut_data) == expected);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"sort many random numbers"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                test_array mut_data{};
+                fill_random(mut_data, LCG_MASK);
+                auto const expected{sum(mut_data)};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::sort(mut_data);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(is_sorted(mut_data, mut_data.size()));
+                        bsl::ut_check(sum(mut_data) == expected);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"sort patterns"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                test_array mut_ascending{};
+                test_array mut_descending{};
+                test_array mut_equal{};
+                test_array mut_organ_pipe{};
+                for (bsl::safe_idx mut_i{}; mut_i < NUM_ELEMS; ++mut_i) {
+                    auto const rev{(bsl::to_umx(NUM_ELEMS) - bsl::to_umx(mut_i)).checked()};
+                    *mut_ascending.at_if(mut_i) = bsl::to_umx(mut_i);
+                    *mut_descending.at_if(mut_i) = rev;
+                    *mut_equal.at_if(mut_i) = 42_umx;
+                    if (mut_i < NUM_ELEMS / static_cast<bsl::uintmx>(2)) {
+                        *mut_organ_pipe.at_if(mut_i) = bsl::to_umx(mut_i);
+                    }
+                    else {
+                        *mut_organ_pipe.at_if(mut_i) = rev;
+                    }
+                }
+
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::sort(mut_ascending);
+                    bsl::sort(mut_descending);
+                    bsl::sort(mut_equal);
+                    bsl::sort(mut_organ_pipe);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(is_sorted(mut_ascending, mut_ascending.size()));
+                        bsl::ut_check(is_sorted(mut_descending, mut_descending.size()));
+                        bsl::ut_check(is_sorted(mut_equal, mut_equal.size()));
+                        bsl::ut_check(is_sorted(mut_organ_pipe, mut_organ_pipe.size()));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"sort survives a quicksort adversary"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                test_array mut_data{};
+                adversary_cmp mut_cmp{};
+                for (bsl::safe_idx mut_i{}; mut_i < NUM_ELEMS; ++mut_i) {
+                    *mut_data.at_if(mut_i) = bsl::to_umx(mut_i);
+                }
+
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::sort(mut_data, mut_cmp);
+                    bsl::ut_then{} = [&]() noexcept {
+                        constexpr auto one{bsl::safe_idx::magic_1()};
+                        for (bsl::safe_idx mut_i{one}; mut_i < NUM_ELEMS; ++mut_i) {
+                            auto const prev{mut_cmp.value_of(*mut_data.at_if(mut_i - one))};
+                            bsl::ut_check(prev <= mut_cmp.value_of(*mut_data.at_if(mut_i)));
+                        }
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"sort nearly sorted blocks"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                constexpr auto block{16_umx};
+                test_array mut_data{};
+                for (bsl::safe_idx mut_i{}; mut_i < NUM_ELEMS; ++mut_i) {
+                    auto const i{bsl::to_umx(mut_i)};
+                    auto const base{(i - (i % block)).checked()};
+                    *mut_data.at_if(mut_i) = ((base + block) - (i % block)).checked();
+                }
+
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::sort(mut_data);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(is_sorted(mut_data, mut_data.size()));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"stable_sort random numbers"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array mut_data{test::ARRAY_INIT_RANDOM};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::stable_sort(mut_data);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_data == test::ARRAY_INIT);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"stable_sort random descending"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array mut_data{test::ARRAY_INIT};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::stable_sort(mut_data, &reverse_sort_cmp);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(*mut_data.front_if() == bsl::to_i32(42));
+                        bsl::ut_check(*mut_data.back_if() == bsl::to_i32(4));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"stable_sort empty doesn't crash"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::span<bsl::safe_i32> mut_view{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::stable_sort(mut_view);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_view.empty());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"stable_sort keeps equal elements in order"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                test_array mut_keys{};
+                fill_random(mut_keys, 10_umx);
+
+                bsl::array<test_pair, NUM_ELEMS> mut_data{};
+                for (bsl::safe_idx mut_i{}; mut_i < NUM_ELEMS; ++mut_i) {
+                    *mut_data.at_if(mut_i) = {*mut_keys.at_if(mut_i), bsl::to_umx(mut_i)};
+                }
+
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::stable_sort(mut_data, &test_pair_cmp);
+                    bsl::ut_then{} = [&]() noexcept {
+                        constexpr auto one{bsl::safe_idx::magic_1()};
+                        for (bsl::safe_idx mut_i{one}; mut_i < NUM_ELEMS; ++mut_i) {
+                            auto const &prev{*mut_data.at_if(mut_i - one)};
+                            auto const &elem{*mut_data.at_if(mut_i)};
+                            bsl::ut_check(prev.key <= elem.key);
+                            if (prev.key == elem.key) {
+                                bsl::ut_check(prev.seq < elem.seq);
+                            }
+                            else {
+                                bsl::touch();
+                            }
+                        }
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"partial_sort"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                test_array mut_data{};
+                test_array mut_expected{};
+                fill_random(mut_data, LCG_MASK);
+                fill_random(mut_expected, LCG_MASK);
+                constexpr auto count{10_umx};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::partial_sort(mut_data, count);
+                    bsl::sort(mut_expected);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(is_sorted(mut_data, count));
+                        for (bsl::safe_idx mut_i{}; mut_i < count; ++mut_i) {
+                            bsl::ut_check(*mut_data.at_if(mut_i) == *mut_expected.at_if(mut_i));
+                        }
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"partial_sort edge cases"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array mut_data1{test::ARRAY_INIT_RANDOM};
+                bsl::array mut_data2{test::ARRAY_INIT_RANDOM};
+                bsl::array mut_data3{test::ARRAY_INIT};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::partial_sort(mut_data1, {});
+                    bsl::partial_sort(mut_data2, 42_umx);
+                    bsl::partial_sort(mut_data3, 2_umx, &reverse_sort_cmp);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_data1 == test::ARRAY_INIT_RANDOM);
+                        bsl::ut_check(mut_data2 == test::ARRAY_INIT);
+                        bsl::ut_check(*mut_data3.at_if(bsl::to_idx(0)) == bsl::to_i32(42));
+                        bsl::ut_check(*mut_data3.at_if(bsl::to_idx(1)) == bsl::to_i32(23));
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
@@ -43,6 +43,8 @@ main() noexcept -> bsl::exit_code
             bsl::array mut_data{test::ARRAY_INIT};
             bsl::ut_then{} = []() noexcept {
                 static_assert(noexcept(bsl::sort(mut_data)));
+                static_assert(noexcept(bsl::stable_sort(mut_data)));
+                static_assert(noexcept(bsl::partial_sort(mut_data, {})));
             };
         };
     };
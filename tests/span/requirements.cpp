@@ -83,6 +83,7 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_spn1.first()));
                 static_assert(noexcept(mut_spn1.last()));
                 static_assert(noexcept(mut_spn1.subspan(bsl::to_idx(0))));
+                static_assert(noexcept(mut_spn1.unchecked_view()));
 
                 static_assert(noexcept(spn1.at_if(bsl::to_idx(0))));
                 static_assert(noexcept(spn1.front_if()));
@@ -106,6 +107,7 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(spn1.first()));
                 static_assert(noexcept(spn1.last()));
                 static_assert(noexcept(spn1.subspan(bsl::to_idx(0))));
+                static_assert(noexcept(spn1.unchecked_view()));
             };
         };
     };
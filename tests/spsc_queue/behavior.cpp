@@ -0,0 +1,115 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/spsc_queue.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the max number of elements used by the tests
+    constexpr bsl::uintmx TEST_N{static_cast<bsl::uintmx>(4)};
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"empty queue"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::spsc_queue<bsl::safe_u32, TEST_N> mut_queue{};
+            bsl::safe_u32 mut_val{42_u32};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(mut_queue.empty());
+                bsl::ut_check(mut_queue.size().is_zero());
+                bsl::ut_check(TEST_N == mut_queue.max_size());
+                bsl::ut_check(!mut_queue.try_pop(mut_val));
+                bsl::ut_check(42_u32 == mut_val);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"push until full, then pop in order"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::spsc_queue<bsl::safe_u32, TEST_N> mut_queue{};
+            bsl::safe_u32 const val{4_u32};
+            bsl::safe_u32 mut_val{};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(mut_queue.try_push(1_u32));
+                bsl::ut_check(mut_queue.try_push(2_u32));
+                bsl::ut_check(mut_queue.try_push(3_u32));
+                bsl::ut_check(mut_queue.try_push(val));
+                bsl::ut_check(TEST_N == mut_queue.size());
+                bsl::ut_check(!mut_queue.try_push(5_u32));
+                bsl::ut_check(!mut_queue.try_push(val));
+                bsl::ut_check(TEST_N == mut_queue.size());
+
+                bsl::ut_check(mut_queue.try_pop(mut_val));
+                bsl::ut_check(1_u32 == mut_val);
+                bsl::ut_check(mut_queue.try_pop(mut_val));
+                bsl::ut_check(2_u32 == mut_val);
+                bsl::ut_check(2_umx == mut_queue.size());
+                bsl::ut_check(mut_queue.try_pop(mut_val));
+                bsl::ut_check(3_u32 == mut_val);
+                bsl::ut_check(mut_queue.try_pop(mut_val));
+                bsl::ut_check(4_u32 == mut_val);
+                bsl::ut_check(mut_queue.empty());
+                bsl::ut_check(!mut_queue.try_pop(mut_val));
+                bsl::ut_check(4_u32 == mut_val);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"wrap around many times"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::spsc_queue<bsl::safe_u32, TEST_N> mut_queue{};
+            bsl::safe_u32 mut_val{};
+            bsl::ut_then{} = [&]() noexcept {
+                constexpr auto total{100_u32};
+                for (bsl::safe_u32 mut_i{}; mut_i < total; mut_i = (mut_i + 1_u32).checked()) {
+                    bsl::ut_check(mut_queue.try_push(mut_i));
+                    bsl::ut_check(mut_queue.try_push((mut_i + total).checked()));
+                    bsl::ut_check(mut_queue.try_pop(mut_val));
+                    bsl::ut_check(mut_i == mut_val);
+                    bsl::ut_check(mut_queue.try_pop(mut_val));
+                    bsl::ut_check((mut_i + total).checked() == mut_val);
+                }
+
+                bsl::ut_check(mut_queue.empty());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,111 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/spsc_queue.hpp>
+#include <bsl/ut.hpp>
+
+/// NOTE:
+/// - One producer thread pushes TOTAL values in order while the main
+///   thread pops them. The queue is much smaller than TOTAL, so both
+///   sides spend most of the test running into a full (or empty) queue,
+///   at which point they yield so that the test also finishes quickly on
+///   a machine with a single core. Every value must come out exactly once
+///   and in the order it was pushed.
+///
+
+namespace
+{
+    /// @brief defines the max number of elements in the queue
+    constexpr bsl::uintmx QUEUE_N{static_cast<bsl::uintmx>(64)};
+    /// @brief defines the total number of values to push through the queue
+    constexpr auto TOTAL{1000000_u64};
+
+    /// @brief stores the queue being tested
+    constinit bsl::spsc_queue<bsl::safe_u64, QUEUE_N> g_mut_queue{};
+
+    /// <!-- description -->
+    ///   @brief Pushes 0 to TOTAL - 1 onto the queue, spinning while the
+    ///     queue is full.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_arg ignored
+    ///   @return Always returns a nullptr
+    ///
+    [[nodiscard]] auto
+    producer(void *const pmut_arg) noexcept -> void *
+    {
+        bsl::discard(pmut_arg);
+
+        for (bsl::safe_u64 mut_i{}; mut_i < TOTAL; mut_i = (mut_i + 1_u64).checked()) {
+            while (!g_mut_queue.try_push(mut_i)) {
+                bsl::discard(sched_yield());
+            }
+        }
+
+        return nullptr;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"one producer and one consumer"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            pthread_t mut_thread{};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::ut_check(0 == pthread_create(&mut_thread, nullptr, &producer, nullptr));
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::safe_u64 mut_val{};
+                    for (bsl::safe_u64 mut_i{}; mut_i < TOTAL; mut_i = (mut_i + 1_u64).checked()) {
+                        while (!g_mut_queue.try_pop(mut_val)) {
+                            bsl::discard(sched_yield());
+                        }
+
+                        bsl::ut_check(mut_i == mut_val);
+                    }
+
+                    bsl::ut_check(0 == pthread_join(mut_thread, nullptr));
+                    bsl::ut_check(g_mut_queue.empty());
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
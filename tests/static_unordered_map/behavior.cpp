@@ -0,0 +1,349 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#undef BSL_ASSERT_FAST_FAILS
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BSL_ASSERT_FAST_FAILS false
+
+#include <bsl/as_const.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/static_unordered_map.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the max number of elements used by the small tests
+    constexpr bsl::uintmx TEST_N{static_cast<bsl::uintmx>(4)};
+    /// @brief defines the max number of elements used by the larger tests
+    constexpr bsl::uintmx NUM_KEYS{static_cast<bsl::uintmx>(100)};
+
+    /// @class <anonymous>::collide_hash
+    ///
+    /// <!-- description -->
+    ///   @brief A hash function that maps every key to the same slot,
+    ///     which forces the map to probe for every operation.
+    ///
+    class collide_hash final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Returns 0 for every key
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key ignored
+        ///   @return Returns 0 for every key
+        ///
+        [[nodiscard]] constexpr auto
+        operator()(bsl::safe_umx const &key) const noexcept -> bsl::safe_umx
+        {
+            bsl::discard(key);
+            return bsl::safe_umx::magic_0();
+        }
+    };
+
+    /// @class <anonymous>::identity_hash
+    ///
+    /// <!-- description -->
+    ///   @brief A hash function that returns the key itself, which makes
+    ///     it possible to place keys in a specific slot (including the
+    ///     last slot so that probing wraps around the table).
+    ///
+    class identity_hash final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Returns the key
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key to hash
+        ///   @return Returns the key
+        ///
+        [[nodiscard]] constexpr auto
+        operator()(bsl::safe_umx const &key) const noexcept -> bsl::safe_umx
+        {
+            return key;
+        }
+    };
+
+    /// @brief defines the map type used by most of the tests
+    using test_map = bsl::static_unordered_map<bsl::safe_umx, bsl::safe_umx, TEST_N>;
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"capacity"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                test_map const map{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(map.max_size() == bsl::safe_umx{TEST_N});
+                    bsl::ut_check(map.bucket_count() > map.max_size());
+                    auto const mask{(map.bucket_count() - 1_umx).checked()};
+                    bsl::ut_check((map.bucket_count() & mask).is_zero());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"empty/full/size"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                test_map mut_map{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).empty());
+                        bsl::ut_check(!bsl::as_const(mut_map).full());
+                        bsl::ut_check(bsl::as_const(mut_map).size().is_zero());
+                    };
+
+                    bsl::ut_check(mut_map.insert(1_umx, 1_umx));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!bsl::as_const(mut_map).empty());
+                        bsl::ut_check(bsl::as_const(mut_map).size() == 1_umx);
+                    };
+
+                    bsl::ut_check(mut_map.insert(2_umx, 2_umx));
+                    bsl::ut_check(mut_map.insert(3_umx, 3_umx));
+                    bsl::ut_check(mut_map.insert(4_umx, 4_umx));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).full());
+                        bsl::ut_check(bsl::as_const(mut_map).size() == bsl::safe_umx{TEST_N});
+                    };
+
+                    mut_map.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).empty());
+                        bsl::ut_check(!bsl::as_const(mut_map).contains(1_umx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"at_if"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                test_map mut_map{};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto *const pmut_val{mut_map.at_if(1_umx)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_required_step(nullptr != pmut_val);
+                        bsl::ut_check(pmut_val->is_zero());
+                        bsl::ut_check(bsl::as_const(mut_map).contains(1_umx));
+                    };
+
+                    *pmut_val = 42_umx;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).at(1_umx) == 42_umx);
+                        bsl::ut_check(bsl::as_const(mut_map).at(2_umx).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"at"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                test_map mut_map{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_map.at(1_umx) = 42_umx;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).size() == 1_umx);
+                        bsl::ut_check(bsl::as_const(mut_map).at(1_umx) == 42_umx);
+                        bsl::ut_check(mut_map.at(1_umx) == 42_umx);
+                        bsl::ut_check(bsl::as_const(mut_map).size() == 1_umx);
+                    };
+
+                    bsl::ut_check(mut_map.at(2_umx).is_zero());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).size() == 2_umx);
+                        bsl::ut_check(bsl::as_const(mut_map).contains(2_umx));
+                    };
+                };
+            };
+
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                test_map mut_map{};
+                bsl::ut_when{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < TEST_N; ++mut_i) {
+                        mut_map.at(bsl::to_umx(mut_i)) = bsl::to_umx(mut_i);
+                    }
+
+                    mut_map.at(42_umx) = 42_umx;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).full());
+                        bsl::ut_check(!bsl::as_const(mut_map).contains(42_umx));
+                        bsl::ut_check(bsl::as_const(mut_map).at(42_umx).is_zero());
+                        bsl::ut_check(mut_map.at(42_umx).is_zero());
+                        bsl::ut_check(mut_map.at(1_umx) == 1_umx);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"full map reports an error"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                test_map mut_map{};
+                bsl::ut_when{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < TEST_N; ++mut_i) {
+                        bsl::ut_check(mut_map.insert(bsl::to_umx(mut_i), bsl::to_umx(mut_i)));
+                    }
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_map.insert(42_umx, 42_umx) == bsl::errc_failure);
+                        bsl::ut_check(nullptr == mut_map.at_if(42_umx));
+                        bsl::ut_check(!bsl::as_const(mut_map).contains(42_umx));
+                        bsl::ut_check(mut_map.insert(1_umx, 42_umx));
+                        bsl::ut_check(bsl::as_const(mut_map).at(1_umx) == 42_umx);
+                    };
+
+                    bsl::ut_check(mut_map.erase(0_umx));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_map.insert(42_umx, 42_umx));
+                        bsl::ut_check(bsl::as_const(mut_map).at(42_umx) == 42_umx);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"erase"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                test_map mut_map{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_check(mut_map.insert(1_umx, 1_umx));
+                    bsl::ut_check(mut_map.insert(2_umx, 2_umx));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_map.erase(3_umx));
+                        bsl::ut_check(mut_map.erase(1_umx));
+                        bsl::ut_check(!mut_map.erase(1_umx));
+                        bsl::ut_check(!bsl::as_const(mut_map).contains(1_umx));
+                        bsl::ut_check(bsl::as_const(mut_map).at(2_umx) == 2_umx);
+                        bsl::ut_check(bsl::as_const(mut_map).size() == 1_umx);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"many keys"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::static_unordered_map<bsl::safe_umx, bsl::safe_umx, NUM_KEYS> mut_map{};
+                bsl::ut_when{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < NUM_KEYS; ++mut_i) {
+                        bsl::ut_check(mut_map.insert(bsl::to_umx(mut_i), bsl::to_umx(mut_i)));
+                    }
+
+                    for (bsl::safe_idx mut_i{}; mut_i < NUM_KEYS;
+                         mut_i += bsl::safe_idx::magic_2()) {
+                        bsl::ut_check(mut_map.erase(bsl::to_umx(mut_i)));
+                    }
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        for (bsl::safe_idx mut_i{}; mut_i < NUM_KEYS; ++mut_i) {
+                            bool const odd{!(bsl::to_umx(mut_i) & 1_umx).is_zero()};
+                            bool const found{bsl::as_const(mut_map).contains(bsl::to_umx(mut_i))};
+                            bsl::ut_check(odd == found);
+                        }
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"collisions"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::static_unordered_map<bsl::safe_umx, bsl::safe_umx, TEST_N, collide_hash>
+                    mut_map{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_check(mut_map.insert(1_umx, 1_umx));
+                    bsl::ut_check(mut_map.insert(2_umx, 2_umx));
+                    bsl::ut_check(mut_map.insert(3_umx, 3_umx));
+                    bsl::ut_check(mut_map.erase(1_umx));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!bsl::as_const(mut_map).contains(1_umx));
+                        bsl::ut_check(bsl::as_const(mut_map).at(2_umx) == 2_umx);
+                        bsl::ut_check(bsl::as_const(mut_map).at(3_umx) == 3_umx);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"probing wraps around the table"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::static_unordered_map<bsl::safe_umx, bsl::safe_umx, TEST_N, identity_hash>
+                    mut_map{};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto const last{(mut_map.bucket_count() - 1_umx).checked()};
+                    auto const last2{(last + mut_map.bucket_count()).checked()};
+
+                    bsl::ut_check(mut_map.insert(last, 1_umx));
+                    bsl::ut_check(mut_map.insert(last2, 2_umx));
+                    bsl::ut_check(mut_map.insert(0_umx, 3_umx));
+                    bsl::ut_check(mut_map.erase(last));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).at(last2) == 2_umx);
+                        bsl::ut_check(bsl::as_const(mut_map).at(0_umx) == 3_umx);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"copy"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                test_map mut_map1{};
+                bsl::ut_check(mut_map1.insert(1_umx, 42_umx));
+                bsl::ut_when{} = [&]() noexcept {
+                    test_map const map2{mut_map1};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(map2.at(1_umx) == 42_umx);
+                        bsl::ut_check(map2.size() == 1_umx);
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
@@ -0,0 +1,530 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/static_vector.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the max number of elements used by the tests
+    constexpr bsl::uintmx TEST_N{static_cast<bsl::uintmx>(4)};
+
+    /// @brief stores the number of test_elem objects that are alive
+    constinit bsl::safe_i32 g_mut_alive{};
+
+    /// @class test_elem
+    ///
+    /// <!-- description -->
+    ///   @brief A non-trivial element type that keeps track of how many
+    ///     of it are alive.
+    ///
+    class test_elem final
+    {
+        /// @brief stores the value of this element
+        bsl::safe_i32 m_val{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a test_elem
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value of this element
+        ///
+        explicit test_elem(bsl::safe_i32 const &val = {}) noexcept    // --
+            : m_val{val}
+        {
+            g_mut_alive = (g_mut_alive + bsl::safe_i32::magic_1()).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroys a test_elem
+        ///
+        ~test_elem() noexcept
+        {
+            g_mut_alive = (g_mut_alive - bsl::safe_i32::magic_1()).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        test_elem(test_elem const &o) noexcept    // --
+            : m_val{o.m_val}
+        {
+            g_mut_alive = (g_mut_alive + bsl::safe_i32::magic_1()).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        test_elem(test_elem &&mut_o) noexcept    // --
+            : m_val{mut_o.m_val}
+        {
+            g_mut_alive = (g_mut_alive + bsl::safe_i32::magic_1()).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(test_elem const &o) &noexcept -> test_elem & = default;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(test_elem &&mut_o) &noexcept -> test_elem & = default;
+
+        /// <!-- description -->
+        ///   @brief Returns the value of this element
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of this element
+        ///
+        [[nodiscard]] auto
+        val() const noexcept -> bsl::safe_i32 const &
+        {
+            return m_val;
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///     test_elem counts how many of it are alive in a global, so it is
+    ///     only used at run-time. bsl::safe_i32 is trivially copyable, so
+    ///     it is stored in a bsl::array and is tested at compile-time too.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"empty vector"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::static_vector<test_elem, TEST_N> const vec{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(vec.empty());
+                    bsl::ut_check(!vec.full());
+                    bsl::ut_check(vec.size().is_zero());
+                    bsl::ut_check(TEST_N == vec.max_size());
+                    bsl::ut_check(vec.size_bytes().is_zero());
+                    bsl::ut_check(nullptr == vec.at_if({}));
+                    bsl::ut_check(nullptr == vec.front_if());
+                    bsl::ut_check(nullptr == vec.back_if());
+                    bsl::ut_check(nullptr == vec.data());
+                    bsl::ut_check(vec.begin() == vec.end());
+                    bsl::ut_check(vec.cbegin() == vec.cend());
+                    bsl::ut_check(g_mut_alive.is_zero());
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::static_vector<bsl::safe_i32, TEST_N> const vec{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(vec.empty());
+                    bsl::ut_check(!vec.full());
+                    bsl::ut_check(vec.size().is_zero());
+                    bsl::ut_check(vec.size_bytes().is_zero());
+                    bsl::ut_check(nullptr == vec.at_if({}));
+                    bsl::ut_check(nullptr == vec.front_if());
+                    bsl::ut_check(nullptr == vec.back_if());
+                    bsl::ut_check(nullptr == vec.data());
+                    bsl::ut_check(vec.begin() == vec.end());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"emplace_back and try_push_back"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::static_vector<test_elem, TEST_N> mut_vec{};
+                test_elem const elem{42_i32};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto const *const pmut_elem{mut_vec.emplace_back(23_i32)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(nullptr != pmut_elem);
+                        bsl::ut_check(23_i32 == pmut_elem->val());
+                        bsl::ut_check(mut_vec.try_push_back(elem));
+                        bsl::ut_check(mut_vec.try_push_back(test_elem{3_i32}));
+                        bsl::ut_check(nullptr != mut_vec.emplace_back());
+                        bsl::ut_check(mut_vec.full());
+                        bsl::ut_check(5_i32 == g_mut_alive);
+                        bsl::ut_check(nullptr == mut_vec.emplace_back());
+                        bsl::ut_check(!mut_vec.try_push_back(elem));
+                        bsl::ut_check(!mut_vec.try_push_back(test_elem{}));
+                        bsl::ut_check(5_i32 == g_mut_alive);
+                        bsl::ut_check(23_i32 == mut_vec.front_if()->val());
+                        bsl::ut_check(42_i32 == mut_vec.at_if(1_idx)->val());
+                        bsl::ut_check(3_i32 == mut_vec.at_if(2_idx)->val());
+                        bsl::ut_check(0_i32 == mut_vec.back_if()->val());
+                        bsl::ut_check(nullptr == mut_vec.at_if(4_idx));
+                        bsl::ut_check((sizeof(test_elem) * TEST_N) == mut_vec.size_bytes());
+                    };
+                };
+            };
+
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_check(g_mut_alive.is_zero());
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::static_vector<bsl::safe_i32, TEST_N> mut_vec{};
+                bsl::safe_i32 const elem{42_i32};
+                bsl::ut_when{} = [&]() noexcept {
+                    auto const *const pmut_elem{mut_vec.emplace_back(23_i32)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(nullptr != pmut_elem);
+                        bsl::ut_check(23_i32 == *pmut_elem);
+                        bsl::ut_check(mut_vec.try_push_back(elem));
+                        bsl::ut_check(mut_vec.try_push_back(3_i32));
+                        bsl::ut_check(nullptr != mut_vec.emplace_back());
+                        bsl::ut_check(mut_vec.full());
+                        bsl::ut_check(nullptr == mut_vec.emplace_back());
+                        bsl::ut_check(!mut_vec.try_push_back(elem));
+                        bsl::ut_check(!mut_vec.try_push_back(1_i32));
+                        bsl::ut_check(23_i32 == *mut_vec.front_if());
+                        bsl::ut_check(42_i32 == *mut_vec.at_if(1_idx));
+                        bsl::ut_check(3_i32 == *mut_vec.at_if(2_idx));
+                        bsl::ut_check(0_i32 == *mut_vec.back_if());
+                        bsl::ut_check(nullptr == mut_vec.at_if(4_idx));
+                        bsl::ut_check((sizeof(bsl::safe_i32) * TEST_N) == mut_vec.size_bytes());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"pop_back and clear"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::static_vector<test_elem, TEST_N> mut_vec{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::discard(mut_vec.emplace_back(1_i32));
+                    bsl::discard(mut_vec.emplace_back(2_i32));
+                    bsl::discard(mut_vec.emplace_back(3_i32));
+                    mut_vec.pop_back();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(2_umx == mut_vec.size());
+                        bsl::ut_check(2_i32 == mut_vec.back_if()->val());
+                        bsl::ut_check(2_i32 == g_mut_alive);
+                        mut_vec.clear();
+                        bsl::ut_check(mut_vec.empty());
+                        bsl::ut_check(g_mut_alive.is_zero());
+                        mut_vec.pop_back();
+                        bsl::ut_check(mut_vec.empty());
+                    };
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::static_vector<bsl::safe_i32, TEST_N> mut_vec{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::discard(mut_vec.emplace_back(1_i32));
+                    bsl::discard(mut_vec.emplace_back(2_i32));
+                    bsl::discard(mut_vec.emplace_back(3_i32));
+                    mut_vec.pop_back();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(2_umx == mut_vec.size());
+                        bsl::ut_check(2_i32 == *mut_vec.back_if());
+                        mut_vec.clear();
+                        bsl::ut_check(mut_vec.empty());
+                        mut_vec.pop_back();
+                        bsl::ut_check(mut_vec.empty());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"erase keeps the order"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::static_vector<test_elem, TEST_N> mut_vec{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::discard(mut_vec.emplace_back(1_i32));
+                    bsl::discard(mut_vec.emplace_back(2_i32));
+                    bsl::discard(mut_vec.emplace_back(3_i32));
+                    bsl::discard(mut_vec.emplace_back(4_i32));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vec.erase(1_idx));
+                        bsl::ut_check(3_umx == mut_vec.size());
+                        bsl::ut_check(1_i32 == mut_vec.at_if(0_idx)->val());
+                        bsl::ut_check(3_i32 == mut_vec.at_if(1_idx)->val());
+                        bsl::ut_check(4_i32 == mut_vec.at_if(2_idx)->val());
+                        bsl::ut_check(mut_vec.erase(2_idx));
+                        bsl::ut_check(2_umx == mut_vec.size());
+                        bsl::ut_check(3_i32 == mut_vec.back_if()->val());
+                        bsl::ut_check(2_i32 == g_mut_alive);
+                        bsl::ut_check(bsl::errc_index_out_of_bounds == mut_vec.erase(2_idx));
+                        bsl::ut_check(2_umx == mut_vec.size());
+                    };
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::static_vector<bsl::safe_i32, TEST_N> mut_vec{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::discard(mut_vec.emplace_back(1_i32));
+                    bsl::discard(mut_vec.emplace_back(2_i32));
+                    bsl::discard(mut_vec.emplace_back(3_i32));
+                    bsl::discard(mut_vec.emplace_back(4_i32));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vec.erase(1_idx));
+                        bsl::ut_check(3_umx == mut_vec.size());
+                        bsl::ut_check(1_i32 == *mut_vec.at_if(0_idx));
+                        bsl::ut_check(3_i32 == *mut_vec.at_if(1_idx));
+                        bsl::ut_check(4_i32 == *mut_vec.at_if(2_idx));
+                        bsl::ut_check(mut_vec.erase(2_idx));
+                        bsl::ut_check(2_umx == mut_vec.size());
+                        bsl::ut_check(3_i32 == *mut_vec.back_if());
+                        bsl::ut_check(bsl::errc_index_out_of_bounds == mut_vec.erase(2_idx));
+                        bsl::ut_check(2_umx == mut_vec.size());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"swap_erase moves the last element"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::static_vector<test_elem, TEST_N> mut_vec{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::discard(mut_vec.emplace_back(1_i32));
+                    bsl::discard(mut_vec.emplace_back(2_i32));
+                    bsl::discard(mut_vec.emplace_back(3_i32));
+                    bsl::discard(mut_vec.emplace_back(4_i32));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vec.swap_erase(0_idx));
+                        bsl::ut_check(3_umx == mut_vec.size());
+                        bsl::ut_check(4_i32 == mut_vec.at_if(0_idx)->val());
+                        bsl::ut_check(2_i32 == mut_vec.at_if(1_idx)->val());
+                        bsl::ut_check(3_i32 == mut_vec.at_if(2_idx)->val());
+                        bsl::ut_check(mut_vec.swap_erase(2_idx));
+                        bsl::ut_check(2_umx == mut_vec.size());
+                        bsl::ut_check(2_i32 == mut_vec.back_if()->val());
+                        bsl::ut_check(2_i32 == g_mut_alive);
+                        bsl::ut_check(
+                            bsl::errc_index_out_of_bounds == mut_vec.swap_erase(2_idx));
+                    };
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::static_vector<bsl::safe_i32, TEST_N> mut_vec{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::discard(mut_vec.emplace_back(1_i32));
+                    bsl::discard(mut_vec.emplace_back(2_i32));
+                    bsl::discard(mut_vec.emplace_back(3_i32));
+                    bsl::discard(mut_vec.emplace_back(4_i32));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vec.swap_erase(0_idx));
+                        bsl::ut_check(3_umx == mut_vec.size());
+                        bsl::ut_check(4_i32 == *mut_vec.at_if(0_idx));
+                        bsl::ut_check(2_i32 == *mut_vec.at_if(1_idx));
+                        bsl::ut_check(3_i32 == *mut_vec.at_if(2_idx));
+                        bsl::ut_check(mut_vec.swap_erase(2_idx));
+                        bsl::ut_check(2_umx == mut_vec.size());
+                        bsl::ut_check(2_i32 == *mut_vec.back_if());
+                        bsl::ut_check(
+                            bsl::errc_index_out_of_bounds == mut_vec.swap_erase(2_idx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"resize"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::static_vector<test_elem, TEST_N> mut_vec{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::discard(mut_vec.emplace_back(1_i32));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vec.resize(3_umx));
+                        bsl::ut_check(3_umx == mut_vec.size());
+                        bsl::ut_check(1_i32 == mut_vec.front_if()->val());
+                        bsl::ut_check(0_i32 == mut_vec.back_if()->val());
+                        bsl::ut_check(3_i32 == g_mut_alive);
+                        bsl::ut_check(!mut_vec.resize(5_umx));
+                        bsl::ut_check(3_umx == mut_vec.size());
+                        bsl::ut_check(mut_vec.resize(1_umx));
+                        bsl::ut_check(1_umx == mut_vec.size());
+                        bsl::ut_check(1_i32 == g_mut_alive);
+                        bsl::ut_check(mut_vec.resize(1_umx));
+                        bsl::ut_check(mut_vec.resize({}));
+                        bsl::ut_check(mut_vec.empty());
+                    };
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::static_vector<bsl::safe_i32, TEST_N> mut_vec{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::discard(mut_vec.emplace_back(1_i32));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vec.resize(3_umx));
+                        bsl::ut_check(3_umx == mut_vec.size());
+                        bsl::ut_check(1_i32 == *mut_vec.front_if());
+                        bsl::ut_check(0_i32 == *mut_vec.back_if());
+                        bsl::ut_check(!mut_vec.resize(5_umx));
+                        bsl::ut_check(3_umx == mut_vec.size());
+                        bsl::ut_check(mut_vec.resize(1_umx));
+                        bsl::ut_check(1_umx == mut_vec.size());
+                        bsl::ut_check(mut_vec.resize({}));
+                        bsl::ut_check(mut_vec.empty());
+                    };
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::static_vector<bsl::safe_i32, TEST_N> mut_vec{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::discard(mut_vec.emplace_back(42_i32));
+                    mut_vec.pop_back();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vec.resize(1_umx));
+                        bsl::ut_check(0_i32 == *mut_vec.front_if());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"copy and move"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::static_vector<test_elem, TEST_N> mut_vec{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::discard(mut_vec.emplace_back(1_i32));
+                    bsl::discard(mut_vec.emplace_back(2_i32));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::static_vector<test_elem, TEST_N> mut_copy{mut_vec};
+                        bsl::ut_check(2_umx == mut_copy.size());
+                        bsl::ut_check(2_i32 == mut_copy.back_if()->val());
+                        bsl::ut_check(4_i32 == g_mut_alive);
+
+                        bsl::static_vector<test_elem, TEST_N> mut_moved{bsl::move(mut_copy)};
+                        bsl::ut_check(2_umx == mut_moved.size());
+                        bsl::ut_check(1_i32 == mut_moved.front_if()->val());
+
+                        bsl::static_vector<test_elem, TEST_N> mut_other{};
+                        bsl::discard(mut_other.emplace_back(3_i32));
+                        mut_other = mut_vec;
+                        bsl::ut_check(2_umx == mut_other.size());
+                        bsl::ut_check(1_i32 == mut_other.front_if()->val());
+                        mut_other = bsl::move(mut_moved);
+                        bsl::ut_check(2_umx == mut_other.size());
+                        bsl::ut_check(8_i32 == g_mut_alive);
+                    };
+
+                    bsl::ut_check(2_i32 == g_mut_alive);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::static_vector<bsl::safe_i32, TEST_N> mut_vec{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::discard(mut_vec.emplace_back(1_i32));
+                    bsl::discard(mut_vec.emplace_back(2_i32));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::static_vector<bsl::safe_i32, TEST_N> mut_copy{mut_vec};
+                        bsl::ut_check(mut_vec == mut_copy);
+
+                        bsl::static_vector<bsl::safe_i32, TEST_N> mut_moved{bsl::move(mut_copy)};
+                        bsl::ut_check(mut_vec == mut_moved);
+
+                        bsl::static_vector<bsl::safe_i32, TEST_N> mut_other{};
+                        bsl::discard(mut_other.emplace_back(3_i32));
+                        mut_other = mut_vec;
+                        bsl::ut_check(mut_vec == mut_other);
+                        mut_other.clear();
+                        mut_other = bsl::move(mut_moved);
+                        bsl::ut_check(mut_vec == mut_other);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"iterate, compare and output"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::static_vector<bsl::safe_i32, TEST_N> mut_vec1{};
+                bsl::static_vector<bsl::safe_i32, TEST_N> mut_vec2{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::discard(mut_vec1.emplace_back(1_i32));
+                    bsl::discard(mut_vec1.emplace_back(2_i32));
+                    bsl::discard(mut_vec2.emplace_back(1_i32));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::safe_i32 mut_sum{};
+                        for (auto const &elem : mut_vec1) {
+                            mut_sum += elem;
+                        }
+
+                        bsl::ut_check(3_i32 == mut_sum.checked());
+                        bsl::ut_check(mut_vec1 != mut_vec2);
+                        bsl::discard(mut_vec2.emplace_back(2_i32));
+                        bsl::ut_check(mut_vec1 == mut_vec2);
+                        bsl::discard(mut_vec2.emplace_back(2_i32));
+                        bsl::ut_check(mut_vec1 != mut_vec2);
+                        mut_vec1.pop_back();
+                        bsl::discard(mut_vec1.emplace_back(3_i32));
+                        bsl::discard(mut_vec1.emplace_back(2_i32));
+                        bsl::ut_check(mut_vec1 != mut_vec2);
+
+                        bsl::print() << mut_vec1 << bsl::endl;
+                        bsl::print() << bsl::static_vector<bool, TEST_N>{} << bsl::endl;
+                        bsl::debug<bsl::V>() << mut_vec1 << bsl::endl;
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
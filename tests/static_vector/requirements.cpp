@@ -0,0 +1,103 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/static_vector.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the max number of elements used by the tests
+    constexpr bsl::uintmx TEST_N{static_cast<bsl::uintmx>(4)};
+
+    constinit bsl::static_vector<bool, TEST_N> const g_verify_constinit{};
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"verify supports constinit"} = []() noexcept {
+        bsl::discard(g_verify_constinit);
+    };
+
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::static_vector<bool, TEST_N> mut_vec{};
+            bsl::static_vector<bool, TEST_N> const vec{};
+            bsl::ut_then{} = []() noexcept {
+                static_assert(noexcept(bsl::static_vector<bool, TEST_N>{}));
+                static_assert(noexcept(bsl::static_vector<bool, TEST_N>{vec}));
+                static_assert(noexcept(mut_vec = vec));
+
+                static_assert(noexcept(mut_vec.at_if({})));
+                static_assert(noexcept(mut_vec.front_if()));
+                static_assert(noexcept(mut_vec.back_if()));
+                static_assert(noexcept(mut_vec.data()));
+                static_assert(noexcept(mut_vec.begin()));
+                static_assert(noexcept(mut_vec.cbegin()));
+                static_assert(noexcept(mut_vec.end()));
+                static_assert(noexcept(mut_vec.cend()));
+                static_assert(noexcept(mut_vec.empty()));
+                static_assert(noexcept(mut_vec.full()));
+                static_assert(noexcept(mut_vec.size()));
+                static_assert(noexcept(mut_vec.max_size()));
+                static_assert(noexcept(mut_vec.size_bytes()));
+                static_assert(noexcept(mut_vec.emplace_back(true)));
+                static_assert(noexcept(mut_vec.try_push_back(true)));
+                static_assert(noexcept(mut_vec.pop_back()));
+                static_assert(noexcept(mut_vec.erase({})));
+                static_assert(noexcept(mut_vec.swap_erase({})));
+                static_assert(noexcept(mut_vec.resize({})));
+                static_assert(noexcept(mut_vec.clear()));
+
+                static_assert(noexcept(vec.at_if({})));
+                static_assert(noexcept(vec.front_if()));
+                static_assert(noexcept(vec.back_if()));
+                static_assert(noexcept(vec.data()));
+                static_assert(noexcept(vec.begin()));
+                static_assert(noexcept(vec.cbegin()));
+                static_assert(noexcept(vec.end()));
+                static_assert(noexcept(vec.cend()));
+                static_assert(noexcept(vec.empty()));
+                static_assert(noexcept(vec.full()));
+                static_assert(noexcept(vec.size()));
+                static_assert(noexcept(vec.max_size()));
+                static_assert(noexcept(vec.size_bytes()));
+                static_assert(noexcept(vec == vec));
+                static_assert(noexcept(vec != vec));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
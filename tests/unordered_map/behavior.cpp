@@ -25,7 +25,11 @@
 #include <bsl/add_const.hpp>
 #include <bsl/as_const.hpp>
 #include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/hash.hpp>
+#include <bsl/heap_allocator.hpp>
 #include <bsl/move.hpp>
+#include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/unordered_map.hpp>
 #include <bsl/ut.hpp>
@@ -34,6 +38,125 @@
 
 namespace
 {
+    /// @brief defines the number of keys used by the larger tests
+    constexpr auto NUM_KEYS{100_umx};
+
+    /// @class <anonymous>::collide_hash
+    ///
+    /// <!-- description -->
+    ///   @brief A hash function that maps every key to the same slot,
+    ///     which forces the map to probe for every operation.
+    ///
+    class collide_hash final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Returns 0 for every key
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key ignored
+        ///   @return Returns 0 for every key
+        ///
+        [[nodiscard]] constexpr auto
+        operator()(bsl::safe_umx const &key) const noexcept -> bsl::safe_umx
+        {
+            bsl::discard(key);
+            return bsl::safe_umx::magic_0();
+        }
+    };
+
+    /// @class <anonymous>::identity_hash
+    ///
+    /// <!-- description -->
+    ///   @brief A hash function that returns the key itself, which makes
+    ///     it possible to place keys in a specific slot (including the
+    ///     last slot so that probing wraps around the table).
+    ///
+    class identity_hash final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Returns the key
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key to hash
+        ///   @return Returns the key
+        ///
+        [[nodiscard]] constexpr auto
+        operator()(bsl::safe_umx const &key) const noexcept -> bsl::safe_umx
+        {
+            return key;
+        }
+    };
+
+    /// @class <anonymous>::limited_allocator
+    ///
+    /// <!-- description -->
+    ///   @brief An allocator that fails once it has handed out a given
+    ///     number of arrays, which is used to check that the map is left
+    ///     unchanged when an allocation fails.
+    ///
+    class limited_allocator final
+    {
+        /// @brief stores the number of arrays that can still be allocated
+        bsl::safe_umx *m_budget;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a limited_allocator
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_budget the number of arrays that can be allocated
+        ///
+        explicit constexpr limited_allocator(bsl::safe_umx &mut_budget) noexcept    // --
+            : m_budget{&mut_budget}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns an array from the heap, or a nullptr if the
+        ///     budget has been used up.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U the type of element to allocate
+        ///   @param count the number of elements to allocate
+        ///   @return Returns an array from the heap, or a nullptr if the
+        ///     budget has been used up.
+        ///
+        template<typename U>
+        [[nodiscard]] constexpr auto
+        allocate(bsl::safe_umx const &count) const noexcept -> U *
+        {
+            if (m_budget->is_zero()) {
+                return nullptr;
+            }
+
+            *m_budget = (*m_budget - bsl::safe_umx::magic_1()).checked();
+            return bsl::heap_allocator{}.allocate<U>(count);
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases an array returned by allocate()
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U the type of element to deallocate
+        ///   @param pmut_ptr a pointer to the array to deallocate
+        ///   @param count the number of elements in the array
+        ///
+        template<typename U>
+        constexpr void
+        deallocate(U *const pmut_ptr, bsl::safe_umx const &count) const noexcept
+        {
+            bsl::heap_allocator{}.deallocate(pmut_ptr, count);
+        }
+    };
+
+    /// @brief the type of map used by the allocation failure tests
+    using limited_map_type = bsl::unordered_map<
+        bsl::safe_umx,
+        bsl::safe_umx,
+        bsl::hash<bsl::safe_umx>,
+        limited_allocator>;
+
     /// <!-- description -->
     ///   @brief Used to execute the actual checks. We put the checks in this
     ///     function so that we can validate the tests both at compile-time
@@ -206,6 +329,219 @@ namespace
             };
         };
 
+        bsl::ut_scenario{"erase"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::unordered_map<bool, bool> mut_map{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_map.erase(true));
+                    };
+
+                    mut_map.at(true) = true;
+                    mut_map.at(false) = true;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_map.erase(true));
+                        bsl::ut_check(!mut_map.erase(true));
+                        bsl::ut_check(!bsl::as_const(mut_map).contains(true));
+                        bsl::ut_check(bsl::as_const(mut_map).contains(false));
+                        bsl::ut_check(bsl::as_const(mut_map).size() == 1_umx);
+                    };
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_map.erase(false));
+                        bsl::ut_check(bsl::as_const(mut_map).empty());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"many keys"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::unordered_map<bsl::safe_umx, bsl::safe_umx> mut_map{};
+                bsl::ut_when{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < NUM_KEYS; ++mut_i) {
+                        mut_map.at(bsl::to_umx(mut_i)) = (bsl::to_umx(mut_i) + 1_umx).checked();
+                    }
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).size() == NUM_KEYS);
+                        for (bsl::safe_idx mut_i{}; mut_i < NUM_KEYS; ++mut_i) {
+                            auto const &val{bsl::as_const(mut_map).at(bsl::to_umx(mut_i))};
+                            bsl::ut_check(val == (bsl::to_umx(mut_i) + 1_umx).checked());
+                        }
+                    };
+
+                    for (bsl::safe_idx mut_i{}; mut_i < NUM_KEYS;
+                         mut_i += bsl::safe_idx::magic_2()) {
+                        bsl::ut_check(mut_map.erase(bsl::to_umx(mut_i)));
+                    }
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const half{(NUM_KEYS / 2_umx).checked()};
+                        bsl::ut_check(bsl::as_const(mut_map).size() == half);
+                        for (bsl::safe_idx mut_i{}; mut_i < NUM_KEYS; ++mut_i) {
+                            bool const odd{(bsl::to_umx(mut_i) & 1_umx).is_pos()};
+                            bool const found{bsl::as_const(mut_map).contains(bsl::to_umx(mut_i))};
+                            bsl::ut_check(found == odd);
+                        }
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"collisions"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::unordered_map<bsl::safe_umx, bsl::safe_umx, collide_hash> mut_map{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_map.at(1_umx) = 1_umx;
+                    mut_map.at(2_umx) = 2_umx;
+                    mut_map.at(3_umx) = 3_umx;
+                    bsl::ut_check(mut_map.erase(1_umx));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!bsl::as_const(mut_map).contains(1_umx));
+                        bsl::ut_check(bsl::as_const(mut_map).at(2_umx) == 2_umx);
+                        bsl::ut_check(bsl::as_const(mut_map).at(3_umx) == 3_umx);
+                    };
+
+                    bsl::ut_check(mut_map.erase(3_umx));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).at(2_umx) == 2_umx);
+                        bsl::ut_check(!bsl::as_const(mut_map).contains(3_umx));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"probing wraps around the table"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::unordered_map<bsl::safe_umx, bsl::safe_umx, identity_hash> mut_map{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_map.reserve(1_umx);
+                    auto const last{(mut_map.bucket_count() - 1_umx).checked()};
+                    auto const last2{(last + mut_map.bucket_count()).checked()};
+
+                    mut_map.at(last) = 1_umx;
+                    mut_map.at(last2) = 2_umx;
+                    mut_map.at(0_umx) = 3_umx;
+                    bsl::ut_check(mut_map.erase(last));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).at(last2) == 2_umx);
+                        bsl::ut_check(bsl::as_const(mut_map).at(0_umx) == 3_umx);
+                    };
+
+                    bsl::ut_check(mut_map.erase(0_umx));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).at(last2) == 2_umx);
+                        bsl::ut_check(bsl::as_const(mut_map).size() == 1_umx);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"reserve"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::unordered_map<bsl::safe_umx, bsl::safe_umx> mut_map{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).bucket_count().is_zero());
+                    };
+
+                    mut_map.reserve(0_umx);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).bucket_count().is_zero());
+                    };
+
+                    mut_map.reserve(NUM_KEYS);
+                    auto const buckets{bsl::as_const(mut_map).bucket_count()};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(buckets >= NUM_KEYS);
+                    };
+
+                    for (bsl::safe_idx mut_i{}; mut_i < NUM_KEYS; ++mut_i) {
+                        mut_map.at(bsl::to_umx(mut_i)) = bsl::to_umx(mut_i);
+                    }
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).bucket_count() == buckets);
+                    };
+
+                    mut_map.reserve(1_umx);
+                    mut_map.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).bucket_count() == buckets);
+                        bsl::ut_check(bsl::as_const(mut_map).empty());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"at_if and insert"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::unordered_map<bsl::safe_umx, bsl::safe_umx> mut_map{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_map.insert(1_umx, 42_umx));
+                        bsl::ut_check(mut_map.insert(1_umx, 23_umx));
+                        bsl::ut_check(bsl::as_const(mut_map).size() == 1_umx);
+                        bsl::ut_check(bsl::as_const(mut_map).at(1_umx) == 23_umx);
+                        bsl::ut_check(nullptr != mut_map.at_if(2_umx));
+                        bsl::ut_check(bsl::as_const(mut_map).size() == 2_umx);
+                        *mut_map.at_if(2_umx) = 42_umx;
+                        bsl::ut_check(bsl::as_const(mut_map).at(2_umx) == 42_umx);
+                        bsl::ut_check(mut_map.try_reserve(NUM_KEYS));
+                        bsl::ut_check(bsl::as_const(mut_map).bucket_count() >= NUM_KEYS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocation failure"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_umx mut_budget{};
+                limited_map_type mut_map{limited_allocator{mut_budget}};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(nullptr == mut_map.at_if(1_umx));
+                        bsl::ut_check(!mut_map.insert(1_umx, 1_umx));
+                        bsl::ut_check(!mut_map.try_reserve(1_umx));
+                        bsl::ut_check(bsl::as_const(mut_map).empty());
+                        bsl::ut_check(bsl::as_const(mut_map).bucket_count().is_zero());
+                    };
+
+                    mut_budget = 2_umx;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_map.try_reserve(1_umx));
+                        bsl::ut_check(bsl::as_const(mut_map).bucket_count().is_zero());
+                    };
+
+                    mut_budget = 3_umx;
+                    for (bsl::safe_idx mut_i{}; mut_i < 6_umx; ++mut_i) {
+                        bsl::discard(mut_map.insert(bsl::to_umx(mut_i), bsl::to_umx(mut_i)));
+                    }
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::as_const(mut_map).size() == 6_umx);
+                        bsl::ut_check(bsl::as_const(mut_map).bucket_count() == 8_umx);
+                        bsl::ut_check(!mut_map.insert(6_umx, 6_umx));
+                        bsl::ut_check(nullptr != mut_map.at_if(5_umx));
+                        bsl::ut_check(bsl::as_const(mut_map).size() == 6_umx);
+                        bsl::ut_check(bsl::as_const(mut_map).bucket_count() == 8_umx);
+                        for (bsl::safe_idx mut_i{}; mut_i < 6_umx; ++mut_i) {
+                            auto const key{bsl::to_umx(mut_i)};
+                            bsl::ut_check(bsl::as_const(mut_map).at(key) == key);
+                        }
+                    };
+
+                    mut_budget = 3_umx;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_map.insert(6_umx, 6_umx));
+                        bsl::ut_check(bsl::as_const(mut_map).bucket_count() == 16_umx);
+                        bsl::ut_check(bsl::as_const(mut_map).at(6_umx) == 6_umx);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"copy"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 bsl::unordered_map<bool, bool> mut_map1{};
@@ -23,6 +23,7 @@
 /// SOFTWARE.
 
 #include <bsl/discard.hpp>
+#include <bsl/heap_allocator.hpp>
 #include <bsl/unordered_map.hpp>
 #include <bsl/ut.hpp>
 
@@ -52,16 +53,23 @@ main() noexcept -> bsl::exit_code
             bsl::unordered_map<bool, bool> const map{};
             bsl::ut_then{} = []() noexcept {
                 static_assert(noexcept(bsl::unordered_map<bool, bool>{}));
+                static_assert(noexcept(bsl::unordered_map<bool, bool>{bsl::heap_allocator{}}));
 
                 static_assert(noexcept(mut_map.empty()));
                 static_assert(noexcept(mut_map.size()));
+                static_assert(noexcept(mut_map.bucket_count()));
+                static_assert(noexcept(mut_map.reserve({})));
+                static_assert(noexcept(mut_map.try_reserve({})));
                 static_assert(noexcept(mut_map.clear()));
                 static_assert(noexcept(mut_map.at({})));
+                static_assert(noexcept(mut_map.at_if({})));
+                static_assert(noexcept(mut_map.insert({}, {})));
                 static_assert(noexcept(mut_map.erase({})));
                 static_assert(noexcept(mut_map.contains({})));
 
                 static_assert(noexcept(map.empty()));
                 static_assert(noexcept(map.size()));
+                static_assert(noexcept(map.bucket_count()));
                 static_assert(noexcept(map.at({})));
                 static_assert(noexcept(map.contains({})));
             };
@@ -0,0 +1,264 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/carray.hpp>
+#include <bsl/char_type.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/details/binlog.hpp>
+#include <bsl/details/fmt_impl_integral_helpers.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/fmt_align.hpp>
+#include <bsl/fmt_options.hpp>
+#include <bsl/fmt_sign.hpp>
+#include <bsl/fmt_type.hpp>
+#include <bsl/safe_integral.hpp>
+
+#include <cstdio>
+
+/// NOTE:
+/// - This tool reads the output of an application that was compiled with
+///   BSL_BINARY_LOG defined from stdin and writes it to stdout as text,
+///   formatting each binary item (see bsl/details/binlog.hpp) exactly the
+///   same way bsl::out would have if BSL_BINARY_LOG was not defined.
+/// - The output must be decoded on a machine with the same byte order as
+///   the machine that produced it.
+///
+
+static_assert(!bsl::details::BINLOG_ENABLED, "binlog_decode must be compiled without binlog");
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Reads a single byte from stdin.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_byte where to store the byte that was read
+    ///   @return Returns true if a byte was read, false on EOF
+    ///
+    [[nodiscard]] auto
+    read_byte(bsl::uint8 &mut_byte) noexcept -> bool
+    {
+        auto const c{std::getchar()};
+        if (EOF == c) {
+            return false;
+        }
+
+        mut_byte = static_cast<bsl::uint8>(c);
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Reads the fmt_options of a binary item from stdin.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_ops where to store the fmt_options that were read
+    ///   @return Returns true if the fmt_options were read, false on EOF
+    ///
+    [[nodiscard]] auto
+    read_ops(bsl::fmt_options &mut_ops) noexcept -> bool
+    {
+        constexpr auto byte_bits{static_cast<bsl::uintmx>(8)};
+        bsl::carray<bsl::uint8, bsl::details::BINLOG_OPS_SIZE> mut_buf{};
+
+        for (bsl::uintmx mut_i{}; mut_i < mut_buf.size(); ++mut_i) {
+            if (!read_byte(*mut_buf.at_if(mut_i))) {
+                return false;
+            }
+        }
+
+        constexpr bsl::uintmx idx_fill{static_cast<bsl::uintmx>(0)};
+        constexpr bsl::uintmx idx_align{static_cast<bsl::uintmx>(1)};
+        constexpr bsl::uintmx idx_sign{static_cast<bsl::uintmx>(2)};
+        constexpr bsl::uintmx idx_flags{static_cast<bsl::uintmx>(3)};
+        constexpr bsl::uintmx idx_width_lo{static_cast<bsl::uintmx>(4)};
+        constexpr bsl::uintmx idx_width_hi{static_cast<bsl::uintmx>(5)};
+        constexpr bsl::uintmx idx_type{static_cast<bsl::uintmx>(6)};
+
+        auto const flags{*mut_buf.at_if(idx_flags)};
+        auto const width_lo{static_cast<bsl::uintmx>(*mut_buf.at_if(idx_width_lo))};
+        auto const width_hi{static_cast<bsl::uintmx>(*mut_buf.at_if(idx_width_hi))};
+
+        mut_ops.set_fill(static_cast<bsl::char_type>(*mut_buf.at_if(idx_fill)));
+        mut_ops.set_align(static_cast<bsl::fmt_align>(*mut_buf.at_if(idx_align)));
+        mut_ops.set_sign(static_cast<bsl::fmt_sign>(*mut_buf.at_if(idx_sign)));
+        mut_ops.set_alternate_form(0 != (flags & bsl::details::BINLOG_FLAG_ALTERNATE_FORM));
+        mut_ops.set_sign_aware(0 != (flags & bsl::details::BINLOG_FLAG_SIGN_AWARE));
+        mut_ops.set_width(bsl::safe_umx{width_lo | (width_hi << byte_bits)});
+        mut_ops.set_type(static_cast<bsl::fmt_type>(*mut_buf.at_if(idx_type)));
+
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Reads the raw bytes of an integral from stdin (unless it
+    ///     was poisoned) and outputs it to stdout.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral to decode
+    ///   @param tag the tag of the binary item being decoded
+    ///   @param ops the fmt_options of the binary item being decoded
+    ///   @return Returns true if the integral was decoded, false on EOF
+    ///
+    template<typename T>
+    [[nodiscard]] auto
+    decode_integral(bsl::uint8 const tag, bsl::fmt_options const &ops) noexcept -> bool
+    {
+        bsl::safe_integral<T> mut_val{};
+
+        if (0 != (tag & bsl::details::BINLOG_TAG_POISONED)) {
+            mut_val = bsl::safe_integral<T>::failure();
+        }
+        else {
+            bsl::carray<bsl::uint8, sizeof(T)> mut_buf{};
+            for (bsl::uintmx mut_i{}; mut_i < mut_buf.size(); ++mut_i) {
+                if (!read_byte(*mut_buf.at_if(mut_i))) {
+                    return false;
+                }
+            }
+
+            T mut_raw{};
+            bsl::discard(__builtin_memcpy(&mut_raw, mut_buf.data(), sizeof(T)));
+            mut_val = bsl::safe_integral<T>{mut_raw};
+        }
+
+        /// NOTE:
+        /// - Integrals that were written with fmt_options came from
+        ///   details::fmt_impl_integral(), so that is what we use here.
+        ///   Everything else came from the << operator.
+        ///
+
+        if (0 != (tag & bsl::details::BINLOG_TAG_OPS)) {
+            bsl::details::fmt_impl_integral(bsl::print(), ops, mut_val);
+        }
+        else {
+            bsl::print() << mut_val;
+        }
+
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Decodes a single binary item (the BINLOG_MARKER has
+    ///     already been read) and outputs it to stdout.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns true if the binary item was decoded, false if
+    ///     EOF was reached or the item is invalid.
+    ///
+    [[nodiscard]] auto
+    decode_item() noexcept -> bool
+    {
+        constexpr auto type_mask{static_cast<bsl::uint8>(
+            bsl::details::BINLOG_TAG_SIZE_MASK | bsl::details::BINLOG_TAG_SIGNED)};
+
+        bsl::uint8 mut_tag{};
+        if (!read_byte(mut_tag)) {
+            return false;
+        }
+
+        if (bsl::details::BINLOG_TAG_NUL == mut_tag) {
+            bsl::print() << '\0';
+            return true;
+        }
+
+        bsl::fmt_options mut_ops{""};
+        if (0 != (mut_tag & bsl::details::BINLOG_TAG_OPS)) {
+            if (!read_ops(mut_ops)) {
+                return false;
+            }
+        }
+        else {
+            bsl::touch();
+        }
+
+        switch (static_cast<bsl::uint8>(mut_tag & type_mask)) {
+            case sizeof(bsl::uint8): {
+                return decode_integral<bsl::uint8>(mut_tag, mut_ops);
+            }
+
+            case sizeof(bsl::uint16): {
+                return decode_integral<bsl::uint16>(mut_tag, mut_ops);
+            }
+
+            case sizeof(bsl::uint32): {
+                return decode_integral<bsl::uint32>(mut_tag, mut_ops);
+            }
+
+            case sizeof(bsl::uint64): {
+                return decode_integral<bsl::uint64>(mut_tag, mut_ops);
+            }
+
+            case bsl::details::BINLOG_TAG_SIGNED | sizeof(bsl::int8): {
+                return decode_integral<bsl::int8>(mut_tag, mut_ops);
+            }
+
+            case bsl::details::BINLOG_TAG_SIGNED | sizeof(bsl::int16): {
+                return decode_integral<bsl::int16>(mut_tag, mut_ops);
+            }
+
+            case bsl::details::BINLOG_TAG_SIGNED | sizeof(bsl::int32): {
+                return decode_integral<bsl::int32>(mut_tag, mut_ops);
+            }
+
+            case bsl::details::BINLOG_TAG_SIGNED | sizeof(bsl::int64): {
+                return decode_integral<bsl::int64>(mut_tag, mut_ops);
+            }
+
+            default: {
+                break;
+            }
+        }
+
+        return false;
+    }
+}
+
+/// <!-- description -->
+///   @brief Decodes binary log output from stdin and writes it to stdout
+///     as text.
+///
+/// <!-- inputs/outputs -->
+///   @return Returns bsl::exit_success if all of stdin was decoded,
+///     bsl::exit_failure if an invalid or truncated binary item was read.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::uint8 mut_byte{};
+    while (read_byte(mut_byte)) {
+        if (bsl::details::BINLOG_MARKER != mut_byte) {
+            bsl::print() << static_cast<bsl::char_type>(mut_byte);
+            continue;
+        }
+
+        if (!decode_item()) {
+            bsl::error() << "binlog_decode: invalid or truncated binary item\n";
+            return bsl::exit_failure;
+        }
+    }
+
+    return bsl::exit_success;
+}